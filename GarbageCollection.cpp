@@ -3,6 +3,7 @@
 #include <utility>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
 #include <list>
 #include <vector>
 #include <algorithm>
@@ -77,7 +78,224 @@ void GC::aligned_free(void *ptr)
 	if (ptr) std::free(*(void**)((char*)ptr - sizeof(void*)));
 }
 
+std::size_t GC::stripe_index(const void *addr, std::size_t stripe_count) noexcept
+{
+	// discard the low bits (which are mostly the same due to alignment) and fold in some higher ones so nearby objects get different stripes
+	auto bits = (std::uintptr_t)addr >> 4;
+	bits ^= bits >> 6;
+
+	return bits % stripe_count;
+}
+
+std::mutex &GC::atomic_ptr_stripe(const void *addr) noexcept
+{
+	// each stripe gets its own cache line so that locking one doesn't cause false sharing with its neighbors
+	struct alignas(64) stripe_t { std::mutex mutex; };
+	static stripe_t stripes[64];
+
+	return stripes[stripe_index(addr, sizeof(stripes) / sizeof(*stripes))].mutex;
+}
+GC::atomic_wait_stripe_t &GC::atomic_ptr_wait_stripe(const void *addr) noexcept
+{
+	static atomic_wait_stripe_t stripes[64];
+
+	return stripes[stripe_index(addr, sizeof(stripes) / sizeof(*stripes))];
+}
+GC::atomic_wait_stripe_t &GC::lockable_wait_stripe(const void *addr) noexcept
+{
+	static atomic_wait_stripe_t stripes[64];
+
+	return stripes[stripe_index(addr, sizeof(stripes) / sizeof(*stripes))];
+}
+
 GC::bind_new_obj_t GC::bind_new_obj;
+GC::raw_arc_t GC::raw_arc;
+
+// ----------------------- //
+
+// -- wrapper lockables -- //
+
+// ----------------------- //
+
+void GC::recursive_shared_mutex::lock()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	// if we already own it, just go deeper
+	if (owner == std::this_thread::get_id()) { ++owner_depth; return; }
+
+	// otherwise wait for everyone else to let go
+	cv.wait(lock, [this] { return owner_depth == 0 && readers == 0; });
+
+	owner = std::this_thread::get_id();
+	owner_depth = 1;
+}
+bool GC::recursive_shared_mutex::try_lock()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (owner == std::this_thread::get_id()) { ++owner_depth; return true; }
+	if (owner_depth != 0 || readers != 0) return false;
+
+	owner = std::this_thread::get_id();
+	owner_depth = 1;
+	return true;
+}
+void GC::recursive_shared_mutex::unlock()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	assert(owner == std::this_thread::get_id() && owner_depth != 0);
+
+	// if that was the last exclusive lock, release ownership and wake up anyone waiting
+	if (--owner_depth == 0)
+	{
+		owner = std::thread::id();
+		cv.notify_all();
+	}
+}
+
+void GC::recursive_shared_mutex::lock_shared()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	// the exclusive owner can always take a shared lock - otherwise wait for the exclusive owner to let go
+	if (owner != std::this_thread::get_id()) cv.wait(lock, [this] { return owner_depth == 0; });
+
+	++readers;
+}
+bool GC::recursive_shared_mutex::try_lock_shared()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (owner != std::this_thread::get_id() && owner_depth != 0) return false;
+
+	++readers;
+	return true;
+}
+void GC::recursive_shared_mutex::unlock_shared()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	assert(readers != 0);
+
+	// if that was the last shared lock, wake up anyone waiting for exclusive access
+	if (--readers == 0) cv.notify_all();
+}
+
+thread_local GC::compact_recursive_mutex::held_list_t GC::compact_recursive_mutex::held;
+
+GC::compact_recursive_mutex::held_t *GC::compact_recursive_mutex::held_list_t::find(const compact_recursive_mutex *mutex) noexcept
+{
+	held_t *entries = extra ? extra : local;
+
+	// search newest first - recursive locks are usually of the most recently acquired mutex
+	for (std::size_t i = size; i-- > 0; ) if (entries[i].mutex == mutex) return entries + i;
+	return nullptr;
+}
+void GC::compact_recursive_mutex::held_list_t::reserve_one()
+{
+	held_t *entries = extra ? extra : local;
+	std::size_t cap = extra ? extra_cap : sizeof(local) / sizeof(*local);
+
+	// if we're full, move everything into a bigger heap array
+	if (size == cap)
+	{
+		held_t *bigger = new held_t[cap * 2];
+		std::copy(entries, entries + size, bigger);
+
+		delete[] extra;
+		extra = bigger;
+		extra_cap = cap * 2;
+	}
+}
+void GC::compact_recursive_mutex::held_list_t::push(const compact_recursive_mutex *mutex) noexcept
+{
+	(extra ? extra : local)[size++] = { mutex, 1 };
+}
+void GC::compact_recursive_mutex::held_list_t::erase(held_t *entry) noexcept
+{
+	// order doesn't matter, so just move the last entry into its place
+	*entry = (extra ? extra : local)[--size];
+
+	// go back to the inline storage once we're not holding anything
+	if (size == 0 && extra)
+	{
+		delete[] extra;
+		extra = nullptr;
+		extra_cap = 0;
+	}
+}
+
+void GC::compact_recursive_mutex::acquire() noexcept
+{
+	// spin for a bit first - wrapper locks are usually held very briefly
+	std::uint8_t s = state.load(std::memory_order_relaxed);
+	for (int i = 0; i < 64; ++i)
+	{
+		if (!(s & locked_bit))
+		{
+			if (state.compare_exchange_weak(s, s | locked_bit, std::memory_order_acquire, std::memory_order_relaxed)) return;
+		}
+		else
+		{
+			std::this_thread::yield();
+			s = state.load(std::memory_order_relaxed);
+		}
+	}
+
+	// otherwise park on the wait table until we get it.
+	// the parked bit is only set under the stripe mutex, and unlock() notifies under it, so wakeups can't be missed.
+	atomic_wait_stripe_t &stripe = lockable_wait_stripe(this);
+	std::unique_lock<std::mutex> lock(stripe.mutex);
+	while (true)
+	{
+		s = state.load(std::memory_order_relaxed);
+		if (!(s & locked_bit))
+		{
+			if (state.compare_exchange_weak(s, s | locked_bit, std::memory_order_acquire, std::memory_order_relaxed)) return;
+		}
+		else if ((s & parked_bit) || state.compare_exchange_weak(s, s | parked_bit, std::memory_order_relaxed, std::memory_order_relaxed)) stripe.cv.wait(lock);
+	}
+}
+
+void GC::compact_recursive_mutex::lock()
+{
+	// if we already own it, just go deeper
+	if (held_t *entry = held.find(this)) { ++entry->depth; return; }
+
+	held.reserve_one();
+	acquire();
+	held.push(this);
+}
+bool GC::compact_recursive_mutex::try_lock()
+{
+	if (held_t *entry = held.find(this)) { ++entry->depth; return true; }
+
+	held.reserve_one();
+	std::uint8_t s = state.load(std::memory_order_relaxed);
+	do { if (s & locked_bit) return false; }
+	while (!state.compare_exchange_weak(s, s | locked_bit, std::memory_order_acquire, std::memory_order_relaxed));
+
+	held.push(this);
+	return true;
+}
+void GC::compact_recursive_mutex::unlock()
+{
+	held_t *entry = held.find(this);
+	assert(entry && entry->depth != 0);
+
+	if (--entry->depth != 0) return;
+	held.erase(entry);
+
+	// release the lock and wake up anyone that parked while we held it (they'll re-park if they lose the race)
+	if (state.exchange(0, std::memory_order_release) & parked_bit)
+	{
+		atomic_wait_stripe_t &stripe = lockable_wait_stripe(this);
+		std::lock_guard<std::mutex> lock(stripe.mutex);
+		stripe.cv.notify_all();
+	}
+}
 
 // ------------------------------------ //
 
@@ -177,18 +395,35 @@ GC::disjoint_module::~disjoint_module()
 
 void GC::info::mark_sweep()
 {
+	// the marked objects whose outgoing arcs have yet to be routed.
+	// this is an explicit stack rather than recursion so that long chains of objects (e.g. intrusive lists) can't overflow the collector's stack.
+	static thread_local std::vector<info*> pending;
+
 	// mark this handle
 	this->marked = true;
+	pending.push_back(this);
 
-	// for each outgoing arc
-	this->route(+[](const smart_handle &arc)
+	while (!pending.empty())
 	{
-		// get the current arc value - this is only safe because we're in a collect action
-		info *raw = arc.raw_handle();
+		info *obj = pending.back();
+		pending.pop_back();
 
-		// if it hasn't been marked, recurse to it (only if non-null)
-		if (raw && !raw->marked) raw->mark_sweep();
-	});
+		// for each outgoing arc
+		obj->route(router_fn(+[](const smart_handle &arc)
+		{
+			// get the current arc value - this is only safe because we're in a collect action
+			info *raw = arc.raw_handle();
+
+			// if it hasn't been marked, mark it and schedule it to be routed (only if non-null)
+			if (raw && !raw->marked) { raw->marked = true; pending.push_back(raw); }
+		},
+		+[](info *const *arcs, std::size_t count)
+		{
+			// raw arcs can change during the collect action, but the router synchronizes this and any new arcs go through the write barrier
+			for (std::size_t i = 0; i < count; ++i)
+				if (arcs[i] && !arcs[i]->marked) { arcs[i]->marked = true; pending.push_back(arcs[i]); }
+		}));
+	}
 }
 
 bool GC::disjoint_module::collect()
@@ -224,6 +459,9 @@ bool GC::disjoint_module::collect()
 		// ref count del cache should also be empty
 		assert(ref_count_del_cache.empty());
 
+		// as should the raw arc barrier cache
+		assert(raw_arc_barrier_cache.empty());
+
 		// the del list should also be empty
 		assert(del_list.empty());
 	}
@@ -302,6 +540,9 @@ bool GC::disjoint_module::collect()
 		// we only include the non-null targets for convenience.
 		for (auto root : roots)
 			if (*root) root_objs.insert(*root);
+
+		// the pinned objects are roots as well (see pinned_objs)
+		for (const auto &pin : pinned_objs) root_objs.insert(pin.first);
 	}
 
 	// -----------------------------------------------------------
@@ -315,23 +556,50 @@ bool GC::disjoint_module::collect()
 	// perform a mark sweep from each root object
 	for (info *i : root_objs) i->mark_sweep();
 
-	// -- clean anything not marked -- //
+	// objects condemned by ref count deletion logic before we started may not have pinned their arcs yet.
+	// those pins go through the write barrier, so we just need to wait for them before the final barrier check.
+	// ref count deletions are cached now, so no new ones can come along - this is never a long wait.
+	while (unpinned_count.load() != 0) std::this_thread::yield();
 
-	// for each item in the gc database
-	for (info *i = objs.front(), *next; i; i = next)
 	{
-		next = i->next;
+		std::unique_lock<std::mutex> internal_lock(internal_mutex);
 
-		// if it hasn't been marked, mark it for deletion
-		if (!i->marked)
+		// objects can be moved out of raw arcs after we've routed past them (see raw_arc_barrier_cache).
+		// mark from each of those as well - this can run user code (routers), so we can't hold the lock while doing so.
+		while (!raw_arc_barrier_cache.empty())
 		{
-			// mark it for deletion
-			objs.remove(i);
-			del_list.add(i);
+			std::unordered_set<info*> barrier_objs;
+			barrier_objs.swap(raw_arc_barrier_cache);
 
-			#if DRAGAZO_GARBAGE_COLLECT_MSG
-			++collect_count;
-			#endif
+			internal_lock.unlock();
+			for (info *i : barrier_objs) if (!i->marked) i->mark_sweep();
+			internal_lock.lock();
+		}
+
+		// -- clean anything not marked -- //
+
+		// this is done under lock so no raw arc can hand out an object between the final barrier check and the sweep.
+		// (this is non-blocking, so it's fine to do under lock).
+
+		// for each item in the gc database
+		for (info *i = objs.front(), *next; i; i = next)
+		{
+			next = i->next;
+
+			// if it hasn't been marked, mark it for deletion
+			if (!i->marked)
+			{
+				// mark it for deletion
+				objs.remove(i);
+				del_list.add(i);
+
+				// it's being condemned, so it can no longer be revived through weak slots
+				__weak_expire(i);
+
+				#if DRAGAZO_GARBAGE_COLLECT_MSG
+				++collect_count;
+				#endif
+			}
 		}
 	}
 
@@ -404,6 +672,9 @@ bool GC::disjoint_module::collect()
 	}
 	ref_count_del_cache.clear();
 
+	// the objects from the obj add cache that need to be deleted at the end of the collection action
+	std::vector<info*> add_cache_del_list;
+
 	// end the collection action
 	// must be after dtors/deallocs to ensure that if they call collect() it'll no-op (otherwise very slow).
 	// additionally, must be after those to ensure the caches are fully emptied as the last atomic step.
@@ -414,10 +685,21 @@ bool GC::disjoint_module::collect()
 		// mark that there is no longer a collector thread
 		collector_thread = std::thread::id();
 
-		// apply all the cached obj add actions that occurred during the collection action
-		for (auto i : objs_add_cache) objs.add(i);
+		// wake up anyone blocking on this collection to finish
+		collect_cv.notify_all();
+
+		// apply all the cached obj add actions that occurred during the collection action.
+		// objects whose reference count fell to zero during the collection are deleted instead (see ref count deletion logic).
+		for (auto i : objs_add_cache)
+		{
+			if (i->ref_count == 0) add_cache_del_list.push_back(i);
+			else objs.add(i);
+		}
 		objs_add_cache.clear();
 
+		// they're condemned, but haven't pinned their arcs yet (see ref count deletion logic)
+		unpinned_count += add_cache_del_list.size();
+
 		// apply cached root actions
 		for (auto i : roots_add_cache) roots.insert(i);
 		roots_add_cache.clear();
@@ -429,14 +711,25 @@ bool GC::disjoint_module::collect()
 		// apply all the cached handle repoint actions
 		for (auto i : handle_repoint_cache) *i.first = i.second;
 		handle_repoint_cache.clear();
+
+		// the sweep is done, so any remaining barrier objects are irrelevant
+		raw_arc_barrier_cache.clear();
 	}
 
+	// now that the cached repoints have been applied, nothing refers to the zero reference count objects from the obj add cache
+	if (!add_cache_del_list.empty()) destroy_condemned(add_cache_del_list.data(), add_cache_del_list.size());
+
 	// return that we did the collection
 	return true;
 }
 void GC::disjoint_module::blocking_collect()
 {
-	while (!collect());
+	while (!collect())
+	{
+		// someone else is collecting - sleep until they're done rather than spinning
+		std::unique_lock<std::mutex> internal_lock(internal_mutex);
+		collect_cv.wait(internal_lock, [this] { return collector_thread == std::thread::id(); });
+	}
 }
 
 bool GC::disjoint_module::this_is_collector_thread()
@@ -444,6 +737,18 @@ bool GC::disjoint_module::this_is_collector_thread()
 	std::lock_guard<std::mutex> internal_lock(internal_mutex);
 	return collector_thread == std::this_thread::get_id();
 }
+bool GC::disjoint_module::this_is_collector_destroying(const smart_handle &handle)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	// ref count deletions are cached up until the unreachable objects have been destroyed (and there are no destructor calls before then)
+	if (collector_thread != std::this_thread::get_id() || !cache_ref_count_del_actions) return false;
+
+	// in that phase the unmarked objects are exactly the ones in the del list (everything else either survived marking or was created marked).
+	// the handle may have been repointed during this collection, so we need its current target rather than its raw value.
+	info *target = __get_current_target(handle);
+	return target && !target->marked;
+}
 
 void GC::disjoint_module::schedule_handle_create_null(smart_handle &handle)
 {
@@ -476,10 +781,20 @@ void GC::disjoint_module::schedule_handle_create_bind_new_obj(smart_handle &hand
 		// if this branch was selected, the caches should be empty
 		assert(objs_add_cache.empty());
 
+		// the next collection clears the mark anyway, but it should never be read uninitialized
+		new_obj->marked = false;
+
 		objs.add(new_obj);
 	}
 	// otherwise we need to cache the request
-	else objs_add_cache.insert(new_obj);
+	else
+	{
+		// it's not under consideration by this collection, but raw arcs can still hand it to the marker.
+		// marking it up front makes the marker skip it (if it's applied before marking begins, its mark is cleared then).
+		new_obj->marked = true;
+
+		objs_add_cache.insert(new_obj);
+	}
 }
 void GC::disjoint_module::schedule_handle_create_alias(smart_handle &handle, const smart_handle &src_handle)
 {
@@ -508,6 +823,34 @@ void GC::disjoint_module::schedule_handle_create_alias(smart_handle &handle, con
 	__schedule_handle_root(handle);
 }
 
+void GC::disjoint_module::schedule_handle_create_raw_arc(smart_handle &handle, info *target)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// if we're going to repoint outside the disjunction of the handle, that's a disjunction violation
+	if (target && handle.disjunction != target->disjunction)
+	{
+		throw GC::disjunction_error("attempt to repoint GC::ptr outside of the current disjunction");
+	}
+
+	#endif
+
+	// point it at the target
+	handle.raw = target;
+
+	// increment the target reference count - the target is escaping from a raw arc, so it needs the write barrier
+	if (target)
+	{
+		++target->ref_count;
+		__raw_arc_barrier(target);
+	}
+
+	// root it
+	__schedule_handle_root(handle);
+}
+
 void GC::disjoint_module::schedule_handle_destroy(const smart_handle &handle)
 {
 	std::unique_lock<std::mutex> internal_lock(internal_mutex);
@@ -518,6 +861,11 @@ void GC::disjoint_module::schedule_handle_destroy(const smart_handle &handle)
 	// unroot the handle
 	__schedule_handle_unroot(handle);
 
+	// if the collector hasn't routed through this handle yet, its (snapshot) target could have been copied into a handle created after the roots were gathered.
+	// that new handle isn't part of the snapshot, so once this one is gone the collector could miss the target - it needs the write barrier.
+	// the collector itself only destroys handles after the sweep (when the barrier is irrelevant), so we skip the cache insert for those.
+	if (collector_thread != std::this_thread::get_id()) __raw_arc_barrier(handle.raw);
+
 	// purge the handle from the repoint cache so we don't dereference undefined memory.
 	// the const cast is ok because we won't be modifying it - just for lookup.
 	handle_repoint_cache.erase(const_cast<info**>(&handle.raw));
@@ -607,6 +955,210 @@ void GC::disjoint_module::schedule_handle_repoint_swap(smart_handle &handle_a, s
 	}
 }
 
+GC::info *GC::disjoint_module::raw_arc_acquire(const smart_handle &src)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	// get the target
+	info *target = __get_current_target(src);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// if we're going to store an arc outside the disjunction of the target, that's a disjunction violation
+	if (target && target->disjunction != this)
+	{
+		throw GC::disjunction_error("attempt to store a GC::ptr outside of the current disjunction");
+	}
+
+	#endif
+
+	// increment the target reference count
+	if (target)
+	{
+		++target->ref_count;
+		__raw_arc_barrier(target);
+	}
+
+	return target;
+}
+void GC::disjoint_module::raw_arc_acquire(info *target)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// if we're going to store an arc outside the disjunction of the target, that's a disjunction violation
+	if (target && target->disjunction != this)
+	{
+		throw GC::disjunction_error("attempt to store a GC::ptr outside of the current disjunction");
+	}
+
+	#endif
+
+	// increment the target reference count
+	if (target)
+	{
+		++target->ref_count;
+		__raw_arc_barrier(target);
+	}
+}
+void GC::disjoint_module::raw_arc_release(info *target)
+{
+	std::unique_lock<std::mutex> internal_lock(internal_mutex);
+
+	// dec the reference count
+	__MUST_BE_LAST_ref_count_dec(target, std::move(internal_lock));
+}
+std::size_t GC::disjoint_module::raw_arc_detach(info **targets, std::size_t count)
+{
+	if (count == 0) return 0;
+
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	// the number of targets that the caller needs to destroy (these are moved to the front of targets)
+	std::size_t dead = 0;
+
+	// this is the same as the ref count deletion logic, except that immediate deletions are left to the caller
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		info *target = targets[i];
+		if (target && --target->ref_count == 0 && __condemn(target)) targets[dead++] = target;
+	}
+
+	return dead;
+}
+void GC::disjoint_module::raw_arc_destroy(info *const *targets, std::size_t count)
+{
+	if (count != 0) destroy_condemned(targets, count);
+}
+
+void GC::disjoint_module::schedule_handle_create_weak(smart_handle &handle, const weak_slot &slot)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// the slot is protected by the mutex of the disjunction it was bound in, so anything else is a disjunction violation
+	if (slot.disjunction && slot.disjunction != this)
+	{
+		throw GC::disjunction_error("attempt to repoint GC::ptr outside of the current disjunction");
+	}
+
+	#endif
+
+	// point it at the target (null if expired)
+	handle.raw = slot.target;
+
+	// increment the target reference count - the target could be unreachable (but not yet swept), so it needs the write barrier
+	if (handle.raw)
+	{
+		++handle.raw->ref_count;
+		__raw_arc_barrier(handle.raw);
+	}
+
+	// root it
+	__schedule_handle_root(handle);
+}
+void GC::disjoint_module::weak_bind(weak_slot &slot, const smart_handle &src)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	info *target = __get_current_target(src);
+	assert(target && !slot.target);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// slots are expired by the disjunction of their target, so they must be bound there
+	if (target->disjunction != this)
+	{
+		throw GC::disjunction_error("attempt to bind weak reference outside of the current disjunction");
+	}
+
+	#endif
+
+	// link it to the front of the target's slot list
+	weak_slot *&head = weak_slots[target];
+	slot.target = target;
+	slot.disjunction = this;
+	slot.next = head;
+	head = &slot;
+}
+void GC::disjoint_module::weak_unbind(weak_slot &slot)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	// if it already expired there's nothing to do
+	if (!slot.target) return;
+
+	// unlink it from the target's slot list
+	auto iter = weak_slots.find(slot.target);
+	assert(iter != weak_slots.end());
+
+	weak_slot **link = &iter->second;
+	while (*link != &slot) link = &(*link)->next;
+	*link = slot.next;
+
+	if (!iter->second) weak_slots.erase(iter);
+
+	slot.target = nullptr;
+	slot.next = nullptr;
+}
+bool GC::disjoint_module::weak_alive(const weak_slot &slot)
+{
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+	return slot.target != nullptr;
+}
+void GC::disjoint_module::weak_alive(const weak_slot *const *slots, std::size_t count, bool *alive)
+{
+	if (count == 0) return;
+
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+		// the slot is protected by the mutex of the disjunction it was bound in, so anything else is a disjunction violation
+		if (slots[i]->disjunction && slots[i]->disjunction != this)
+		{
+			throw GC::disjunction_error("attempt to access weak reference outside of the current disjunction");
+		}
+
+		#endif
+
+		alive[i] = slots[i]->target != nullptr;
+	}
+}
+void GC::disjoint_module::weak_acquire(const weak_slot *const *slots, std::size_t count, info **targets)
+{
+	if (count == 0) return;
+
+	std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+
+	// check them all up front so that a violation doesn't leave some of the arcs acquired
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (slots[i]->disjunction && slots[i]->disjunction != this)
+		{
+			throw GC::disjunction_error("attempt to access weak reference outside of the current disjunction");
+		}
+	}
+
+	#endif
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		// increment the target reference count - the target could be unreachable (but not yet swept), so it needs the write barrier
+		if ((targets[i] = slots[i]->target))
+		{
+			++targets[i]->ref_count;
+			__raw_arc_barrier(targets[i]);
+		}
+	}
+}
+
 std::size_t GC::disjoint_module::begin_ignore_collect()
 {
 	std::lock_guard<std::mutex> internal_lock(internal_mutex);
@@ -619,6 +1171,68 @@ void GC::disjoint_module::end_ignore_collect()
 	--ignore_collect_count;
 }
 
+std::size_t GC::disjoint_module::begin_epoch_guard()
+{
+	std::lock_guard<std::mutex> epoch_lock(epoch_mutex);
+	++epoch_guards[epoch_phase];
+	return epoch_phase;
+}
+void GC::disjoint_module::end_epoch_guard(std::size_t phase)
+{
+	// the objects to release - these are destroyed after the mutex is unlocked (releasing them calls arbitrary code)
+	std::vector<GC::ptr<void>> released;
+
+	{
+		std::lock_guard<std::mutex> epoch_lock(epoch_mutex);
+
+		assert(epoch_guards[phase] != 0);
+
+		// if this was the last guard in its phase, that phase has been drained
+		if (--epoch_guards[phase] == 0)
+		{
+			++epoch_drains[phase];
+
+			__epoch_collect_released(released);
+			__epoch_try_flip();
+		}
+	}
+}
+void GC::disjoint_module::retire(const GC::ptr<void> &obj)
+{
+	std::lock_guard<std::mutex> epoch_lock(epoch_mutex);
+
+	// if there are no active guards, no one could be viewing it - just let the reference go
+	if (epoch_guards[0] == 0 && epoch_guards[1] == 0) return;
+
+	// otherwise we need to wait for each phase with active guards to drain (once)
+	retired_objs.push_back({ obj, { epoch_drains[0] + (epoch_guards[0] != 0), epoch_drains[1] + (epoch_guards[1] != 0) } });
+
+	__epoch_try_flip();
+}
+
+void GC::disjoint_module::__epoch_try_flip()
+{
+	// new guards register under the current phase, so we need to switch phases for the current one to have a chance to drain.
+	// we can only do this if the other phase is empty (otherwise its drain would be delayed as well).
+	if (!retired_objs.empty() && epoch_guards[epoch_phase ^ 1] == 0) epoch_phase ^= 1;
+}
+void GC::disjoint_module::__epoch_collect_released(std::vector<GC::ptr<void>> &dest)
+{
+	// partition the safe-to-release objects to the end and move them out
+	auto released = std::partition(retired_objs.begin(), retired_objs.end(), [this](const retired_obj &r)
+	{
+		return epoch_drains[0] < r.wait_for[0] || epoch_drains[1] < r.wait_for[1];
+	});
+
+	// swap them out rather than copying so that erasing them doesn't release anything while the mutex is locked
+	for (auto i = released; i != retired_objs.end(); ++i)
+	{
+		dest.emplace_back();
+		dest.back().swap(i->obj);
+	}
+	retired_objs.erase(released, retired_objs.end());
+}
+
 void GC::disjoint_module::__schedule_handle_root(const smart_handle &handle)
 {
 	// if there's no collector thread, we MUST apply the change immediately
@@ -671,6 +1285,33 @@ void GC::disjoint_module::__raw_schedule_handle_repoint(smart_handle &handle, in
 	else handle_repoint_cache[&handle.raw] = target;
 }
 
+void GC::disjoint_module::__weak_expire(info *target)
+{
+	// most objects have no weak slots, so skip the lookup if there aren't any at all
+	if (weak_slots.empty()) return;
+
+	auto iter = weak_slots.find(target);
+	if (iter == weak_slots.end()) return;
+
+	for (weak_slot *slot = iter->second, *next; slot; slot = next)
+	{
+		next = slot->next;
+
+		slot->target = nullptr;
+		slot->next = nullptr;
+	}
+	weak_slots.erase(iter);
+}
+
+void GC::disjoint_module::__raw_arc_barrier(info *target)
+{
+	// we only need to do this during a collection action, and only for objects under gc consideration
+	if (target && collector_thread != std::thread::id() && objs_add_cache.find(target) == objs_add_cache.end())
+	{
+		raw_arc_barrier_cache.insert(target);
+	}
+}
+
 GC::info *GC::disjoint_module::__get_current_target(const smart_handle &handle)
 {
 	// find new_value's repoint target from the cache.
@@ -686,42 +1327,107 @@ void GC::disjoint_module::__MUST_BE_LAST_ref_count_dec(info *target, std::unique
 {
 	// decrement the reference count
 	// if it falls to zero we need to perform ref count deletion logic
-	if (target && --target->ref_count == 0)
+	if (target && --target->ref_count == 0 && __condemn(target))
 	{
-		// if it's in the obj add cache we can delete it immediately regardless of what's going on.
-		// this is because it being in the obj add cache means it's not in the obj list, and is thus not under gc consideration.
-		if (objs_add_cache.find(target) != objs_add_cache.end())
-		{
-			// remove it from the obj add cache
-			objs_add_cache.erase(target);
+		// unlock the mutex so we can call arbitrary code
+		internal_lock.unlock();
 
-			// unlock the mutex so we can call arbitrary code
-			internal_lock.unlock();
+		destroy_condemned(&target, 1);
+	}
+}
+bool GC::disjoint_module::__condemn(info *target)
+{
+	// it's being condemned, so it can no longer be revived through weak slots
+	__weak_expire(target);
 
-			target->destroy();
-			target->dealloc();
-		}
-		// otherwise we know it exists and isn't in the add cache, therefore it's in the obj list.
-		// if we're not suppoed to cache ref count deletions, handle it immediately
-		else if (!cache_ref_count_del_actions)
+	// if it's in the obj add cache, it's not under gc consideration, but we still can't delete it yet.
+	// handles created during this collection action may still hold it as their raw value (their repoints are cached) and the collector could route to them.
+	// so we leave it in the obj add cache - the collector deletes zero reference count objects when it applies the cache.
+	if (objs_add_cache.find(target) != objs_add_cache.end()) return false;
+
+	// otherwise we know it exists and isn't in the add cache, therefore it's in the obj list.
+	// if we're supposed to cache ref count deletions, the collector handles it (this also implies we're in a collection action).
+	if (cache_ref_count_del_actions)
+	{
+		assert(collector_thread != std::thread::id());
+
+		ref_count_del_cache.insert(target);
+		return false;
+	}
+
+	// otherwise it's deleted immediately - remove it from the obj list.
+	// its arcs are now neither rooted nor reachable, so it needs to pin them before its destructor runs (see destroy_condemned()).
+	objs.remove(target);
+	++unpinned_count;
+	return true;
+}
+void GC::disjoint_module::destroy_condemned(info *const *targets, std::size_t count)
+{
+	// where the router functions below put the arcs they find (they can't capture).
+	// these are plain pointers rather than thread_local vectors, as this can run during thread exit (after those would have been destroyed).
+	static thread_local std::vector<const smart_handle*> *routed_handles;
+	static thread_local std::vector<info*> *routed_arcs;
+
+	std::vector<const smart_handle*> handles;
+	std::vector<info*> arcs, pins, condemned, next;
+
+	// releasing the pins can condemn more objects, so this goes in rounds.
+	// this is iterative rather than recursive so that tearing down long chains of objects can't overflow the stack.
+	while (count != 0)
+	{
+		// gather their arcs - nothing else can get to these objects anymore, so no lock is needed
+		routed_handles = &handles;
+		routed_arcs = &arcs;
+		for (std::size_t i = 0; i < count; ++i) targets[i]->route(router_fn(+[](const smart_handle &arc) { routed_handles->push_back(&arc); },
+			+[](info *const *span, std::size_t n) { routed_arcs->insert(routed_arcs->end(), span, span + n); }));
+
+		// pin the targets of all the arcs before running any destructors, as a destructor could start a collection (which waits on unpinned objects).
+		// most objects have no arcs at all, in which case there's nothing to pin and we don't need the lock.
+		pins.clear();
+		if (handles.empty() && arcs.empty()) unpinned_count -= count;
+		else
 		{
-			// remove it from the obj list
-			objs.remove(target);
-			
-			// unlock the mutex so we can call arbitrary code
-			internal_lock.unlock();
+			std::lock_guard<std::mutex> internal_lock(internal_mutex);
 
-			target->destroy();
-			target->dealloc();
+			// the handles may have cached repoints, so we need their current targets
+			for (const smart_handle *handle : handles) if (info *target = __get_current_target(*handle)) pins.push_back(target);
+			for (info *target : arcs) if (target) pins.push_back(target);
+
+			// a collection could already be past these objects' arcs, so the pins need the write barrier
+			for (info *target : pins)
+			{
+				++target->ref_count;
+				++pinned_objs[target];
+				__raw_arc_barrier(target);
+			}
+
+			unpinned_count -= count;
 		}
-		// otherwise we're supposed to cache the ref count deletion action.
-		// this also implies we're in a collection action.
-		else
+		handles.clear();
+		arcs.clear();
+
+		for (std::size_t i = 0; i < count; ++i) targets[i]->destroy();
+
+		// now that the destructors are done, release the pins
+		next.clear();
+		if (!pins.empty())
 		{
-			assert(collector_thread != std::thread::id());
+			std::lock_guard<std::mutex> internal_lock(internal_mutex);
 
-			ref_count_del_cache.insert(target);
+			for (info *target : pins)
+			{
+				auto pin = pinned_objs.find(target);
+				if (--pin->second == 0) pinned_objs.erase(pin);
+
+				if (--target->ref_count == 0 && __condemn(target)) next.push_back(target);
+			}
 		}
+
+		for (std::size_t i = 0; i < count; ++i) targets[i]->dealloc();
+
+		condemned.swap(next);
+		targets = condemned.data();
+		count = condemned.size();
 	}
 }
 
@@ -736,6 +1442,7 @@ GC::inherit_disjunction_t GC::inherit_disjunction;
 GC::new_disjunction_t GC::new_disjunction;
 
 GC::disjoint_module *GC::disjoint_module::local_detour = nullptr;
+thread_local GC::disjoint_module *GC::disjoint_module::teardown_detour = nullptr;
 
 const GC::shared_disjoint_handle &GC::disjoint_module::primary_handle()
 {
@@ -760,6 +1467,10 @@ const GC::shared_disjoint_handle &GC::disjoint_module::primary_handle()
 
 		~primary_handle_t()
 		{
+			// stop the background collector and make sure all the severed disjunctions have been destroyed.
+			// this must come before the detour so that the teardowns can take their own detours.
+			disjoint_module_container::get().shutdown();
+
 			// because this happens at static dtor time, all thread_local objects have been destroyed already - including the local handle.
 			// thus accesses to the local handle will result in und memory accesses.
 			// set up the local detour to bypass the local handle and instead go to the primary module - which is still alive.
@@ -811,6 +1522,9 @@ GC::disjoint_module *GC::disjoint_module::primary()
 }
 GC::disjoint_module *GC::disjoint_module::local()
 {
+	// if we're tearing down a disjunction, that takes precedence over everything
+	if (disjoint_module *teardown = teardown_detour) return teardown;
+
 	// get the local detour
 	disjoint_module *detour = local_detour;
 
@@ -844,6 +1558,9 @@ void GC::disjoint_module_container::BACKGROUND_COLLECTOR_ONLY___collect(bool col
 	{
 		std::lock_guard<std::mutex> internal_lock(internal_mutex);
 
+		// if we're in the static dtors the local handles are gone - we can't collect anything
+		if (shutting_down) return;
+
 		// we should not already be collecting (this is background collector only)
 		assert(!collecting);
 
@@ -902,6 +1619,94 @@ void GC::disjoint_module_container::BACKGROUND_COLLECTOR_ONLY___collect(bool col
 		// apply all the cached disjunction insertions
 		disjunctions.splice(disjunctions.begin(), disjunction_add_cache);
 		disjunction_add_cache.clear(); // just to be sure
+
+		// alert anyone waiting for the collection pass to finish
+		background_cv.notify_all();
+	}
+}
+void GC::disjoint_module_container::BACKGROUND_COLLECTOR_ONLY___wait_until(std::chrono::steady_clock::time_point time)
+{
+	std::unique_lock<std::mutex> internal_lock(internal_mutex);
+
+	// sleep until the time point, waking up to handle any teardowns that get scheduled in the meantime
+	while (background_cv.wait_until(internal_lock, time, [this] { return !teardown_queue.empty(); }))
+	{
+		while (__teardown_one(internal_lock));
+	}
+}
+
+void GC::disjoint_module_container::teardown(handle_data *data)
+{
+	disjoint_module *const module = data->get();
+
+	// detour the calling thread's local disjunction to the dying module
+	disjoint_module *const prev_detour = std::exchange(disjoint_module::teardown_detour, module);
+
+	module->blocking_collect(); // perform one final collection to make sure everything's collected
+	module->~disjoint_module(); // then destroy the module itself - its dtor asserts that all objects were collected
+
+	disjoint_module::teardown_detour = prev_detour;
+
+	// release the weak reference we held for the duration of the teardown (deletes the data block if it was the last one)
+	handle_data::release_weak(data);
+}
+bool GC::disjoint_module_container::__teardown_one(std::unique_lock<std::mutex> &internal_lock)
+{
+	if (teardown_queue.empty()) return false;
+
+	// take ownership of the last entry
+	handle_data *const data = teardown_queue.back();
+	teardown_queue.pop_back();
+	++teardowns_in_progress;
+
+	// tear it down without holding the lock (this calls arbitrary code)
+	internal_lock.unlock();
+	try { teardown(data); }
+	catch (...) { internal_lock.lock(); --teardowns_in_progress; background_cv.notify_all(); throw; }
+	internal_lock.lock();
+
+	// mark that we're done and alert anyone waiting for teardowns to finish
+	--teardowns_in_progress;
+	background_cv.notify_all();
+
+	return true;
+}
+
+void GC::disjoint_module_container::schedule_teardown(handle_data *data)
+{
+	bool handed_off;
+
+	{
+		std::lock_guard<std::mutex> internal_lock(internal_mutex);
+
+		// unless we're in the static dtors, hand it off to the background collector
+		if ((handed_off = !shutting_down))
+		{
+			teardown_queue.push_back(data);
+			background_cv.notify_all();
+		}
+	}
+
+	// make sure the background collector exists to handle the request
+	if (handed_off) GC::start_timed_collect();
+	// otherwise the background collector can't be relied upon - do it ourselves
+	else teardown(data);
+}
+void GC::disjoint_module_container::shutdown()
+{
+	std::unique_lock<std::mutex> internal_lock(internal_mutex);
+
+	// prevent any further background collection passes
+	shutting_down = true;
+
+	while (true)
+	{
+		// do any pending teardowns ourselves
+		if (__teardown_one(internal_lock)) continue;
+
+		// if the background collector is in the middle of something, wait for it (or for more teardowns to show up)
+		if (teardowns_in_progress != 0 || collecting) background_cv.wait(internal_lock);
+		else break;
 	}
 }
 
@@ -945,6 +1750,36 @@ GC::handle_data::tag_t GC::handle_data::tag_sub(tag_t v, std::memory_order order
 
 	return prev;
 }
+GC::handle_data::tag_t GC::handle_data::tag_strong_to_weak(std::memory_order order)
+{
+	// adding (weak_1 - strong_1) drops a strong ref and adds a weak ref in a single atomic step (no borrow so long as strong > 0)
+	const auto prev = tag.fetch_add(weak_1 - strong_1, order);
+
+	#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_HANDLE_DATA_UND_SAFETY
+
+	const auto cur = prev + (weak_1 - strong_1); // compute current value from previous
+
+	// make sure we had a strong ref to convert and didn't overflow the weak field
+	assert((prev & strong_mask) != 0);
+	assert((cur & weak_mask) > (prev & weak_mask));
+	assert((cur & lock_mask) == (prev & lock_mask));
+
+	#endif
+
+	return prev;
+}
+
+void GC::handle_data::release_weak(handle_data *data)
+{
+	// drop a weak ref and get the previous tag
+	auto prev = data->tag_sub(weak_1, std::memory_order_acq_rel);
+
+	// if we were the last weak ref and there were no strong refs, the module is already destroyed and the data block needs to be deleted.
+	// the module can't be mid-destruction because the teardown logic holds its own weak ref until the module is destroyed.
+	// being the last weak ref implies there are no locks at the moment because without unsynchronized read/write to the same variable from several threads that's impossible.
+	// therefore we don't need to bother about strong vs. non-lock strong references in this context because strong == non-lock strong
+	if ((prev & weak_mask) == weak_1 && (prev & strong_mask) == 0) delete data;
+}
 
 // ------------------------------- //
 
@@ -960,24 +1795,20 @@ void GC::shared_disjoint_handle::reset(handle_data *other)
 	// if we pointed at something
 	if (data)
 	{
-		// drop a strong reference and get the previous tag
-		auto prev = data->tag_sub(handle_data::strong_1, std::memory_order_acq_rel);
+		// exchange our strong reference for a weak one and get the previous tag.
+		// this must be a single atomic step - otherwise the data block could be deleted out from under us in the meantime.
+		auto prev = data->tag_strong_to_weak(std::memory_order_acq_rel);
 
-		// if we were the last strong reference, there are no longer any strong references - destroy the object
+		// if we were the last strong reference, there are no longer any strong references - the module must be destroyed.
 		// we include the lock strong refs because those locks succeeded - i.e. our very existence as a non-lock strong owner proves those locks succeeded.
-		if ((prev & handle_data::strong_mask) == handle_data::strong_1)
-		{
-			__module->blocking_collect(); // perform one final collection to make sure everything's collected
-			__module->~disjoint_module(); // then destroy the module itself - its dtor asserts that all objects were collected
-
-			// if there were also no more weak references, delete the handle
-			if ((prev & handle_data::weak_mask) == 0) delete data;
-			// otherwise we're not deleting it but the weak ref count might have fallen to zero in the meantime and could be waiting - alert that we're done destroying
-			else data->destroyed_flag.store(true, std::memory_order_release);
-		}
+		// the weak ref we now hold keeps the data block alive - hand it off to the teardown logic (normally the background collector).
+		// this means an exiting thread doesn't have to block on the final collection for its disjunction.
+		if ((prev & handle_data::strong_mask) == handle_data::strong_1) disjoint_module_container::get().schedule_teardown(data);
+		// otherwise we're not the last owner - just drop the weak ref we converted to
+		else handle_data::release_weak(data);
 	}
 
-	// repoint and test for null - must come after destruction logic to ensure the collection can potentially alias this handle
+	// repoint and test for null
 	data = other;
 	if (data)
 	{
@@ -1080,24 +1911,8 @@ void GC::weak_disjoint_handle::reset(handle_data *other)
 	// handle redundant assignment as no-op
 	if (data == other) return;
 
-	// if we pointed at something
-	if (data)
-	{
-		// drop a weak ref and get the previous tag
-		auto prev = data->tag_sub(handle_data::weak_1, std::memory_order_acq_rel);
-
-		// if we were the last weak ref and there were no strong refs, the object is already destroyed and needs to be deleted.
-		// being the last weak ref implies there are no locks at the moment because without unsynchronized read/write to the same variable from several threads that's impossible.
-		// therefore we don't need to bother about strong vs. non-lock strong references in this context because strong == non-lock strong
-		if ((prev & handle_data::weak_mask) == handle_data::weak_1 && (prev & handle_data::strong_mask) == 0)
-		{
-			// in this case the strong count fell to zero, so the object is potentially being destroyed by the strong ref count logic.
-			// however, that strong ref count logic won't delete the data block because our existence proves there was a weak reference prior to the strong ref dec logic.
-			// therefore we just need to wait until the object is destroyed so we can delete the data block
-			while (!data->destroyed_flag.load(std::memory_order_acquire));
-			delete data;
-		}
-	}
+	// if we pointed at something, drop our weak ref (deletes the data block if it was the last reference)
+	if (data) handle_data::release_weak(data);
 
 	// repoint - if non-null bump up weak ref count
 	data = other;
@@ -1216,8 +2031,8 @@ void GC::start_timed_collect()
 					// we'll run forever
 					while (true)
 					{
-						// sleep the sleep time
-						std::this_thread::sleep_for(sleep_time());
+						// sleep the sleep time - severed disjunctions are torn down as they come in during this time
+						disjoint_module_container::get().BACKGROUND_COLLECTOR_ONLY___wait_until(std::chrono::steady_clock::now() + sleep_time());
 
 						// if we're using timed strategy
 						if ((int)strategy() & (int)strategies::timed)
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <utility>
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include <atomic>
 #include <new>
 #include <type_traits>
@@ -68,11 +70,21 @@
 // e.g. if your program will only ever run on a single thread this can safely be disabled with no chance of violation.
 #define DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS 1
 
+// by default each GC::atomic_ptr (and std::atomic<GC::ptr>) embeds its own mutex, which is several times larger than the GC::ptr itself.
+// if this setting is nonzero, they instead use a mutex from a global striped table keyed by their address (as libstdc++ does for std::atomic<std::shared_ptr>).
+// this shrinks each atomic ptr down to the size of a GC::ptr, at the cost of (occasional) contention between unrelated atomic ptrs that share a stripe.
+#define DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS 0
+
 // the default type of lockable to use in wrappers.
 // i suggest you use some form of recursive mutex - otherwise e.g. a wrapped container's element type could collect under a lock and deadlock.
 // if you want some other type for a specific object, you should use the available template utilities instead of changing this globally.
 typedef std::recursive_mutex __gc_default_wrapper_lockable_t;
 
+// if this setting is nonzero, wrappers instead default to GC::compact_recursive_mutex (overriding the above).
+// this is a 1-byte lock (vs. e.g. 40 bytes for std::recursive_mutex), which can significantly reduce the size of small wrappers.
+// the cost is slower recursive locking and (under contention) parking on a global wait table shared by unrelated wrappers.
+#define DRAGAZO_GARBAGE_COLLECT_COMPACT_WRAPPER_LOCKS 0
+
 // -------------------------------- //
 
 // -- utility types forward decl -- //
@@ -121,6 +133,45 @@ class __gc_variant;
 template<typename T, typename Lockable>
 class __gc_optional;
 
+template<typename T, std::size_t N, typename Lockable>
+class __gc_small_vector;
+
+template<typename Key, typename T, typename Compare, typename Lockable>
+class __gc_flat_map;
+
+template<typename Key, typename T, typename Compare, typename Lockable>
+class __gc_btree_map;
+
+template<typename Key, typename Compare, typename Lockable>
+class __gc_btree_set;
+
+template<typename T, typename Lockable>
+class __gc_ring_buffer;
+
+template<typename V, typename Lockable>
+class __gc_csr_graph;
+
+template<typename T>
+class __gc_frozen;
+
+template<typename Fn, typename ...Captures>
+class __gc_closure;
+
+template<typename Sig, typename Lockable>
+class __gc_function;
+
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_concurrent_unordered_map;
+
+template<typename T>
+class __gc_concurrent_queue;
+
+template<typename Key, typename T, typename Hash, typename KeyEqual>
+class __gc_persistent_map;
+
+template<typename T>
+class __gc_persistent_vector;
+
 // ------------------------ //
 
 // -- garbage collection -- //
@@ -347,13 +398,25 @@ private: // -- private types -- //
 
 	public: // -- traversal utilities -- //
 
-		// marks this object and traverses to all routable targets for recursive marking.
+		// marks this object and traverses to all routable targets for marking (transitively, but without recursion).
 		// objects that have already been marked are skipped, so this is worst case O(n) in the number of existing objects.
 		void mark_sweep();
 	};
 
 	// used to select constructor paths that bind a new object
 	static struct bind_new_obj_t {} bind_new_obj;
+	// used to select constructor paths that alias the target of a raw arc (see ptr_vector)
+	static struct raw_arc_t {} raw_arc;
+
+	// a weak reference to a gc object - does not keep its target alive (see intern_table).
+	// when the target is condemned (its ref count falls to zero or the collector finds it unreachable) the slot expires (its target becomes null).
+	// all fields are protected by the internal_mutex of the disjunction the slot was bound in.
+	struct weak_slot
+	{
+		info *target = nullptr;                 // the referenced object (null if unbound or expired)
+		disjoint_module *disjunction = nullptr; // the disjunction the slot was bound in (null if never bound)
+		weak_slot *next = nullptr;              // the next slot bound to the same target
+	};
 
 	// represents a raw_handle_t value with encapsulated syncronization logic.
 	// you should not use raw_handle_t directly - use this instead.
@@ -385,6 +448,20 @@ private: // -- private types -- //
 			disjunction->schedule_handle_create_bind_new_obj(*this, init);
 		}
 
+		// initializes the info handle to alias target, which must be held by a raw arc (see ptr_vector), and marks it as a root.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the object is in a different disjunction.
+		smart_handle(info *target, raw_arc_t) : disjunction(disjoint_module::local())
+		{
+			disjunction->schedule_handle_create_raw_arc(*this, target);
+		}
+
+		// initializes the info handle to the target of slot (null if expired) and marks it as a root.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the slot is from a different disjunction.
+		explicit smart_handle(const weak_slot &slot) : disjunction(disjoint_module::local())
+		{
+			disjunction->schedule_handle_create_weak(*this, slot);
+		}
+
 	public: // -- ctor / dtor / asgn -- //
 
 		// initializes the info handle to null and marks it as a root.
@@ -450,13 +527,19 @@ private: // -- base router function -- //
 
 		void(*const func)(const smart_handle&); // raw function pointer to call
 
-		__base_router_fn(void(*_func)(const smart_handle&)) : func(_func) {}
+		// raw function pointer to call for a span of raw arcs (see ptr_vector).
+		// raw arcs are never roots, so this is null for router functions that only care about handles (e.g. unrooting).
+		void(*const span_func)(info *const*, std::size_t);
+
+		constexpr __base_router_fn(void(*_func)(const smart_handle&), void(*_span_func)(info *const*, std::size_t) = nullptr) : func(_func), span_func(_span_func) {}
 		__base_router_fn(std::nullptr_t) = delete;
 
 		~__base_router_fn() = default;
 
 		void operator()(const smart_handle &arg) { func(arg); }
 		void operator()(smart_handle&&) = delete; // for safety - ensures we can't call with an rvalue
+
+		void operator()(info *const *arcs, std::size_t count) { if (span_func) span_func(arcs, count); }
 	};
 
 public: // -- specific router function type definitions -- //
@@ -600,6 +683,19 @@ public: // -- ptr -- //
 		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the objects is in a different disjunction.
 		ptr(element_type *new_obj, info *new_handle, bind_new_obj_t) : obj(new_obj), handle(new_handle, GC::bind_new_obj) {}
 
+		// constructs a new ptr instance that aliases target, which must currently be held by a raw arc (see ptr_vector).
+		// for obj and target: both must either be null or non-null - mixing null/non-null is undefined behavior.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the object is in a different disjunction.
+		ptr(element_type *new_obj, info *target, raw_arc_t) : obj(new_obj), handle(target, GC::raw_arc) {}
+
+		// constructs a new ptr instance that references the target of slot, or null if it has expired (see weak_slot).
+		// the slot must have been bound to an object of type element_type.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the slot is from a different disjunction.
+		explicit ptr(const weak_slot &slot) : obj(nullptr), handle(slot)
+		{
+			if (info *target = handle.raw_handle()) obj = static_cast<element_type*>(target->obj);
+		}
+
 	public: // -- ctor / dtor / asgn -- //
 
 		// creates an empty ptr (null)
@@ -719,10 +815,24 @@ public: // -- ptr -- //
 
 		GC::ptr<T> value;
 
+		#if !DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS
 		mutable std::mutex mutex;
+		#endif
 
 		friend struct GC::router<atomic_ptr<T>>;
 
+	private: // -- helpers -- //
+
+		// gets the mutex that synchronizes access to this atomic ptr
+		std::mutex &get_mutex() const noexcept
+		{
+			#if DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS
+			return GC::atomic_ptr_stripe(this);
+			#else
+			return mutex;
+			#endif
+		}
+
 	public: // -- ctor / dtor / asgn -- //
 
 		atomic_ptr() = default;
@@ -742,12 +852,12 @@ public: // -- ptr -- //
 
 		void store(const GC::ptr<T> &desired)
 		{
-			std::lock_guard<std::mutex> lock(this->mutex);
+			std::lock_guard<std::mutex> lock(get_mutex());
 			value = desired;
 		}
 		GC::ptr<T> load() const
 		{
-			std::lock_guard<std::mutex> lock(this->mutex);
+			std::lock_guard<std::mutex> lock(get_mutex());
 			GC::ptr<T> ret = value;
 			return ret;
 		}
@@ -761,14 +871,60 @@ public: // -- ptr -- //
 
 		GC::ptr<T> exchange(const GC::ptr<T> &desired)
 		{
-			std::lock_guard<std::mutex> lock(this->mutex);
+			std::lock_guard<std::mutex> lock(get_mutex());
 
 			ptr<T> old = value;
 			value = desired;
 			return old;
 		}
 
-		// !! add compare exchange stuff !! //
+	public: // -- compare exchange -- //
+
+		// if the stored value refers to the same object as expected (as per ptr comparison), stores desired and returns true.
+		// otherwise loads the stored value into expected and returns false.
+		bool compare_exchange_strong(GC::ptr<T> &expected, const GC::ptr<T> &desired)
+		{
+			std::lock_guard<std::mutex> lock(get_mutex());
+
+			if (value == expected)
+			{
+				value = desired;
+				return true;
+			}
+			else
+			{
+				expected = value;
+				return false;
+			}
+		}
+		// as compare_exchange_strong() - this implementation never fails spuriously
+		bool compare_exchange_weak(GC::ptr<T> &expected, const GC::ptr<T> &desired)
+		{
+			return compare_exchange_strong(expected, desired);
+		}
+
+	public: // -- wait / notify -- //
+
+		// blocks until notified and the stored value no longer refers to the same object as old (as per ptr comparison).
+		// the comparison is done on the stored value directly - no ptr is constructed for it.
+		void wait(const GC::ptr<T> &old) const
+		{
+			GC::atomic_wait_stripe_t &stripe = GC::atomic_ptr_wait_stripe(this);
+			std::unique_lock<std::mutex> wait_lock(stripe.mutex);
+
+			// the notifiers lock the stripe mutex, so we can't miss a notification between the test and the wait
+			stripe.cv.wait(wait_lock, [&] { std::lock_guard<std::mutex> lock(get_mutex()); return value != old; });
+		}
+
+		// wakes up threads blocked in wait().
+		// waiters are woken via a condition variable shared by several atomic ptrs, so this always wakes every waiter on it (which re-test their condition).
+		void notify_one() noexcept { notify_all(); }
+		void notify_all() noexcept
+		{
+			GC::atomic_wait_stripe_t &stripe = GC::atomic_ptr_wait_stripe(this);
+			{ std::lock_guard<std::mutex> wait_lock(stripe.mutex); }
+			stripe.cv.notify_all();
+		}
 
 	public: // -- lock info -- //
 
@@ -782,13 +938,192 @@ public: // -- ptr -- //
 		{
 			if (this != &other)
 			{
-				std::scoped_lock locks(this->mutex, other.mutex);
-				value.swap(other.value);
+				std::mutex &a = get_mutex(), &b = other.get_mutex();
+
+				// with striped locks, two atomic ptrs can share the same mutex - in that case we can only lock it once
+				if (&a == &b)
+				{
+					std::lock_guard<std::mutex> lock(a);
+					value.swap(other.value);
+				}
+				else
+				{
+					std::scoped_lock locks(a, b);
+					value.swap(other.value);
+				}
 			}
 		}
 		friend void swap(atomic_ptr &a, atomic_ptr &b) { a.swap(b); }
 	};
 
+	// defines a gc ptr for read-mostly published values (read-copy-update).
+	// readers enter a read-side section (see reader) which grants raw access to the published object without any ref count or root work.
+	// writers publish a new value via store(), which blocks until no reader section can still be viewing the old value before releasing it to the gc.
+	// thus an rcu_ptr is intended for values that are read far more often than they are replaced.
+	// read-side sections must not publish to the same rcu_ptr (this would deadlock), but they may load() it.
+	template<typename T>
+	class rcu_ptr
+	{
+	public: // -- types -- //
+
+		// type of element stored
+		typedef GC::remove_unbound_extent_t<T> element_type;
+
+		// a read-side section on an rcu_ptr - the object that was published at construction time is guaranteed to be alive until it is destroyed.
+		// this is meant to be short-lived (writers block until all pre-existing readers are destroyed).
+		class reader
+		{
+		private: // -- data -- //
+
+			std::atomic<std::size_t> *counter; // the reader counter we registered with
+			element_type *obj;
+
+			friend class rcu_ptr;
+
+		private: // -- ctor / dtor / asgn -- //
+
+			// enters the read-side section - we must be visible to writers before we load the published value
+			explicit reader(const rcu_ptr &p) : counter(p.enter_read()), obj(p.current.load()) {}
+
+		public:
+
+			~reader() { counter->fetch_sub(1); }
+
+			reader(const reader&) = delete;
+			reader &operator=(const reader&) = delete;
+
+		public: // -- obj access -- //
+
+			// gets the object that was published when this section was entered (null if nothing was published)
+			element_type *get() const noexcept { return obj; }
+
+			template<typename J = T, std::enable_if_t<std::is_same<T, J>::value && !std::is_same<J, void>::value, int> = 0>
+			auto &operator*() const { return *get(); }
+			element_type *operator->() const noexcept { return get(); }
+
+			explicit operator bool() const noexcept { return get() != nullptr; }
+		};
+
+	private: // -- data -- //
+
+		// the number of reader counter stripes for each phase
+		static constexpr std::size_t reader_stripes = 8;
+
+		// a reader counter - each gets its own cache line so that readers on different threads don't contend
+		struct alignas(64) reader_counter { std::atomic<std::size_t> count{ 0 }; };
+
+		// the published value - this is the owning (gc) reference to the object.
+		// modified under value_mutex - the handle object itself never changes, so routing does not need to lock.
+		GC::ptr<T> value;
+
+		// the raw published object - this is what readers load
+		std::atomic<element_type*> current;
+
+		// the number of readers that entered during each phase, striped by thread.
+		// a reader registers with and unregisters from the same stripe, so each stripe drains on its own.
+		mutable reader_counter readers[2][reader_stripes];
+
+		// the phase new readers should register under
+		std::atomic<std::size_t> read_phase;
+
+		// serializes writers - this is held while waiting for readers to drain
+		mutable std::mutex writer_mutex;
+		// guards value - this is never held while waiting for readers, so readers can load() without deadlocking with a writer
+		mutable std::mutex value_mutex;
+
+		friend struct GC::router<rcu_ptr<T>>;
+
+	private: // -- helpers -- //
+
+		// registers a new reader under the current phase and returns the counter it registered with (which must be decremented to leave)
+		std::atomic<std::size_t> *enter_read() const noexcept
+		{
+			// each thread has its own address for this, so it picks the calling thread's stripe
+			static thread_local char stripe_tag;
+
+			std::atomic<std::size_t> *counter = &readers[read_phase.load()][GC::stripe_index(&stripe_tag, reader_stripes)].count;
+			counter->fetch_add(1);
+			return counter;
+		}
+
+		// waits until every reader section that could have seen the previously published value has ended.
+		// writer_mutex must be locked prior to invocation.
+		void __synchronize()
+		{
+			// a reader can load the phase before a flip but only register after it, so we need to flip and drain twice to cover both counters
+			for (int i = 0; i < 2; ++i)
+			{
+				std::size_t old_phase = read_phase.load();
+				read_phase.store(old_phase ^ 1);
+
+				for (const reader_counter &stripe : readers[old_phase])
+				{
+					while (stripe.count.load() != 0) std::this_thread::yield();
+				}
+			}
+		}
+
+	public: // -- ctor / dtor / asgn -- //
+
+		rcu_ptr(std::nullptr_t = nullptr) : value(nullptr), current(nullptr), read_phase(0) {}
+		rcu_ptr(const GC::ptr<T> &desired) : value(desired), current(desired.get()), read_phase(0) {}
+
+		rcu_ptr(const rcu_ptr&) = delete;
+		rcu_ptr &operator=(const rcu_ptr&) = delete;
+
+		rcu_ptr &operator=(const GC::ptr<T> &desired)
+		{
+			store(desired);
+			return *this;
+		}
+
+	public: // -- read -- //
+
+		// enters a read-side section on this rcu_ptr
+		[[nodiscard]]
+		reader read() const { return reader(*this); }
+
+	public: // -- store / load -- //
+
+		// publishes a new value and blocks until no reader can still be viewing the old one, at which point it's released to the gc
+		void store(const GC::ptr<T> &desired) { exchange(desired); }
+
+		// gets a (full) gc ptr to the published value - this is more expensive than read() but can outlive a read-side section
+		GC::ptr<T> load() const
+		{
+			std::lock_guard<std::mutex> lock(value_mutex);
+			GC::ptr<T> ret = value;
+			return ret;
+		}
+
+		operator GC::ptr<T>() const
+		{
+			return load();
+		}
+
+	public: // -- exchange -- //
+
+		// as store() but returns the previously-published value
+		GC::ptr<T> exchange(const GC::ptr<T> &desired)
+		{
+			std::lock_guard<std::mutex> lock(writer_mutex);
+
+			GC::ptr<T> old;
+			{
+				std::lock_guard<std::mutex> value_lock(value_mutex);
+				old = value;
+				value = desired;
+				current.store(desired.get());
+			}
+
+			// old is rooted, so the old object can't be collected until we're done with it.
+			// once all the old readers are gone, we can release it to the gc.
+			__synchronize();
+
+			return old;
+		}
+	};
+
 public: // -- ptr casting -- //
 
 	template<typename To, typename From, std::enable_if_t<std::is_convertible<From, To>::value || std::is_same<std::remove_cv_t<To>, std::remove_cv_t<From>>::value, int> = 0>
@@ -837,9 +1172,30 @@ public: // -- core router specializations -- //
 		{
 			// we avoid calling any gc functions by not actually using the load function - we just use the object directly.
 
+			#if DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS
+
+			// with striped locks we can't hold the stripe while routing - func could route to another atomic ptr on the same stripe (or a collector for a different disjunction could be routing in the opposite order).
+			// this is safe regardless because the handle object itself never changes - repointing it is synchronized by its disjunction (which caches repoints during a collection).
+			GC::route(atomic.value, func);
+
+			#else
+
 			std::lock_guard<std::mutex> lock(atomic.mutex);
 
 			GC::route(atomic.value, func);
+
+			#endif
+		}
+	};
+
+	// an appropriate specialization for rcu_ptr (does not use any calls to gc functions - see atomic_ptr)
+	template<typename T>
+	struct router<rcu_ptr<T>>
+	{
+		template<typename F> static void route(const rcu_ptr<T> &rcu, F func)
+		{
+			// the handle object itself never changes - repointing it is synchronized by its disjunction
+			GC::route(rcu.value, func);
 		}
 	};
 
@@ -1289,12 +1645,12 @@ public: // -- ptr allocation -- //
 
 		// -- do the garbage collection aspects -- //
 
-		// claim its children
-		handle->route(GC::router_unroot);
-
-		// create the ptr first - this roots obj
+		// create the ptr first - this roots obj and puts it under gc consideration
 		ptr<T> res(obj, handle, GC::bind_new_obj);
 
+		// claim its children - must come after binding obj, otherwise a collection in between could see the children as neither rooted nor reachable
+		handle->route(GC::router_unroot);
+
 		// begin timed collection (if it's not already)
 		GC::start_timed_collect();
 
@@ -1382,12 +1738,12 @@ public: // -- ptr allocation -- //
 		
 		// -- do the garbage collection aspects -- //
 
-		// claim its children
-		handle->route(GC::router_unroot);
-
-		// create the ptr first - this roots obj
+		// create the ptr first - this roots obj and puts it under gc consideration
 		ptr<T> res(reinterpret_cast<element_type*>(obj), handle, GC::bind_new_obj);
 
+		// claim its children - must come after binding obj, otherwise a collection in between could see the children as neither rooted nor reachable
+		handle->route(GC::router_unroot);
+
 		// begin timed collection (if it's not already)
 		GC::start_timed_collect();
 
@@ -1467,12 +1823,12 @@ public: // -- ptr allocation -- //
 
 		// -- do the garbage collection aspects -- //
 
-		// claim its children
-		handle->route(GC::router_unroot);
-
-		// create the ptr first - this roots obj
+		// create the ptr first - this roots obj and puts it under gc consideration
 		ptr<T> res(obj, handle, GC::bind_new_obj);
 
+		// claim its children - must come after binding obj, otherwise a collection in between could see the children as neither rooted nor reachable
+		handle->route(GC::router_unroot);
+
 		// begin timed collection (if it's not already)
 		GC::start_timed_collect();
 
@@ -1525,12 +1881,12 @@ public: // -- ptr allocation -- //
 
 		// -- do the garbage collection aspects -- //
 
-		// claim its children
-		handle->route(GC::router_unroot);
-
-		// create the ptr first - this roots obj
+		// create the ptr first - this roots obj and puts it under gc consideration
 		ptr<T[]> res(obj, handle, GC::bind_new_obj);
 
+		// claim its children - must come after binding obj, otherwise a collection in between could see the children as neither rooted nor reachable
+		handle->route(GC::router_unroot);
+
 		// begin timed collection (if it's not already)
 		GC::start_timed_collect();
 
@@ -1554,6 +1910,7 @@ public: // -- ptr allocation -- //
 	// triggers a full garbage collection pass.
 	// objects that are not in use will be deleted.
 	// objects that are in use will not be moved (i.e. pointers will still be valid).
+	// if another thread is already collecting, this is a no-op.
 	static void collect();
 
 public: // -- auto collection -- //
@@ -1583,10 +1940,130 @@ public: // -- auto collection -- //
 	static sleep_time_t sleep_time();
 	static void sleep_time(sleep_time_t new_sleep_time);
 
+public: // -- wrapper lockables -- //
+
+	// gets if Lockable supports shared locking (i.e. has lock_shared() and unlock_shared()).
+	template<typename Lockable, typename = void>
+	struct is_shared_lockable : std::false_type {};
+	template<typename Lockable>
+	struct is_shared_lockable<Lockable, std::void_t<decltype(std::declval<Lockable&>().lock_shared()), decltype(std::declval<Lockable&>().unlock_shared())>> : std::true_type {};
+
+	// the lock type used by wrapper routers for a given lockable.
+	// routers only read the wrapped object, so if the lockable supports shared locking a shared lock is used.
+	// this way concurrent routing (e.g. collections of separate disjunctions) doesn't serialize on the wrapper.
+	template<typename Lockable>
+	using router_lock_t = std::conditional_t<is_shared_lockable<Lockable>::value, std::shared_lock<Lockable>, std::lock_guard<Lockable>>;
+
+	// a recursive reader/writer mutex for use as a wrapper lockable (e.g. GC::unordered_map<K, V, H, E, A, GC::recursive_shared_mutex>).
+	// as with std::recursive_mutex, the thread that holds the exclusive lock may lock it again (exclusive or shared).
+	// shared locks may be taken recursively, but a thread holding only a shared lock must not request the exclusive lock (deadlock).
+	// shared lock requests are not blocked by waiting exclusive requests (reader preference) - this is what makes recursive shared locking safe.
+	class recursive_shared_mutex
+	{
+	private: // -- data -- //
+
+		std::mutex mutex;
+		std::condition_variable cv;
+
+		std::thread::id owner;        // the thread that holds the exclusive lock (none if not exclusively locked)
+		std::size_t owner_depth = 0;  // the number of exclusive locks held by owner
+		std::size_t readers = 0;      // the number of shared locks held (by any thread)
+
+	public: // -- ctor / dtor / asgn -- //
+
+		recursive_shared_mutex() = default;
+
+		recursive_shared_mutex(const recursive_shared_mutex&) = delete;
+		recursive_shared_mutex &operator=(const recursive_shared_mutex&) = delete;
+
+	public: // -- exclusive locking -- //
+
+		void lock();
+		bool try_lock();
+		void unlock();
+
+	public: // -- shared locking -- //
+
+		void lock_shared();
+		bool try_lock_shared();
+		void unlock_shared();
+	};
+
+	// a 1-byte recursive mutex for use as a wrapper lockable (e.g. GC::optional<GC::ptr<T>, GC::compact_recursive_mutex>).
+	// std::recursive_mutex is many times larger than this, which dominates the size of small wrappers (e.g. optional/variant).
+	// the lock itself is a single atomic byte - contended threads spin briefly and then park on a global striped wait table.
+	// recursion is tracked per thread (the compact mutexes a thread holds are kept in a thread_local list), so lock() is O(h) for h held compact mutexes.
+	// see DRAGAZO_GARBAGE_COLLECT_COMPACT_WRAPPER_LOCKS for making this the default wrapper lockable.
+	class compact_recursive_mutex
+	{
+	private: // -- data -- //
+
+		static constexpr std::uint8_t locked_bit = 1; // set while locked
+		static constexpr std::uint8_t parked_bit = 2; // set if there may be threads parked on the wait table for this mutex
+
+		std::atomic<std::uint8_t> state;
+
+	private: // -- held list -- //
+
+		// an entry in a thread's list of held compact mutexes
+		struct held_t
+		{
+			const compact_recursive_mutex *mutex;
+			std::size_t depth; // the number of times the thread has locked mutex
+		};
+
+		// the list of compact mutexes held by a thread.
+		// this is trivially destructible so that it remains usable after the thread_local dtors have run (e.g. for wrappers destroyed in static dtors).
+		struct held_list_t
+		{
+			held_t local[8];    // inline storage
+			held_t *extra;      // heap storage used once local fills up (freed once the thread holds no compact mutexes)
+			std::size_t extra_cap;
+			std::size_t size;
+
+			held_t *find(const compact_recursive_mutex *mutex) noexcept;
+			void reserve_one();                              // ensures there's room for a push()
+			void push(const compact_recursive_mutex *mutex) noexcept;
+			void erase(held_t *entry) noexcept;
+		};
+
+		static thread_local held_list_t held;
+
+		// acquires the lock (does not touch the held list)
+		void acquire() noexcept;
+
+	public: // -- ctor / dtor / asgn -- //
+
+		compact_recursive_mutex() noexcept : state(0) {}
+
+		compact_recursive_mutex(const compact_recursive_mutex&) = delete;
+		compact_recursive_mutex &operator=(const compact_recursive_mutex&) = delete;
+
+	public: // -- locking -- //
+
+		void lock();
+		bool try_lock();
+		void unlock();
+	};
+
+	// a lockable that does nothing - for wrappers that only one thread uses and whose contents are safe to route while that thread modifies them.
+	// e.g. GC::ring_buffer<GC::ptr<T>, GC::null_lockable> routes every slot rather than the live range, which is safe because assigning a GC::ptr is a handle repoint.
+	// with most other wrappers this is only safe if they're never modified while a collection could be routing them.
+	struct null_lockable
+	{
+		void lock() noexcept {}
+		bool try_lock() noexcept { return true; }
+		void unlock() noexcept {}
+	};
+
 public: // -- wrapper traits -- //
 
 	// the default lockable type to use for wrappers
+	#if DRAGAZO_GARBAGE_COLLECT_COMPACT_WRAPPER_LOCKS
+	typedef compact_recursive_mutex default_lockable_t;
+	#else
 	typedef __gc_default_wrapper_lockable_t default_lockable_t;
+	#endif
 
 	// given a type T, gets its wrapper traits, including the unwrapped and wrapped type equivalents.
 	// the wrapped type must be gc-ready with a properly-mutexed router function.
@@ -1687,775 +2164,5535 @@ public: // -- stdlib adapter aliases -- //
 	template<typename T, typename Container = std::vector<T>, typename Compare = std::less<typename Container::value_type>, typename _Lockable = default_lockable_t>
 	using priority_queue = std::priority_queue<T, make_wrapped_t<Container, _Lockable>, Compare>;
 
-public: // -- gc-specific threading stuff -- //
+public: // -- compact container aliases -- //
+
+	// a gc-ready vector that stores up to N elements inline (i.e. inside the vector object itself) before falling back to the heap.
+	// for small element counts (e.g. per-node child lists), this avoids a heap allocation and a pointer hop for both mutation and routing.
+	// moving a vector whose elements are inline moves the elements individually, so moves are O(n) for n <= N.
+	template<typename T, std::size_t N, typename _Lockable = default_lockable_t>
+	using small_vector = __gc_small_vector<T, N, _Lockable>;
+
+	// a gc-ready sorted map stored as contiguous (parallel) arrays of keys and values rather than a node-based tree.
+	// lookups are a binary search over the keys, and routing is a linear scan over the values, which is much more cache friendly than GC::map.
+	// single insertions/erasures are O(n), so this is intended for read-mostly maps - prefer the bulk insert for loading many entries.
+	template<typename Key, typename T, typename Compare = std::less<Key>, typename _Lockable = default_lockable_t>
+	using flat_map = __gc_flat_map<Key, T, Compare, _Lockable>;
+
+	// a gc-ready sorted map stored as a b+ tree with wide nodes - each leaf holds about 256 bytes of entries as parallel arrays of keys and values.
+	// compared to GC::map (a red-black tree with a node allocation per entry), lookups and ordered iteration touch far fewer cache lines and far less memory,
+	// and routing is a linear scan over each leaf's values along the leaf chain. unlike flat_map, single insertions/erasures are O(log n).
+	// iterators dereference to (key, value) pairs of references and are invalidated by any insertion or erasure.
+	template<typename Key, typename T, typename Compare = std::less<Key>, typename _Lockable = default_lockable_t>
+	using btree_map = __gc_btree_map<Key, T, Compare, _Lockable>;
+
+	// as btree_map, but for a sorted set of keys (the leaves only hold keys)
+	template<typename Key, typename Compare = std::less<Key>, typename _Lockable = default_lockable_t>
+	using btree_set = __gc_btree_set<Key, Compare, _Lockable>;
+
+	// a gc-ready fixed-capacity ring buffer (e.g. for keeping the last N messages of a stream).
+	// all the slots are allocated and constructed up front - pushing to a full buffer overwrites the oldest element in place, so pushing never allocates.
+	// only the live elements are routed. with GC::null_lockable as the lockable, the buffer takes no locks at all (single-thread use - see synchronized).
+	template<typename T, typename _Lockable = default_lockable_t>
+	using ring_buffer = __gc_ring_buffer<T, _Lockable>;
 
-	// specifies that the new thread should use the primary disjunction (i.e. the one created on initial program start - what the primary thread uses).
-	// this is what std::thread and any other os-specific threading utility uses (only because they can't be overridden in standard C++).
-	// you'll probably want to avoid using this option - inherit_disjunction is almost always the better, faster, safer choice.
-	static struct primary_disjunction_t {} primary_disjunction;
-	// specifies that the new thread should inherit its parent's disjunction.
-	static struct inherit_disjunction_t {} inherit_disjunction;
-	// specifies that the new thread should be in its own (new) disjunction.
-	static struct new_disjunction_t {} new_disjunction;
+	// a gc-ready static graph stored in compressed sparse row form: contiguous arrays of vertex payloads, per-vertex edge offsets, and edge targets.
+	// the whole graph is a single object whose router is a linear scan over the vertex payloads (the edges are plain indices and are never routed).
+	// the structure is built in bulk (see rebuild) - for large graphs this is far more compact, and much faster to mark, than per-vertex edge lists.
+	template<typename V, typename _Lockable = default_lockable_t>
+	using csr_graph = __gc_csr_graph<V, _Lockable>;
 
-	class thread
-	{
-	private: // -- data -- //
+public: // -- frozen container aliases -- //
 
-		std::thread t; // the wrapped thread
+	// a gc-ready immutable (frozen) T - e.g. GC::frozen<GC::vector<GC::ptr<int>>> holds a frozen std::vector<GC::ptr<int>>.
+	// the contents are stored in a gc object that is never modified after construction, so reading and routing them needs no lock.
+	// they also have no mutable arcs, so collections skip them in the initial unrooting pass.
+	// copies share the same contents. a frozen object itself (i.e. which contents it refers to) is NOT internally synchronized, as with GC::ptr.
+	template<typename T>
+	using frozen = __gc_frozen<make_unwrapped_t<T>>;
 
-	public: // -- typedefs -- //
+	// freezes obj (e.g. a GC::vector that is done being built) - obj is moved (or copied) into immutable storage.
+	// obj must not be accessed by any other thread during this call.
+	template<typename T>
+	static frozen<std::decay_t<T>> freeze(T &&obj)
+	{
+		typedef make_unwrapped_t<std::decay_t<T>> unwrapped_t;
+		return frozen<std::decay_t<T>>(std::in_place, unwrapped_t(std::forward<T>(obj)));
+	}
 
-		typedef std::thread::native_handle_type native_handle_type;
-		
-		typedef std::thread::id id;
+public: // -- callable aliases -- //
 
-	public: // -- ctor / dtor / asgn --//
+	// a gc-ready type-erased callable (like std::function) whose stored callable is routed.
+	// small callables (e.g. a closure over a couple gc pointers) are stored inline rather than on the heap.
+	// note that lambda captures can't be routed, so gc pointers they capture remain roots - use GC::closure for routed captures.
+	template<typename Sig, typename _Lockable = default_lockable_t>
+	using function = __gc_function<Sig, _Lockable>;
 
-		thread() noexcept = default;
-		~thread() = default;
+	// creates a callable that stores (routed) copies of captures - calling it with args calls fn(captures..., args...).
+	// e.g. GC::function<void(int)> f = GC::closure([](GC::ptr<node> &n, int v) { n->value = v; }, n);
+	// a closure is NOT internally synchronized (e.g. concurrently repointing its captures is fine, but reassigning it is not).
+	template<typename Fn, typename ...Captures>
+	static __gc_closure<std::decay_t<Fn>, std::decay_t<Captures>...> closure(Fn &&fn, Captures &&...captures)
+	{
+		return __gc_closure<std::decay_t<Fn>, std::decay_t<Captures>...>(std::in_place, std::forward<Fn>(fn), std::forward<Captures>(captures)...);
+	}
 
-		thread(thread &&other) noexcept : t(std::move(other.t)) {}
-		thread(std::thread &&other) noexcept : t(std::move(other)) {}
+public: // -- concurrent container aliases -- //
 
-		thread &operator=(thread &&other) noexcept { t = std::move(other.t); return *this; }
-		thread &operator=(std::thread &&other) noexcept { t = std::move(other); return *this; }
+	// a gc-ready hash map that is internally synchronized and split into independently-locked segments.
+	// mutators and the router only lock the segment(s) they're working on, so unrelated operations proceed in parallel.
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, typename Allocator = std::allocator<std::pair<const Key, T>>, typename _Lockable = default_lockable_t>
+	using concurrent_unordered_map = __gc_concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator, _Lockable>;
 
-		template<typename Function, typename ...Args>
-		explicit thread(primary_disjunction_t, Function &&f, Args &&...args) : t(std::forward<Function>(f), std::forward<Args>(args)...) {}
+	// a gc-ready bounded multi-producer multi-consumer queue of gc pointers (e.g. GC::concurrent_queue<GC::ptr<T>>).
+	// slot claiming is lock-free (a ring buffer with per-slot sequence numbers) and values are moved in/out by swapping (no ref count changes).
+	template<typename T>
+	using concurrent_queue = __gc_concurrent_queue<T>;
 
-		template<typename Function, typename ...Args>
-		explicit thread(inherit_disjunction_t, Function &&f, Args &&...args) : t([](shared_disjoint_handle &&parent_module, std::decay_t<Function> &&ff, std::decay_t<Args> &&...fargs)
-		{
-			// now that we're a new thread, repoint our local disjunction handle to our parent.
-			// the danger with non-primary/local shared handles is if the non-primary/local shared handle is the last to be destroyed.
-			// this isn't a problem in this case because we can move the non-primary/local handle (func arg) into the local handle slot.
-			disjoint_module::local_handle() = std::move(parent_module);
+public: // -- persistent container aliases -- //
 
-			// then invoke the user function
-			std::invoke(std::move(ff), std::move(fargs)...);
-
-		}, disjoint_module::local_handle(), std::forward<Function>(f), std::forward<Args>(args)...)
-		{}
-
-		template<typename Function, typename ...Args>
-		explicit thread(new_disjunction_t, Function &&f, Args &&...args) : t([](std::decay_t<Function> &&ff, std::decay_t<Args> &&...fargs)
-		{
-			// now that we're a new thread, repoint our local disjunction handle to a new disjunction
-			disjoint_module_container::get().create_new_disjunction(disjoint_module::local_handle());
-
-			// then invoke the user function
-			std::invoke(std::move(ff), std::move(fargs)...);
-
-		}, std::forward<Function>(f), std::forward<Args>(args)...)
-		{}
+	// a gc-ready persistent (immutable) hash map - a hash array mapped trie whose nodes are gc objects.
+	// updates return a new version of the map that shares structure with the old one - old versions are reclaimed by the gc when no longer referenced.
+	// nodes are immutable after construction, so they can be shared between threads freely (and their routers need no locks).
+	// the map object itself (i.e. its root) is NOT internally synchronized, as with GC::ptr.
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	using persistent_map = __gc_persistent_map<Key, T, Hash, KeyEqual>;
 
-	public: // -- observers -- //
+	// a gc-ready persistent (immutable) vector - a height-balanced rope of element chunks whose nodes are gc objects.
+	// push_back, set, slice and concat are O(log n) and return a new version that shares structure with the old one.
+	// bulk construction should go through persistent_vector<T>::transient, which builds the tree in O(n).
+	// as with persistent_map, nodes can be shared between threads freely, but the vector object itself is NOT internally synchronized.
+	template<typename T>
+	using persistent_vector = __gc_persistent_vector<T>;
 
-		bool joinable() const noexcept { return t.joinable(); }
+private: // -- ptr vector storage -- //
 
-		std::thread::id get_id() const noexcept { return t.get_id(); }
+	// the gc object that holds the elements of a ptr_vector.
+	// each element is a raw arc (i.e. an info* that holds a reference count but is not a handle).
+	// the collector sees them as a single span (see __base_router_fn) - raw arcs are never roots, so they need no unrooting.
+	template<typename T>
+	struct ptr_vector_block
+	{
+		std::vector<info*> arcs;          // the raw arcs (null for empty elements)
+		mutable default_lockable_t mutex; // router synchronizer
 
-		native_handle_type native_handle() { return t.native_handle(); }
+		ptr_vector_block() = default;
 
-		static unsigned int hardware_concurrency() noexcept { return std::thread::hardware_concurrency(); }
+		ptr_vector_block(const ptr_vector_block&) = delete;
+		ptr_vector_block &operator=(const ptr_vector_block&) = delete;
 
-	public: // -- operations -- //
+		~ptr_vector_block()
+		{
+			for (info *arc : arcs) if (arc) arc->disjunction->raw_arc_release(arc);
+		}
+	};
 
-		void join() { t.join(); }
+public: // -- ptr vector -- //
 
-		void detach() { t.detach(); }
+	// a compact, internally-synchronized vector of GC::ptr<T>.
+	// the elements are stored contiguously as plain object pointers in a single gc object, so the whole vector is one routable object.
+	// unlike GC::vector<GC::ptr<T>>, element insertion/removal does not create or destroy any handles (only reference counts change).
+	// each element must point to the start of its object (e.g. not to a member or a base at a non-zero offset).
+	// if EXTRA_UND_CHECKS is enabled, violating this throws std::invalid_argument.
+	template<typename T>
+	class ptr_vector
+	{
+		static_assert(!std::is_array<T>::value, "ptr_vector does not support array elements");
 
-		void swap(thread &other) noexcept { t.swap(other.t); }
-		void swap(std::thread &other) noexcept { t.swap(other); }
+	public: // -- types -- //
 
-		friend void swap(thread &a, thread &b) noexcept { using std::swap; swap(a.t, b.t); }
-		friend void swap(thread &a, std::thread &b) noexcept { using std::swap; swap(a.t, b); }
-		friend void swap(std::thread &a, thread &b) noexcept { using std::swap; swap(a, b.t); }
-	};
+		typedef GC::ptr<T> value_type;
+		typedef T element_type;
 
-public: // -- collection logic utilities -- //
+		typedef std::size_t size_type;
 
-	// a sentry object that controls the ignore feature of GC::collect().
-	// on construction, begins an ignore action; on destruction ends it.
-	// while this object exists, calls to GC::collect() from any thread bound to the same disjoint gc module will be ignored.
-	// this is typically only used for preventing deadlock situations caused by calling GC::collect() while a router mutex is held.
-	class ignore_collect_sentry
-	{
 	private: // -- data -- //
 
-		std::size_t prev_count;
+		// the gc object holding the elements.
+		// this is the only handle the ptr_vector has - it is only repointed by move/swap (synchronized by its disjunction like any other ptr).
+		GC::ptr<ptr_vector_block<T>> block;
 
-		// the disjunction this object was constructed in.
-		// must be used for disjoint utility functions involving this object.
-		disjoint_module *const disjunction;
+		friend struct GC::router<ptr_vector>;
 
-	public: // -- ctor / dtor / asgn -- //
+	private: // -- helpers -- //
 
-		ignore_collect_sentry() : disjunction(disjoint_module::local()) { prev_count = disjunction->begin_ignore_collect(); }
-		~ignore_collect_sentry() { disjunction->end_ignore_collect(); }
+		// acquires a raw arc to value's object for storage in this vector (null if value is null).
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the object is in a different disjunction.
+		info *acquire(const GC::ptr<T> &value)
+		{
+			info *arc = block.handle.disjunction->raw_arc_acquire(value.handle);
 
-		// returns true iff there were no ignore actions in progress prior to the start of this one.
-		bool no_prev_ignores() const noexcept { return prev_count == 0; }
-	};
+			#if DRAGAZO_GARBAGE_COLLECT_EXTRA_UND_CHECKS
 
-private: // -- containers -- //
+			if (arc && static_cast<const volatile void*>(value.get()) != arc->obj)
+			{
+				release(arc);
+				throw std::invalid_argument("ptr_vector elements must point to the start of their object");
+			}
 
-	// a container of info objects - implemented as a doubly-linked list for fast removal from the middle.
-	// this container has no internal synchronization and is thus not thread safe.
-	class obj_list
-	{
-	private: // -- data -- //
+			#endif
 
-		info *first; // pointer to the first object
-		info *last;  // pointer to the last object
+			return arc;
+		}
+		// releases raw arcs that are being taken out of this vector (allowed to be null) - see raw_arc_detach().
+		// the block's mutex must be locked - returns how many of them (moved to the front) must be destroyed once it's unlocked.
+		std::size_t detach(info **arcs, std::size_t count)
+		{
+			return block.handle.disjunction->raw_arc_detach(arcs, count);
+		}
+		// destroys the first count arcs from a call to detach().
+		// this can call arbitrary code (destructors) and thus should not be called while the block's mutex is locked.
+		void destroy(info *const *arcs, std::size_t count)
+		{
+			block.handle.disjunction->raw_arc_destroy(arcs, count);
+		}
+		// releases a raw arc that was taken out of this vector (allowed to be null).
+		// this can call arbitrary code (destructors) and thus should not be called while the block's mutex is locked.
+		void release(info *arc)
+		{
+			if (arc) block.handle.disjunction->raw_arc_release(arc);
+		}
+
+		// creates a gc ptr to the object referenced by arc (allowed to be null).
+		// the block's mutex must be locked (arc must still be held).
+		static GC::ptr<T> alias(info *arc)
+		{
+			return arc ? GC::ptr<T>(static_cast<T*>(arc->obj), arc, GC::raw_arc) : GC::ptr<T>();
+		}
 
 	public: // -- ctor / dtor / asgn -- //
 
-		// creates an empty obj list
-		obj_list();
+		// creates an empty vector
+		ptr_vector() : block(GC::make<ptr_vector_block<T>>()) {}
 
-		// destroys the container but does not release resources - see unsafe_clear()
-		~obj_list() = default;
+		// creates a vector with count null elements
+		explicit ptr_vector(size_type count) : ptr_vector() { resize(count); }
 
-		obj_list(const obj_list&) = delete;
-		obj_list &operator=(const obj_list&) = delete;
+		ptr_vector(std::initializer_list<GC::ptr<T>> ilist) : ptr_vector()
+		{
+			reserve(ilist.size());
+			for (const GC::ptr<T> &value : ilist) push_back(value);
+		}
 
-	public: // -- access -- //
+		ptr_vector(const ptr_vector &other) : ptr_vector()
+		{
+			// acquire our own arcs to other's elements.
+			// they need to be in our block before other's is unlocked, otherwise other could drop them while they're only held by us (see raw_arc_detach()).
+			// our block is new and routing a block doesn't lock anything else, so nobody can be holding its lock while waiting on other's.
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			std::lock_guard<default_lockable_t> other_lock(other.block->mutex);
+
+			// if acquiring one throws, the block releases the ones we've already acquired
+			block->arcs.reserve(other.block->arcs.size());
+			for (info *arc : other.block->arcs)
+			{
+				block.handle.disjunction->raw_arc_acquire(arc);
+				block->arcs.push_back(arc);
+			}
+		}
+		// move constructs a vector - other is left empty
+		ptr_vector(ptr_vector &&other) : ptr_vector() { swap(other); }
 
-		// gets the first info object - null if there is none.
-		// this is supplied for enabling iteration - any non-null value is a valid node.
-		info *front() const { return first; }
+		ptr_vector &operator=(const ptr_vector &other)
+		{
+			if (this != &other)
+			{
+				ptr_vector temp(other);
+				swap(temp);
+			}
+			return *this;
+		}
+		ptr_vector &operator=(ptr_vector &&other)
+		{
+			swap(other);
+			return *this;
+		}
 
-		// adds obj to this database - und. if obj already belongs to one or more databases.
-		void add(info *obj);
-		// removes obj from this database - und. if obj does not belong to this database.
-		void remove(info *obj);
+	public: // -- capacity -- //
 
-		// merges the contents of other with the contents of this.
-		// if other refers to this object, does nothing.
-		// otherwise, other is guaranteed to be empty after this operation.
-		void merge(obj_list &&other);
+		size_type size() const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			return block->arcs.size();
+		}
+		bool empty() const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			return block->arcs.empty();
+		}
 
-		// sets the contents of the list to empty without deallocating resources.
-		// this should only be used if you're handling resource deallocation yourself.
-		void unsafe_clear() { first = last = nullptr; }
+		size_type capacity() const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			return block->arcs.capacity();
+		}
+		void reserve(size_type new_cap)
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			block->arcs.reserve(new_cap);
+		}
 
-		// returns true iff the container is empty
-		bool empty() const noexcept { return !first; }
+	public: // -- element access -- //
 
-		// returns true iff obj is contained in this list.
-		// this is O(n) and for efficiency reasons should only be used in debug code.
-		bool contains(info *obj) const noexcept;
-	};
+		// gets the raw object pointer at the specified index (null for a null element).
+		// the pointer is only valid for as long as the object is kept alive (e.g. by remaining in this vector).
+		element_type *operator[](size_type pos) const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			info *arc = block->arcs[pos];
+			return arc ? static_cast<element_type*>(arc->obj) : nullptr;
+		}
 
-private: // -- sentries -- //
+		// gets a gc ptr to the element at the specified index
+		GC::ptr<T> get(size_type pos) const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			return alias(block->arcs[pos]);
+		}
+		// as get() but throws std::out_of_range if pos is not a valid index
+		GC::ptr<T> at(size_type pos) const
+		{
+			std::lock_guard<default_lockable_t> lock(block->mutex);
+			if (pos >= block->arcs.size()) throw std::out_of_range("ptr_vector index out of range");
+			return alias(block->arcs[pos]);
+		}
 
-	// a sentry for an atomic flag.
-	// on construction, sets the flag and gets the previous value; on destruction, clears the flag if it was successfully taken.
-	// conversion of the sentry to bool gets if the flag was successfully taken (i.e. if it was previously false)
-	struct atomic_flag_sentry
-	{
-	private: // -- data -- //
+	public: // -- modifiers -- //
 
-		std::atomic_flag &_flag;
-		bool _value;
+		// repoints the element at the specified index to value's object
+		void set(size_type pos, const GC::ptr<T> &value)
+		{
+			info *arc = acquire(value), *old;
+			std::size_t dead;
+			try
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				old = block->arcs[pos];
+				dead = detach(&old, 1);
+				block->arcs[pos] = arc;
+			}
+			catch (...) { release(arc); throw; }
+			destroy(&old, dead);
+		}
 
-	public: // -- interface -- //
+		void push_back(const GC::ptr<T> &value)
+		{
+			info *arc = acquire(value);
+			try
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				block->arcs.push_back(arc);
+			}
+			catch (...) { release(arc); throw; }
+		}
+		void pop_back()
+		{
+			info *old;
+			std::size_t dead;
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				old = block->arcs.back();
+				dead = detach(&old, 1);
+				block->arcs.pop_back();
+			}
+			destroy(&old, dead);
+		}
 
-		explicit atomic_flag_sentry(std::atomic_flag &flag) : _flag(flag)
+		// removes the element at the specified index
+		void erase(size_type pos) { erase(pos, pos + 1); }
+		// removes the elements in the index range [first, last)
+		void erase(size_type first, size_type last)
 		{
-			_value = _flag.test_and_set();
+			std::vector<info*> old;
+			std::size_t dead;
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				old.assign(block->arcs.begin() + first, block->arcs.begin() + last);
+				dead = detach(old.data(), old.size());
+				block->arcs.erase(block->arcs.begin() + first, block->arcs.begin() + last);
+			}
+			destroy(old.data(), dead);
 		}
-		~atomic_flag_sentry()
+
+		// resizes the vector to count elements - new elements are null
+		void resize(size_type count)
 		{
-			if (!_value) _flag.clear();
+			std::vector<info*> old;
+			std::size_t dead;
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				if (count < block->arcs.size()) old.assign(block->arcs.begin() + count, block->arcs.end());
+				dead = detach(old.data(), old.size());
+				block->arcs.resize(count, nullptr);
+			}
+			destroy(old.data(), dead);
 		}
 
-		explicit operator bool() const noexcept { return !_value; }
-		bool operator!() const noexcept { return _value; }
+		void clear()
+		{
+			std::vector<info*> old;
+			std::size_t dead;
+			{
+				std::lock_guard<default_lockable_t> lock(block->mutex);
+				old.swap(block->arcs);
+				dead = detach(old.data(), old.size());
+			}
+			destroy(old.data(), dead);
+		}
+
+		void swap(ptr_vector &other) { block.swap(other.block); }
+		friend void swap(ptr_vector &a, ptr_vector &b) { a.swap(b); }
 	};
 
-private: // -- gc disjoint module -- //
+	// routes a message directed at a ptr_vector block to its raw arcs as a single span
+	template<typename T>
+	struct router<ptr_vector_block<T>>
+	{
+		template<typename F> static void route(const ptr_vector_block<T> &block, F func)
+		{
+			GC::router_lock_t<default_lockable_t> lock(block.mutex);
+			func(block.arcs.data(), block.arcs.size());
+		}
+	};
 
-	class shared_disjoint_handle;
-	class weak_disjoint_handle;
+	// routes a message directed at a ptr_vector to its block
+	template<typename T>
+	struct router<ptr_vector<T>>
+	{
+		template<typename F> static void route(const ptr_vector<T> &vec, F func) { GC::route(vec.block, func); }
+	};
 
-	// provides the gc logic for all objects from a single disjunction.
-	// i.e. all objects and GC::ptr info from the set of all threads that can share gc objects with one another.
-	// it is undefined behavior to point to or access a gc object from a different disjunction.
-	class disjoint_module
+public: // -- intern table -- //
+
+	// a hash-consing table of immutable gc objects - interning equal values yields the same (canonical) GC::ptr<const T>.
+	// the table only holds weak references to its objects (see weak_slot), so it never keeps an interned object alive.
+	// when an interned object is reclaimed (by reference counting or by a collection) its entry expires and is purged lazily.
+	// the table is internally-synchronized, but all its objects are created in (and must be used from) the disjunction it is used in.
+	// the table must not outlive that disjunction.
+	// if DISJUNCTION_SAFETY_CHECKS are enabled, using the table from a different disjunction throws GC::disjunction_error.
+	template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+	class intern_table
 	{
-	private: // -- synchronization -- //
+		static_assert(!std::is_array<T>::value, "intern_table does not support array elements");
+		static_assert(std::is_same<T, std::remove_cv_t<T>>::value, "intern_table element type must not be cv-qualified");
 
-		std::mutex internal_mutex; // mutex used only for internal synchronization
+	public: // -- types -- //
 
-		std::thread::id collector_thread; // the thread id of the collector - none implies no collection is currently processing
+		typedef T value_type;
+		typedef GC::ptr<const T> pointer;
 
-		std::size_t ignore_collect_count = 0; // the number of sources requesting collect actions to be ignored for this module
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
 
-	private: // -- collector-only resources -- //
+		typedef std::size_t size_type;
 
-		// these objects represent a snapshot of the object graph for use by the collector.
-		// the current collector thread need not lock any mutex to use these resources.
-		// if you LOCK internal_mutex and find there's NO current collection action, you can modify them.
-		
-		// the list of all objects currently under gc consideration.
-		// during a collection action, any unreachable object in this list is subject to deletion.
-		obj_list objs;
+	private: // -- data -- //
 
-		// the set of all rooted handles - DO NOT USE THIS FOR COLLECTION LOGIC.
-		// the roots in this set are subject to deletion by arbitrary running threads after the sentry construction.
-		// instead, you should use root_objs, which is guaranteed to be safe during the full collection action.
-		// note: a root is the address of an info* (i.e. info**) not the info* itself.
-		// this is because the same rooted handle can be repointed to a different object and still be a root.
-		// this is what supplies information to the root_objs set for the collector.
-		std::unordered_set<info*const*> roots;
+		// unbinds a slot (if it was ever bound) before deleting it
+		struct slot_deleter
+		{
+			void operator()(weak_slot *slot) const
+			{
+				if (slot->disjunction) slot->disjunction->weak_unbind(*slot);
+				delete slot;
+			}
+		};
+		typedef std::unique_ptr<weak_slot, slot_deleter> slot_ptr;
 
-		// the set of all objects that are pointed-to by rooted handles (guaranteed not to contain null).
-		// this should not be modified directly - should only be manipulated by a valid sentry.
-		// this is a set to facilitate fast removal and to ensure there are no duplicates (efficiency).
-		// this is separate from the roots set for two reasons:
-		// 1) it's more convenient / efficient to perform the sweep logic in terms of objects.
-		// 2) if the (rooted) handle the root obj was sourced from is destroyed, said (rooted) handle ceases to exist.
-		//    this would be a problem later on in the collector, as we'd need to dereference the handle to get the obj to sweep.
-		//    but with this approach that's not an issue for the collector, because it won't ever need to be dereferenced again.
-		//    and we know the root obj won't be destroyed because the collector is the only one allowed to do that.
-		std::unordered_set<info*> root_objs;
+		// the entries, keyed by the hash of their (immutable) value.
+		// expired entries are left in place until they're encountered by a lookup or purged.
+		std::unordered_multimap<std::size_t, slot_ptr> entries;
 
-		// the list of objects that should be destroyed after a collector pass.
-		// this should not be modified directly - should only be manipulated by a valid sentry.
-		// when an object is marked for deletion (i.e. unreachable) it is removed from objs and added to this list.
-		// the sentry dtor will handle the logic of deleting the objects.
-		obj_list del_list;
+		// the entry count at which a miss purges the table before inserting (grows with the live entry count)
+		size_type purge_threshold = 64;
 
-	private: // -- modified caches -- //
+		mutable std::mutex mutex; // synchronizes everything above
 
-		// these are like caches (see below) but have special rules.
-		// for proper usage, read each modified cache's associated comments.
+		Hash hash;
+		KeyEqual equal;
 
-		// controls ref count deletion behavior:
-		// if false, delete the objects immediately.
-		// if true, cache the request in ref_count_del_cache.
-		// thus if false, the cache is considered a collector-only resource and must not be modified.
-		// if this is false, it is safe to directly modify the obj list under normal mutex lock.
-		bool cache_ref_count_del_actions = false;
+	private: // -- helpers -- //
 
-		// the shared resource cache for ref count deletion actions.
-		// objects in this cache MUST currently be in the obj list (NOT in the obj add cache).
-		// DO NOT unlink objects from the obj list when you put them in this list (just a cache).
-		// see cache_ref_count_del_actions for how to use this cache properly.
-		std::unordered_set<info*> ref_count_del_cache;
+		// gets the object equal to value with the given hash, or null if there is none.
+		// any expired entries encountered along the way are removed.
+		// mutex must be locked.
+		pointer __lookup(const T &value, std::size_t h)
+		{
+			auto range = entries.equal_range(h);
+			if (range.first == range.second) return {};
 
-	private: // -- caches -- //
+			// revive the whole bucket with raw arcs in one batch, so only the match (if any) needs a rooted GC::ptr
+			std::vector<const weak_slot*> slots;
+			for (auto i = range.first; i != range.second; ++i) slots.push_back(i->second.get());
+			std::vector<info*> targets(slots.size());
 
-		// these objects can be modified at any time so long as internal_mutex is locked.
-		// operations on these objects should be non-blocking (don't call arbitrary code while it's locked).
-		// among these are several caches:
-		// all actions must be non-blocking, but if there's currently a collector thread you can't modify the collector-only resources.
-		// thus, in these cases you add the action info to a cache, which will be applied when the collection action terminates.
-		// additionally, if there's NOT a collection action in progress, you MUST apply the change immediately (do not cache it).
-		// this is because the caches are only flushed upon termination of a collect action, not before one begins.
+			disjoint_module *disjunction = disjoint_module::local();
+			disjunction->weak_acquire(slots.data(), slots.size(), targets.data());
 
-		// the scheduled obj add operations.
-		// used by new obj insertion during a collection action.
-		std::unordered_set<info*> objs_add_cache;
+			pointer obj;
+			try
+			{
+				std::size_t i = 0;
+				for (auto iter = range.first; iter != range.second; ++i)
+				{
+					if (!targets[i]) { iter = entries.erase(iter); continue; }
+
+					const T *raw = static_cast<const T*>(targets[i]->obj);
+					if (!obj && equal(*raw, value)) obj = pointer(raw, targets[i], GC::raw_arc);
+					++iter;
+				}
+			}
+			catch (...)
+			{
+				disjunction->raw_arc_destroy(targets.data(), disjunction->raw_arc_detach(targets.data(), targets.size()));
+				throw;
+			}
 
-		// the scheduled root add/remove operations.
-		// these sets must at all times be disjoint.
-		std::unordered_set<info*const*> roots_add_cache;
-		std::unordered_set<info*const*> roots_remove_cache;
+			disjunction->raw_arc_destroy(targets.data(), disjunction->raw_arc_detach(targets.data(), targets.size()));
+			return obj;
+		}
 
-		// cache used to support non-blocking handle repoint actions.
-		// it is structured such that M[&raw_handle] is what it should be repointed to.
-		std::unordered_map<info**, info*> handle_repoint_cache; 
+		// removes all expired entries and returns the number removed.
+		// mutex must be locked.
+		size_type __purge()
+		{
+			// check all the slots in one batch rather than taking the disjunction's lock once per entry
+			std::vector<const weak_slot*> slots;
+			slots.reserve(entries.size());
+			for (const auto &entry : entries) slots.push_back(entry.second.get());
+			std::unique_ptr<bool[]> alive(new bool[slots.size()]);
 
-	public: // -- ctor / dtor / asgn -- //
+			disjoint_module::local()->weak_alive(slots.data(), slots.size(), alive.get());
 
-		disjoint_module() = default;
+			size_type count = 0, index = 0;
+			for (auto i = entries.begin(); i != entries.end(); ++index)
+			{
+				if (alive[index]) ++i;
+				else { i = entries.erase(i); ++count; }
+			}
+			return count;
+		}
 
-		~disjoint_module();
+		template<typename U>
+		pointer __intern(U &&value)
+		{
+			std::size_t h = hash(static_cast<const T&>(value));
 
-		disjoint_module(const disjoint_module&) = delete;
-		disjoint_module &operator=(const disjoint_module&) = delete;
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (pointer obj = __lookup(value, h)) return obj;
+
+			// on a miss, make sure expired entries don't accumulate without bound
+			if (entries.size() >= purge_threshold)
+			{
+				__purge();
+				purge_threshold = std::max<size_type>(64, entries.size() * 2);
+			}
+
+			pointer obj = GC::make<const T>(std::forward<U>(value));
+
+			slot_ptr slot(new weak_slot);
+			obj.handle.disjunction->weak_bind(*slot, obj.handle);
+			entries.emplace(h, std::move(slot));
+
+			return obj;
+		}
+
+	public: // -- ctor / dtor / asgn -- //
+
+		explicit intern_table(const Hash &_hash = Hash(), const KeyEqual &_equal = KeyEqual()) : hash(_hash), equal(_equal) {}
+
+		intern_table(const intern_table&) = delete;
+		intern_table &operator=(const intern_table&) = delete;
 
 	public: // -- interface -- //
 
-		// performs a collection action on (only) this disjoint gc module.
-		// returns false iff another thread is performing a collection on this module.
-		bool collect();
-		// performs a blocking collection - USE WITH IMMENSE CAUTION.
-		// if another thread is performing a collection on the current module, waits for it to finish before collecting.
-		// equivalent to "while (!collect()) ;"
-		void blocking_collect();
+		// gets the canonical object equal to value, creating it (as a copy/move of value) if there is none
+		pointer intern(const T &value) { return __intern(value); }
+		pointer intern(T &&value) { return __intern(std::move(value)); }
 
-		// returns true iff the calling thread is the current collector thread for (only) this disjoint module
-		bool this_is_collector_thread();
+		// gets the canonical object equal to value, or null if there is none
+		pointer find(const T &value)
+		{
+			std::size_t h = hash(value);
 
-		// schedules a handle creation action that points to null.
-		// raw_handle need not be initialized prior to this call.
-		void schedule_handle_create_null(smart_handle &handle);
-		// schedules a handle creation action that points to a new object - inserts new_obj into the obj database.
-		// new_obj must not already exist in the gc database (see create alias below).
-		// the reference count for new_obj is initialized to 1.
-		// raw_handle need not be initialized prior to this call.
-		void schedule_handle_create_bind_new_obj(smart_handle &handle, info *new_obj);
-		// schedules a handle creation action that points at a pre-existing handle - marks the new handle as a root.
-		// raw_handle need not be initialized prior to this call.
-		// increments the reference count of the referenced target.
-		void schedule_handle_create_alias(smart_handle &raw_handle, const smart_handle &src_handle);
+			std::lock_guard<std::mutex> lock(mutex);
+			return __lookup(value, h);
+		}
 
-		// schedules a handle deletion action - unroots the handle and purges it from the handle repoint cache.
-		// for any call to schedule_handle_create_*(), said handle must be sent here before the end of its lifetime.
-		// calling this function implies that the handle no longer exists as far as the gc systems are concerned.
-		// reference counting and other gc logic will commence due to the gc reference being destroyed.
-		void schedule_handle_destroy(const smart_handle &handle);
+		// returns the number of entries - this includes expired entries that have not yet been purged
+		size_type size() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return entries.size();
+		}
 
-		// schedules a handle unroot operation - unmarks handle as a root.
-		void schedule_handle_unroot(const smart_handle &raw_handle);
+		// removes all expired entries and returns the number removed
+		size_type purge()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return __purge();
+		}
 
-		// schedules a handle repoint action.
-		// handle shall eventually be repointed to null before the next collection action.
-		// automatically performs reference counting logic.
-		void schedule_handle_repoint_null(smart_handle &handle);
-		// schedules a handle repoint action.
-		// handle shall eventually be repointed to new_value before the next collection action.
-		// automatically performs reference counting logic.
-		void schedule_handle_repoint(smart_handle &handle, const smart_handle &new_value);
-		// schedules a handle repoint action that swaps the pointed-to info objects of two handles atomically.
-		// handle_a shall eventually point to whatever handle_b used to point to and vice versa.
-		void schedule_handle_repoint_swap(smart_handle &handle_a, smart_handle &handle_b);
+		// removes all entries - interned objects are unaffected, but later interns of equal values will create new objects
+		void clear()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			entries.clear();
+		}
+	};
 
-		// begins an ignore collect action for this disjoint module.
-		// returns the number of (active) ignore collect actions prior to the start of this one.
-		// e.g. if this returns zero there were no prior ignore collect actions.
-		// the same thread that called this must later call end_ignore_collect() exactly once.
-		std::size_t begin_ignore_collect();
-		// ends an ignore collect action that was previously started by the calling thread.
-		void end_ignore_collect();
+public: // -- intrusive containers -- //
 
-	private: // -- private interface (unsafe) -- //
-		
-		// marks handle as a root - internal_mutex should be locked
-		void __schedule_handle_root(const smart_handle &handle);
-		// unmarks handle as a root - internal_mutex should be locked
-		void __schedule_handle_unroot(const smart_handle &handle);
+	template<typename T> class list_hook;
+	template<typename T> class set_hook;
 
-		// the underlying function for all handle repoint actions.
-		// handles the logic of managing the repoint cache for repointing handle to target.
-		// DOES NOT HANDLE REFERENCE COUNT LOGIC - DO THAT ON YOUR OWN.
-		void __raw_schedule_handle_repoint(smart_handle &handle, info *target);
+	template<typename T, list_hook<T> T::*Hook> class intrusive_list;
+	template<typename T, set_hook<T> T::*Hook, typename Compare = std::less<T>> class intrusive_set;
 
-		// gets the current target info object of new_value.
-		// otherwise returns the current repoint target if it's in the repoint database.
-		// otherwise returns the current pointed-to value of value.
-		info *__get_current_target(const smart_handle &handle);
+	// a hook that links a gc object into an intrusive_list.
+	// it must be a member of the element type and must be routed by the element type's router.
+	// the hook holds an owning link to the next element and a raw link to the previous one, so (un)linking an element allocates nothing.
+	// a hook can be in at most one list at a time. copying an element does not copy its links (the new hook is unlinked).
+	template<typename T>
+	class list_hook
+	{
+	private: // -- data -- //
 
-		// performs the reference count decrement logic on target (allowed to be null).
-		// internal_lock is the (already-owned) lock on internal_mutex that was taken previously.
-		// you should do all your other work first before calling this.
-		// if the reference count falls to zero and there's no collection action, deletes the object.
-		// otherwise does nothing (aside from the reference count decrement).
-		// handles all deletion logic internally.
-		// THIS MUST BE THE LAST THING YOU DO UNDER INTERNAL_MUTEX LOCK.
-		void __MUST_BE_LAST_ref_count_dec(info *target, std::unique_lock<std::mutex> internal_lock);
+		GC::ptr<T> next;     // the next element (owning)
+		T *prev = nullptr;   // the previous element (non-owning)
+		bool linked = false; // true iff this hook is in a list
 
-	private: // -- factory accessor shared data -- //
+		template<typename U, list_hook<U> U::*> friend class intrusive_list;
+		friend struct GC::router<list_hook>;
 
-		// the repoint target for the local disjunction.
-		// this is only meant to be used by logic internally imbedded within the below factory accessor functions.
-		// this is not atomic because it's only modified during the dtor of the primary disjunction at static dtor time, and thus threads are not expected to exist.
-		// if this is null, use local_handle().get(), otherwise use this (a detour around the destroyed therad_local local handle object which would otherwise point to the same object).
-		static disjoint_module *local_detour;
+	public: // -- ctor / dtor / asgn -- //
 
-	public: // -- factory accessors -- //
+		list_hook() = default;
 
-		// gets the primary disjunction - the default one that all threads use unless instructed otherwise.
-		// this has static storage duration - thus this disjoint module's lifetime is the entire program lifetime.
-		static const shared_disjoint_handle &primary_handle();
-		// gets the disjunction that the calling thread belongs to.
-		// this has thread_local storage duration - references/pointers to the handle itself should not be passed between threads.
-		// IF THIS IS EVER REPOINTED IT MUST HAPPEN PRIOR TO CALLING ANY GC MANAGEMENT FUNCTIONS FROM THE CALLING THREAD!!
-		// the only valid repoint targets are sourced from disjoint_module_container::create_new_disjunction().
-		// CALLS TO THIS FUNCTION AFTER THE LIFETIME OF THREAD_LOCAL OBJECTS IN A GIVEN THREAD HAVE EXPIRED (E.G. WITHIN STATIC DTORS) IS UNDEFINED BEHAVIOR - SEE local_raw()).
-		// THIS SHOULD ONLY BE USED IF THE LOCAL THREAD IS GUARANTEED TO BE ALIVE (still running non-dtor code) - WHENEVER POSSIBLE, USE local() INSTEAD.
-		static shared_disjoint_handle &local_handle();
+		list_hook(const list_hook&) noexcept {}
+		list_hook &operator=(const list_hook&) noexcept { return *this; }
 
-		// gets a pointer to the primary disjunction.
-		static disjoint_module *primary();
-		// gets a pointer to the local disjunction.
-		// works properly even if the local handle has already been destroyed (e.g. for use in static dtors).
-		static disjoint_module *local();
+	public: // -- interface -- //
+
+		// returns true iff this hook is currently in a list
+		bool is_linked() const noexcept { return linked; }
 	};
 
-	// holds the info concerning all allocated disjunctions across all threads - including the primary disjunction.
-	// this is the only source for creating new disjunctions.
-	// this is used by the background collector to perform batch collections accross all threads.
-	class disjoint_module_container
+	// a hook that links a gc object into an intrusive_set (as a red-black tree node).
+	// it must be a member of the element type and must be routed by the element type's router.
+	// the hook holds owning links to its children and a raw link to its parent, so (un)linking an element allocates nothing.
+	// a hook can be in at most one set at a time. copying an element does not copy its links (the new hook is unlinked).
+	template<typename T>
+	class set_hook
 	{
 	private: // -- data -- //
 
-		std::mutex internal_mutex;
-		
-		// flag that marks if we're performing a collection action.
-		bool collecting = false;
-
-		// all the stored disjunctions.
-		// this can be modfied under internal_mutex lock unless in collecting mode.
-		// in collecting mode this is considered a collector-only resource.
-		std::list<weak_disjoint_handle> disjunctions;
+		GC::ptr<T> left, right; // the children (owning)
+		T *parent = nullptr;    // the parent (non-owning)
+		bool red = false;       // the node color
+		bool linked = false;    // true iff this hook is in a set
 
-		// all the cached disjunction insertion actions.
-		// this can be modified under internal_mutex lock.
-		// unless in collecting mode, this cache must at all times be empty.
-		std::list<weak_disjoint_handle> disjunction_add_cache;
+		template<typename U, set_hook<U> U::*, typename> friend class intrusive_set;
+		friend struct GC::router<set_hook>;
 
-	private: // -- ctor / dtor / asgn -- //
+	public: // -- ctor / dtor / asgn -- //
 
-		disjoint_module_container() = default;
-		~disjoint_module_container() = default;
+		set_hook() = default;
 
-		disjoint_module_container(const disjoint_module_container&) = delete;
-		disjoint_module_container &operator=(const disjoint_module_container&) = delete;
+		set_hook(const set_hook&) noexcept {}
+		set_hook &operator=(const set_hook&) noexcept { return *this; }
 
 	public: // -- interface -- //
 
-		// gets the (only) disjoint module container instance
-		static disjoint_module_container &get() { static disjoint_module_container c; return c; }
-
-		// creates a new disjunction and stores it to dest.
-		// this is the only valid repoint target for the local disjunction handle.
-		void create_new_disjunction(shared_disjoint_handle &dest);
+		// returns true iff this hook is currently in a set
+		bool is_linked() const noexcept { return linked; }
+	};
 
-		// performs a collection pass for all stored dynamic disjunctions.
-		// additionally performs culling logic for dangling disjunction handles.
-		// THIS MUST ONLY BE INVOKED BY THE BACKGROUND COLLECTOR!!
-		// this is because the internals of this function will repoint the local disjunction handle all over the place and leave it severed.
-		// if collect is true, performs a collection on each stored disjunction, otherwise only culls dangling handles.
-		void BACKGROUND_COLLECTOR_ONLY___collect(bool collect);
+	template<typename T>
+	struct router<list_hook<T>>
+	{
+		template<typename F> static void route(const list_hook<T> &hook, F func) { GC::route(hook.next, func); }
+	};
+	template<typename T>
+	struct router<set_hook<T>>
+	{
+		template<typename F> static void route(const set_hook<T> &hook, F func)
+		{
+			GC::route(hook.left, func);
+			GC::route(hook.right, func);
+		}
 	};
 
-	// data object used by shared/weak disjoint handles - entirely externally-managed
-	struct handle_data
+	// a doubly-linked list of gc objects that is threaded through a list_hook member of each element (Hook).
+	// linking and unlinking elements allocates nothing and touches only the affected elements' hooks.
+	// like the standard containers it is not internally-synchronized, but it (and its elements) can always be routed safely.
+	// the list holds its elements (an element only reachable through the list is kept alive by it).
+	// if the collector destroys a list (because it was unreachable), any of its elements that survive remain marked as linked and must not be linked again.
+	template<typename T, list_hook<T> T::*Hook>
+	class intrusive_list
 	{
-	public: // -- data / types -- //
+	public: // -- types -- //
 
-		// buffer for holding the module - empty on construction - must be empty before destruction of this object
-		alignas(disjoint_module) char buffer[sizeof(disjoint_module)];
+		typedef T value_type;
+		typedef std::size_t size_type;
 
-		// type used to represent the tag block
-		typedef std::uint64_t tag_t;
+		template<typename E>
+		class basic_iterator
+		{
+		public: // -- types -- //
 
-		// the bitfield tag used to represent the 3 types of reference counts on this object.
-		// this takes the form [high bits: lock][weak][low bits: strong]
-		// the utility functions tag_add() and tag_sub() optionally perform additional und testing - i suggest using those instead.
-		std::atomic<tag_t> tag = {0};
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef E *pointer;
+			typedef E &reference;
 
-		// flag marking that the object has been destroyed.
-		// used for synchronization between the weak/shared (strong) counter dec logic.
-		std::atomic<bool> destroyed_flag = {false};
+		private: // -- data -- //
 
-	public: // -- constants -- //
+			const intrusive_list *list = nullptr;
+			T *node = nullptr; // null for end()
 
-		static constexpr tag_t strong_bits = 56; // number of bits in the strong field
-		static constexpr tag_t weak_bits = 4;   // number of bits in the weak field
-		static constexpr tag_t lock_bits = 4;   // number of bits in the lock field
+			friend class intrusive_list;
 
-		static_assert(strong_bits + weak_bits + lock_bits <= CHAR_BIT * sizeof(tag_t), "handle data bit field problem");
+			basic_iterator(const intrusive_list *_list, T *_node) : list(_list), node(_node) {}
 
-		static constexpr tag_t strong_1 = (tag_t)1 << (0);                     // corresponds to a 1 in the strong field - can be or'd with other 1 values
-		static constexpr tag_t weak_1 = (tag_t)1 << (strong_bits);             // corresponds to a 1 in the weak field - can be or'd with other 1 values
-		static constexpr tag_t lock_1 = (tag_t)1 << (strong_bits + weak_bits); // corresponds to a 1 in the lock field - can be or'd with other 1 values
+		public: // -- ctor / dtor / asgn -- //
 
-		static constexpr tag_t strong_mask = (((tag_t)1 << strong_bits) - 1) << (0);                   // the mask for the strong field
-		static constexpr tag_t weak_mask = (((tag_t)1 << weak_bits) - 1) << (strong_bits);             // the mask for the weak field
-		static constexpr tag_t lock_mask = (((tag_t)1 << lock_bits) - 1) << (strong_bits + weak_bits); // the mask for the lock field
+			basic_iterator() = default;
 
-	public: // -- utility functions -- //
+			template<typename J = E, std::enable_if_t<std::is_const<J>::value, int> = 0>
+			basic_iterator(const basic_iterator<T> &other) : list(other.list), node(other.node) {}
 
-		// gets the address of the buffer for holding the actual module - see buffer
-		disjoint_module *get() noexcept { return reinterpret_cast<disjoint_module*>(buffer); }
+		public: // -- access -- //
 
-		// adds v to the tag atomically and returns the previous value
-		tag_t tag_add(tag_t v, std::memory_order order = std::memory_order_seq_cst);
-		// subtracts v from the tag atomically and returns the previous value
-		tag_t tag_sub(tag_t v, std::memory_order order = std::memory_order_seq_cst);
+			E &operator*() const { return *node; }
+			E *operator->() const { return node; }
 
-		// extracts the strong field from an encoded tag
-		static constexpr tag_t extr_strong(tag_t v) { return v & strong_mask; }
-		// extracts the weak field from an encoded tag
-		static constexpr tag_t extr_weak(tag_t v) { return (v & weak_mask) >> (strong_bits); }
-		// extracts the lock field from an encoded tag
-		static constexpr tag_t extr_lock(tag_t v) { return v >> (strong_bits + weak_bits); }
+		public: // -- inc / dec -- //
 
-		// gets the number of non-lock strong referneces - effectively (strong field - lock field)
-		static constexpr tag_t non_lock_strongs(tag_t v) { return extr_strong(v) - extr_lock(v); }
-	};
+			basic_iterator &operator++() { node = (node->*Hook).next.get(); return *this; }
+			basic_iterator &operator--() { node = node ? (node->*Hook).prev : list->tail; return *this; }
 
-	// acts as an owning handle for a gc disjunction module.
-	// repointing and destructor actions on this object trigger end-of-thread cleanup for gc resources.
-	// thus, you should NEVER EVER use this type as a local object - undefined behavior.
-	// this should only be used for the primary/local handles - all others should be weak_disjoint_handle.
-	class shared_disjoint_handle
-	{
-	private: // -- data -- //
+			basic_iterator operator++(int) { basic_iterator cpy = *this; ++*this; return cpy; }
+			basic_iterator operator--(int) { basic_iterator cpy = *this; --*this; return cpy; }
 
-		disjoint_module *__module; // the pre-cached module pointer - at all times __module and data are both null or __module == data->get()
-		handle_data *data; // the module allocation block - stores all the ref count info and the actual module itself
+		public: // -- cmp -- //
 
-		friend class weak_disjoint_handle;
-		friend class disjoint_module_container;
+			friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept { return a.node == b.node; }
+			friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept { return a.node != b.node; }
 
-	private: // -- repointing -- //
+			template<typename> friend class basic_iterator;
+		};
 
-		// repoints this handle at other - performs all relevant reference counting logic for automatic cleanup.
-		// repointing to the same disjunction data block we already point at is no-op.
-		// other must be sourced from a valid SHARED (strong) disjoint handle object.
-		// MUST NOT BE USED FOR LOCKING!!
-		void reset(handle_data *other = nullptr);
+		typedef basic_iterator<T> iterator;
+		typedef basic_iterator<const T> const_iterator;
 
-		// performs all logic necessary for locking onto a weak reference.
-		// if the lock fails the resulting state is null.
-		// other must be sourced from a valid WEAK disjoint handle object.
-		// MUST BE USED FOR LOCKING!!
-		void lock(handle_data *other);
+	private: // -- data -- //
 
-	public: // -- ctor / dtor / asgn -- //
+		GC::ptr<T> head;    // the first element (owning)
+		T *tail = nullptr;  // the last element (non-owning)
+		size_type count = 0;
 
-		// creates an owning handle that does not alias a disjunction
-		explicit shared_disjoint_handle(std::nullptr_t = nullptr) noexcept;
+		friend struct GC::router<intrusive_list>;
 
-		~shared_disjoint_handle();
+	private: // -- helpers -- //
 
-		// creates a new owning handle that aliases the same disjunction
-		shared_disjoint_handle(const shared_disjoint_handle &other);
-		// creates a new owning handle that aliases the same disjunction - other is empty after this operation
-		shared_disjoint_handle(shared_disjoint_handle &&other) noexcept;
+		static list_hook<T> &hook(T &elem) noexcept { return elem.*Hook; }
 
-		// repoints this owning handle to other's disjunction
-		shared_disjoint_handle &operator=(const shared_disjoint_handle &other);
-		// repoints this owning handle to other's disjunction - other is empty after this operation (unless other == this, in which case no-op).
-		// this is the only way to use non-primary/local handles and not invoke undefined behavior (so long as you move into a primary/local handle).
-		shared_disjoint_handle &operator=(shared_disjoint_handle &&other);
+		// gets the (owning) link that points at elem
+		GC::ptr<T> &link_to(T &elem) noexcept
+		{
+			T *prev = hook(elem).prev;
+			return prev ? hook(*prev).next : head;
+		}
 
-		// repoints this owning handle to null (no owned disjunction)
-		shared_disjoint_handle &operator=(std::nullptr_t);
+		// links elem (which must be non-null and unlinked) before pos (null for the end of the list)
+		void link_before(T *pos, const GC::ptr<T> &elem)
+		{
+			if (!elem) throw std::invalid_argument("attempt to link a null element into an intrusive_list");
+			list_hook<T> &h = hook(*elem);
+			if (h.linked) throw std::invalid_argument("attempt to link an element that is already linked");
 
-	public: // -- weak handle locking -- //
+			if (pos)
+			{
+				GC::ptr<T> &link = link_to(*pos);
+				h.prev = hook(*pos).prev;
+				h.next = link;
+				link = elem;
+				hook(*pos).prev = elem.get();
+			}
+			else
+			{
+				h.prev = tail;
+				(tail ? hook(*tail).next : head) = elem;
+				tail = elem.get();
+			}
 
-		// repoints this owning handle to the object aliased by non-owning handle other.
-		// if the object aliased by other is at this point invalid, this results in null (for this object).
-		shared_disjoint_handle &operator=(const weak_disjoint_handle &other);
+			h.linked = true;
+			++count;
+		}
 
-	public: // -- module access -- //
+		// unlinks elem (which must be in this list) and returns the link that owned it
+		GC::ptr<T> unlink(T &elem)
+		{
+			list_hook<T> &h = hook(elem);
+			GC::ptr<T> &link = link_to(elem);
+			GC::ptr<T> res = link;
 
-		// returns true iff this owning handle aliases a disjunction
-		explicit operator bool() const noexcept { return __module != nullptr; }
-		// returns true iff this owning handle does not alias a disjunction
-		bool operator!() const noexcept { return __module == nullptr; }
+			if (T *next = h.next.get()) hook(*next).prev = h.prev;
+			else tail = h.prev;
+			link = h.next;
 
-		// gets the aliased disjunction - if this handle does not alias a disjunction returns null
-		disjoint_module *get() const noexcept { return __module; }
+			h.next = nullptr;
+			h.prev = nullptr;
+			h.linked = false;
+			--count;
 
-		disjoint_module *operator->() const noexcept { return get(); }
-		disjoint_module &operator*() const { return *get(); }
+			return res;
+		}
+
+	public: // -- ctor / dtor / asgn -- //
+
+		intrusive_list() = default;
+
+		intrusive_list(const intrusive_list&) = delete;
+		intrusive_list &operator=(const intrusive_list&) = delete;
+
+		intrusive_list(intrusive_list &&other) { swap(other); }
+		intrusive_list &operator=(intrusive_list &&other)
+		{
+			if (this != &other) { clear(); swap(other); }
+			return *this;
+		}
+
+		// unlinks the elements back to front (so destroying a long list doesn't recurse through the whole chain).
+		// the collector destroys unreachable objects in no particular order, so if it's destroying the first element we can't touch the elements.
+		// (if the first element survives, so does everything it links to).
+		~intrusive_list()
+		{
+			if (!head.handle.disjunction->this_is_collector_destroying(head.handle)) clear();
+		}
+
+	public: // -- access -- //
+
+		T &front() const { return *head; }
+		T &back() const { return *tail; }
+
+		iterator begin() noexcept { return { this, head.get() }; }
+		iterator end() noexcept { return { this, nullptr }; }
+
+		const_iterator begin() const noexcept { return { this, head.get() }; }
+		const_iterator end() const noexcept { return { this, nullptr }; }
+
+		const_iterator cbegin() const noexcept { return begin(); }
+		const_iterator cend() const noexcept { return end(); }
+
+		// gets an (owning) gc pointer to elem, which must be in this list
+		GC::ptr<T> ptr_to(T &elem) const { return const_cast<intrusive_list*>(this)->link_to(elem); }
+
+	public: // -- size -- //
+
+		bool empty() const noexcept { return count == 0; }
+		size_type size() const noexcept { return count; }
+
+	public: // -- insert / erase -- //
+
+		// links elem before pos and returns an iterator to it.
+		// throws std::invalid_argument if elem is null or already linked.
+		iterator insert(const_iterator pos, const GC::ptr<T> &elem)
+		{
+			link_before(pos.node, elem);
+			return { this, elem.get() };
+		}
+
+		// links elem at the front/back of the list.
+		// throws std::invalid_argument if elem is null or already linked.
+		void push_front(const GC::ptr<T> &elem) { link_before(head.get(), elem); }
+		void push_back(const GC::ptr<T> &elem) { link_before(nullptr, elem); }
+
+		// unlinks the first/last element and returns it - the list must not be empty
+		GC::ptr<T> pop_front() { return unlink(*head); }
+		GC::ptr<T> pop_back() { return unlink(*tail); }
+
+		// unlinks elem (which must be in this list) and returns it
+		GC::ptr<T> erase(T &elem) { return unlink(elem); }
+		// unlinks the element at pos and returns an iterator to the element that followed it
+		iterator erase(const_iterator pos)
+		{
+			T *next = (pos.node->*Hook).next.get();
+			unlink(*pos.node);
+			return { this, next };
+		}
+
+		// moves elem (which must be in this list) to the front/back of the list
+		void move_to_front(T &elem)
+		{
+			if (&elem != head.get()) link_before(head.get(), unlink(elem));
+		}
+		void move_to_back(T &elem)
+		{
+			if (&elem != tail) link_before(nullptr, unlink(elem));
+		}
+
+		// unlinks all the elements
+		void clear()
+		{
+			while (tail) unlink(*tail);
+		}
+
+	public: // -- swap -- //
+
+		void swap(intrusive_list &other)
+		{
+			GC::ptr<T> tmp = head;
+			head = other.head;
+			other.head = tmp;
+			std::swap(tail, other.tail);
+			std::swap(count, other.count);
+		}
+		friend void swap(intrusive_list &a, intrusive_list &b) { a.swap(b); }
 	};
-	// the non-owning form of shared_disjoint_handle.
-	// this type is how you store local references to the shared version (which should only be used for primary/local handles).
-	class weak_disjoint_handle
+
+	// an ordered set of gc objects (a red-black tree) that is threaded through a set_hook member of each element (Hook).
+	// elements are ordered by Compare and must not be modified in a way that changes their order while linked.
+	// linking and unlinking elements allocates nothing and touches only the hooks of the affected elements and their neighbors in the tree.
+	// like the standard containers it is not internally-synchronized, but it (and its elements) can always be routed safely.
+	// the set holds its elements (an element only reachable through the set is kept alive by it).
+	// if the collector destroys a set (because it was unreachable), any of its elements that survive remain marked as linked and must not be linked again.
+	template<typename T, set_hook<T> T::*Hook, typename Compare>
+	class intrusive_set
 	{
+	public: // -- types -- //
+
+		typedef T value_type;
+		typedef Compare value_compare;
+		typedef std::size_t size_type;
+
+		template<typename E>
+		class basic_iterator
+		{
+		public: // -- types -- //
+
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef E *pointer;
+			typedef E &reference;
+
+		private: // -- data -- //
+
+			const intrusive_set *set = nullptr;
+			T *node = nullptr; // null for end()
+
+			friend class intrusive_set;
+
+			basic_iterator(const intrusive_set *_set, T *_node) : set(_set), node(_node) {}
+
+		public: // -- ctor / dtor / asgn -- //
+
+			basic_iterator() = default;
+
+			template<typename J = E, std::enable_if_t<std::is_const<J>::value, int> = 0>
+			basic_iterator(const basic_iterator<T> &other) : set(other.set), node(other.node) {}
+
+		public: // -- access -- //
+
+			E &operator*() const { return *node; }
+			E *operator->() const { return node; }
+
+		public: // -- inc / dec -- //
+
+			basic_iterator &operator++() { node = successor(node); return *this; }
+			basic_iterator &operator--() { node = node ? predecessor(node) : maximum(set->root.get()); return *this; }
+
+			basic_iterator operator++(int) { basic_iterator cpy = *this; ++*this; return cpy; }
+			basic_iterator operator--(int) { basic_iterator cpy = *this; --*this; return cpy; }
+
+		public: // -- cmp -- //
+
+			friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept { return a.node == b.node; }
+			friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept { return a.node != b.node; }
+
+			template<typename> friend class basic_iterator;
+		};
+
+		typedef basic_iterator<T> iterator;
+		typedef basic_iterator<const T> const_iterator;
+
 	private: // -- data -- //
 
-		handle_data *data; // the managed disjunction - EXTERNAL CODE SHOULD NOT MODIFY DIRECTLY - use reset()
+		GC::ptr<T> root; // the root node (owning)
+		size_type count = 0;
+		Compare comp;
 
-		friend class shared_disjoint_handle;
+		friend struct GC::router<intrusive_set>;
 
-	private: // -- repointing -- //
+	private: // -- tree helpers -- //
 
-		// repoints this handle at other - performs all relevant reference counting logic for automatic cleanup.
-		// repointing to the same disjunction data block we already point at is no-op.
-		// other must be sourced from a valid weak or shared (strong) handle.
-		void reset(handle_data *other = nullptr);
+		static set_hook<T> &hook(T &elem) noexcept { return elem.*Hook; }
 
-	public: // -- ctor / dtor / asgn -- //
+		static bool is_red(T *node) noexcept { return node && hook(*node).red; }
 
-		// creates a non-owning handle that does not alias a disjunction
-		explicit weak_disjoint_handle(std::nullptr_t = nullptr) noexcept;
+		static T *minimum(T *node) noexcept
+		{
+			if (node) while (T *left = hook(*node).left.get()) node = left;
+			return node;
+		}
+		static T *maximum(T *node) noexcept
+		{
+			if (node) while (T *right = hook(*node).right.get()) node = right;
+			return node;
+		}
 
-		~weak_disjoint_handle();
+		// gets the next/previous node in order (null if there is none)
+		static T *successor(T *node) noexcept
+		{
+			if (T *right = hook(*node).right.get()) return minimum(right);
+			T *parent = hook(*node).parent;
+			for (; parent && node == hook(*parent).right.get(); parent = hook(*parent).parent) node = parent;
+			return parent;
+		}
+		static T *predecessor(T *node) noexcept
+		{
+			if (T *left = hook(*node).left.get()) return maximum(left);
+			T *parent = hook(*node).parent;
+			for (; parent && node == hook(*parent).left.get(); parent = hook(*parent).parent) node = parent;
+			return parent;
+		}
 
-		// creates a new non-owning handle that aliases the same disjunction
-		weak_disjoint_handle(const weak_disjoint_handle &other);
-		// creates a new owning handle that aliases the same disjunction - other is empty after this operation
-		weak_disjoint_handle(weak_disjoint_handle &&other) noexcept;
-		
-		// repoints this non-owning handle to other's disjunction
-		weak_disjoint_handle &operator=(const weak_disjoint_handle &other);
-		// repoints this non-owning handle to other's disjunction - other is empty after this operation (unless other == this, in which case no-op).
-		weak_disjoint_handle &operator=(weak_disjoint_handle &&other);
+		// gets the (owning) link that points at node
+		GC::ptr<T> &link_to(T &node) noexcept
+		{
+			T *parent = hook(node).parent;
+			return !parent ? root : hook(*parent).left.get() == &node ? hook(*parent).left : hook(*parent).right;
+		}
 
-		// repoints this non-owning handle to null (no owned disjunction)
-		weak_disjoint_handle &operator=(std::nullptr_t);
+		// replaces node (which the caller must hold) with replacement (allowed to be null) in node's parent
+		void transplant(T &node, const GC::ptr<T> &replacement)
+		{
+			link_to(node) = replacement;
+			if (replacement) hook(*replacement).parent = hook(node).parent;
+		}
 
-	public: // -- shared handle aliasing -- //
+		void rotate_left(T &node)
+		{
+			set_hook<T> &h = hook(node);
+			GC::ptr<T> &link = link_to(node);
+			GC::ptr<T> self = link, pivot = h.right;
+			set_hook<T> &p = hook(*pivot);
+
+			h.right = p.left;
+			if (h.right) hook(*h.right).parent = &node;
+			p.parent = h.parent;
+			link = pivot;
+			p.left = self;
+			h.parent = pivot.get();
+		}
+		void rotate_right(T &node)
+		{
+			set_hook<T> &h = hook(node);
+			GC::ptr<T> &link = link_to(node);
+			GC::ptr<T> self = link, pivot = h.left;
+			set_hook<T> &p = hook(*pivot);
+
+			h.left = p.right;
+			if (h.left) hook(*h.left).parent = &node;
+			p.parent = h.parent;
+			link = pivot;
+			p.right = self;
+			h.parent = pivot.get();
+		}
 
-		// creates a new non-owning handle that aliases the disjunction aliased by an owning handle
-		weak_disjoint_handle(const shared_disjoint_handle &other);
-		// reploints this non-owning handle to the disjunction aliased by an owning handle
-		weak_disjoint_handle &operator=(const shared_disjoint_handle &other);
+		void insert_fixup(T *node)
+		{
+			while (node != root.get() && is_red(hook(*node).parent))
+			{
+				T *parent = hook(*node).parent, *grand = hook(*parent).parent;
+
+				if (parent == hook(*grand).left.get())
+				{
+					T *uncle = hook(*grand).right.get();
+					if (is_red(uncle))
+					{
+						hook(*parent).red = false;
+						hook(*uncle).red = false;
+						hook(*grand).red = true;
+						node = grand;
+					}
+					else
+					{
+						if (node == hook(*parent).right.get()) { node = parent; rotate_left(*node); parent = hook(*node).parent; }
+						hook(*parent).red = false;
+						hook(*grand).red = true;
+						rotate_right(*grand);
+					}
+				}
+				else
+				{
+					T *uncle = hook(*grand).left.get();
+					if (is_red(uncle))
+					{
+						hook(*parent).red = false;
+						hook(*uncle).red = false;
+						hook(*grand).red = true;
+						node = grand;
+					}
+					else
+					{
+						if (node == hook(*parent).left.get()) { node = parent; rotate_right(*node); parent = hook(*node).parent; }
+						hook(*parent).red = false;
+						hook(*grand).red = true;
+						rotate_left(*grand);
+					}
+				}
+			}
+			hook(*root).red = false;
+		}
 
-	public: // -- module queries -- //
+		// restores the tree properties after removing a black node - node (allowed to be null) is the node that took its place and parent is its parent
+		void erase_fixup(T *node, T *parent)
+		{
+			while (node != root.get() && !is_red(node))
+			{
+				if (node == hook(*parent).left.get())
+				{
+					T *sibling = hook(*parent).right.get();
+					if (is_red(sibling))
+					{
+						hook(*sibling).red = false;
+						hook(*parent).red = true;
+						rotate_left(*parent);
+						sibling = hook(*parent).right.get();
+					}
+					if (!is_red(hook(*sibling).left.get()) && !is_red(hook(*sibling).right.get()))
+					{
+						hook(*sibling).red = true;
+						node = parent;
+						parent = hook(*node).parent;
+					}
+					else
+					{
+						if (!is_red(hook(*sibling).right.get()))
+						{
+							hook(*hook(*sibling).left).red = false;
+							hook(*sibling).red = true;
+							rotate_right(*sibling);
+							sibling = hook(*parent).right.get();
+						}
+						hook(*sibling).red = hook(*parent).red;
+						hook(*parent).red = false;
+						hook(*hook(*sibling).right).red = false;
+						rotate_left(*parent);
+						node = root.get();
+					}
+				}
+				else
+				{
+					T *sibling = hook(*parent).left.get();
+					if (is_red(sibling))
+					{
+						hook(*sibling).red = false;
+						hook(*parent).red = true;
+						rotate_right(*parent);
+						sibling = hook(*parent).left.get();
+					}
+					if (!is_red(hook(*sibling).right.get()) && !is_red(hook(*sibling).left.get()))
+					{
+						hook(*sibling).red = true;
+						node = parent;
+						parent = hook(*node).parent;
+					}
+					else
+					{
+						if (!is_red(hook(*sibling).left.get()))
+						{
+							hook(*hook(*sibling).right).red = false;
+							hook(*sibling).red = true;
+							rotate_left(*sibling);
+							sibling = hook(*parent).left.get();
+						}
+						hook(*sibling).red = hook(*parent).red;
+						hook(*parent).red = false;
+						hook(*hook(*sibling).left).red = false;
+						rotate_right(*parent);
+						node = root.get();
+					}
+				}
+			}
+			if (node) hook(*node).red = false;
+		}
 
-		// returns true iff the last owning handle to the aliased disjunction has been severed.
-		// by its very nature this function is racy - depending on your need locking might be a better option.
-		// if this handle does not alias a disjunction, returns true.
-		bool expired() const noexcept;
-	};
+		// unlinks node (which must be in this set) and returns the link that owned it
+		GC::ptr<T> unlink(T &node)
+		{
+			set_hook<T> &h = hook(node);
+			GC::ptr<T> res = link_to(node);
 
-	friend struct __gc_primary_usage_guard_t;
-	friend struct __gc_local_usage_guard_t;
+			T *child, *child_parent;
+			bool removed_red = h.red;
 
-private: // -- data -- //
+			if (!h.left)
+			{
+				child = h.right.get();
+				child_parent = h.parent;
+				transplant(node, h.right);
+			}
+			else if (!h.right)
+			{
+				child = h.left.get();
+				child_parent = h.parent;
+				transplant(node, h.left);
+			}
+			else
+			{
+				// replace it with its successor (which has no left child)
+				T *next = minimum(h.right.get());
+				set_hook<T> &n = hook(*next);
+				GC::ptr<T> next_ptr = link_to(*next);
+
+				removed_red = n.red;
+				child = n.right.get();
+
+				if (n.parent == &node) child_parent = next;
+				else
+				{
+					child_parent = n.parent;
+					transplant(*next, n.right);
+					n.right = h.right;
+					hook(*n.right).parent = next;
+				}
+
+				transplant(node, next_ptr);
+				n.left = h.left;
+				hook(*n.left).parent = next;
+				n.red = h.red;
+			}
 
-	static std::atomic<strategies> _strategy; // the auto collect tactics currently in place
+			h.left = nullptr;
+			h.right = nullptr;
+			h.parent = nullptr;
+			h.red = false;
+			h.linked = false;
+			--count;
 
-	static std::atomic<sleep_time_t> _sleep_time; // the amount of time to sleep after an automatic timed collection cycle
-	
-private: // -- misc -- //
+			if (!removed_red) erase_fixup(child, child_parent);
 
-	GC() = delete; // not instantiatable
+			return res;
+		}
 
-	// allocates space and returns a pointer to at least <size> bytes which is aligned to <align>.
-	// it is undefined behavior if align is not a power of 2.
-	// allocating zero bytes returns null.
-	// on failure, returns null.
-	// must be deallocated via aligned_free().
-	[[nodiscard]]
-	static void *aligned_malloc(std::size_t size, std::size_t align);
-	// deallocates a block of memory allocated by aligned_malloc().
-	// if <ptr> is null, does nothing.
-	static void aligned_free(void *ptr);
+		// gets the first node not less than key (null if there is none)
+		template<typename K>
+		T *lower_bound_node(const K &key) const
+		{
+			T *res = nullptr;
+			for (T *node = root.get(); node; )
+			{
+				if (comp(*node, key)) node = hook(*node).right.get();
+				else { res = node; node = hook(*node).left.get(); }
+			}
+			return res;
+		}
+		template<typename K>
+		T *find_node(const K &key) const
+		{
+			T *node = lower_bound_node(key);
+			return node && !comp(key, *node) ? node : nullptr;
+		}
 
-private: // -- private interface -- //
+	public: // -- ctor / dtor / asgn -- //
 
-	// -----------------------------------------------------------------
-	// from here on out, function names follow these conventions:
-	// starts with "__" = GC::mutex must be locked prior to invocation.
-	// otherwise = GC::mutex must not be locked prior to invocation.
-	// -----------------------------------------------------------------
-	
-	// the first invocation of this function begins a new thread to perform timed garbage collection.
-	// all subsequent invocations do nothing.
-	static void start_timed_collect();
+		explicit intrusive_set(const Compare &_comp = Compare()) : comp(_comp) {}
 
-private: // -- utility router functions -- //
-	
-	static void router_unroot(const smart_handle &arc);
-};
+		intrusive_set(const intrusive_set&) = delete;
+		intrusive_set &operator=(const intrusive_set&) = delete;
 
-// ------------------------- //
+		intrusive_set(intrusive_set &&other) : comp(other.comp) { swap(other); }
+		intrusive_set &operator=(intrusive_set &&other)
+		{
+			if (this != &other) { clear(); swap(other); }
+			return *this;
+		}
 
-// -- std specializations -- //
+		// unlinks the elements leaves first (so destroying a large set doesn't recurse through the whole tree).
+		// the collector destroys unreachable objects in no particular order, so if it's destroying the root we can't touch the elements.
+		// (if the root survives, so does everything it links to).
+		~intrusive_set()
+		{
+			if (!root.handle.disjunction->this_is_collector_destroying(root.handle)) clear();
+		}
 
-// ------------------------- //
+	public: // -- access -- //
 
-// hash functions for gc ptr
-template<typename T>
-struct std::hash<GC::ptr<T>>
-{
-	std::size_t operator()(const GC::ptr<T> &p) const { return std::hash<T*>()(p.get()); }
-};
+		iterator begin() noexcept { return { this, minimum(root.get()) }; }
+		iterator end() noexcept { return { this, nullptr }; }
 
-// standard wrapper for atomic_ptr.
-// it might be faster to use atomic_ptr directly (depending on compiler).
-template<typename T>
-struct std::atomic<GC::ptr<T>>
-{
-private: // -- data -- //
+		const_iterator begin() const noexcept { return { this, minimum(root.get()) }; }
+		const_iterator end() const noexcept { return { this, nullptr }; }
 
-	GC::atomic_ptr<T> value;
+		const_iterator cbegin() const noexcept { return begin(); }
+		const_iterator cend() const noexcept { return end(); }
 
-	friend struct GC::router<std::atomic<GC::ptr<T>>>;
+		// gets an (owning) gc pointer to elem, which must be in this set
+		GC::ptr<T> ptr_to(T &elem) const { return const_cast<intrusive_set*>(this)->link_to(elem); }
 
-public: // -- ctor / dtor / asgn -- //
+		value_compare value_comp() const { return comp; }
 
-	atomic() = default;
+	public: // -- lookup -- //
 
-	~atomic() = default;
+		// gets the element equivalent to value, or null if there is none
+		T *find(const T &value) const { return find_node(value); }
+		bool contains(const T &value) const { return find_node(value) != nullptr; }
 
-	atomic(const atomic&) = delete;
-	atomic &operator=(const atomic&) = delete;
+		// gets an iterator to the first element not less than value
+		iterator lower_bound(const T &value) { return { this, lower_bound_node(value) }; }
+		const_iterator lower_bound(const T &value) const { return { this, lower_bound_node(value) }; }
 
-public: // -- store / load -- //
+		// as above, but for any key type comparable with T (only if Compare is transparent)
+		template<typename K, typename C = Compare, typename = typename C::is_transparent>
+		T *find(const K &key) const { return find_node(key); }
+		template<typename K, typename C = Compare, typename = typename C::is_transparent>
+		bool contains(const K &key) const { return find_node(key) != nullptr; }
+		template<typename K, typename C = Compare, typename = typename C::is_transparent>
+		iterator lower_bound(const K &key) { return { this, lower_bound_node(key) }; }
+		template<typename K, typename C = Compare, typename = typename C::is_transparent>
+		const_iterator lower_bound(const K &key) const { return { this, lower_bound_node(key) }; }
 
-	atomic(const GC::ptr<T> &desired) : value(desired) {}
-	atomic &operator=(const GC::ptr<T> &desired) { value = desired; return *this; }
+	public: // -- size -- //
 
-	void store(const GC::ptr<T> &desired) { value.store(desired); }
-	GC::ptr<T> load() const { return value.load(); }
+		bool empty() const noexcept { return count == 0; }
+		size_type size() const noexcept { return count; }
 
-	operator GC::ptr<T>() const { return static_cast<GC::ptr<T>>(value); }
+	public: // -- insert / erase -- //
 
-public: // -- exchange -- //
+		// links elem into the set, unless there is already an equivalent element.
+		// returns an iterator to the element in the set and true iff elem was inserted.
+		// throws std::invalid_argument if elem is null or already linked.
+		std::pair<iterator, bool> insert(const GC::ptr<T> &elem)
+		{
+			if (!elem) throw std::invalid_argument("attempt to link a null element into an intrusive_set");
+			set_hook<T> &h = hook(*elem);
+			if (h.linked) throw std::invalid_argument("attempt to link an element that is already linked");
 
-	GC::ptr<T> exchange(const GC::ptr<T> &desired) { return value.exchange(desired); }
+			T *parent = nullptr;
+			bool left = false;
+			for (T *node = root.get(); node; )
+			{
+				parent = node;
+				if (comp(*elem, *node)) { left = true; node = hook(*node).left.get(); }
+				else if (comp(*node, *elem)) { left = false; node = hook(*node).right.get(); }
+				else return { { this, node }, false };
+			}
+
+			h.parent = parent;
+			h.red = true;
+			h.linked = true;
+			(!parent ? root : left ? hook(*parent).left : hook(*parent).right) = elem;
+			++count;
+
+			insert_fixup(elem.get());
+			return { { this, elem.get() }, true };
+		}
+
+		// unlinks elem (which must be in this set) and returns it
+		GC::ptr<T> erase(T &elem) { return unlink(elem); }
+		// unlinks the element at pos and returns an iterator to the element that followed it
+		iterator erase(const_iterator pos)
+		{
+			T *next = successor(pos.node);
+			unlink(*pos.node);
+			return { this, next };
+		}
+
+		// unlinks all the elements
+		void clear()
+		{
+			for (T *node = root.get(); node; )
+			{
+				set_hook<T> &h = hook(*node);
+
+				if (h.left) node = h.left.get();
+				else if (h.right) node = h.right.get();
+				else
+				{
+					// it's a leaf - unlink it (holding it until we're done with its hook)
+					T *parent = h.parent;
+					GC::ptr<T> &link = link_to(*node);
+					GC::ptr<T> hold = link;
+
+					h.parent = nullptr;
+					h.red = false;
+					h.linked = false;
+					link = nullptr;
+
+					node = parent;
+				}
+			}
+			count = 0;
+		}
+
+	public: // -- swap -- //
+
+		void swap(intrusive_set &other)
+		{
+			GC::ptr<T> tmp = root;
+			root = other.root;
+			other.root = tmp;
+			std::swap(count, other.count);
+			std::swap(comp, other.comp);
+		}
+		friend void swap(intrusive_set &a, intrusive_set &b) { a.swap(b); }
+	};
+
+	// routes a message directed at an intrusive container to its first/root element (the rest are routed through their hooks)
+	template<typename T, list_hook<T> T::*Hook>
+	struct router<intrusive_list<T, Hook>>
+	{
+		template<typename F> static void route(const intrusive_list<T, Hook> &list, F func) { GC::route(list.head, func); }
+	};
+	template<typename T, set_hook<T> T::*Hook, typename Compare>
+	struct router<intrusive_set<T, Hook, Compare>>
+	{
+		template<typename F> static void route(const intrusive_set<T, Hook, Compare> &set, F func) { GC::route(set.root, func); }
+	};
+
+private: // -- concurrent map storage -- //
+
+	// the part of a concurrent_map node (or its head) that forms the skip list - a tower of raw arcs to the next node on each level.
+	// readers traverse the links without locking (inside an epoch guard) - writers lock each tower whose links they modify.
+	// the collector sees each link as a span of one raw arc (raw arcs are never roots, so they need no unrooting).
+	struct skip_tower
+	{
+		const std::unique_ptr<std::atomic<info*>[]> links; // the next node on each level (null at the end of a level)
+		const int height;                                 // the number of levels this tower is in
+
+		mutable std::mutex mutex; // locked while modifying the links (for nodes, this also synchronizes the value)
+		std::atomic<bool> marked; // set (while locked) when a node is logically removed - its links are never modified afterwards
+
+		explicit skip_tower(int _height) : links(new std::atomic<info*>[_height]), height(_height), marked(false)
+		{
+			for (int i = 0; i < height; ++i) links[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		skip_tower(const skip_tower&) = delete;
+		skip_tower &operator=(const skip_tower&) = delete;
+
+		~skip_tower()
+		{
+			for (int i = 0; i < height; ++i)
+				if (info *arc = links[i].load(std::memory_order_relaxed)) arc->disjunction->raw_arc_release(arc);
+		}
+
+		// routes the links - they're atomic and every unlinked target goes through the write barrier, so this needs no lock
+		template<typename F>
+		void route_links(F func) const
+		{
+			for (int i = 0; i < height; ++i)
+			{
+				info *arc = links[i].load(std::memory_order_acquire);
+				func(&arc, 1);
+			}
+		}
+	};
+
+	// the head of a concurrent_map - a tower that is in every level
+	template<typename Key, typename T>
+	struct skip_head : skip_tower
+	{
+		using skip_tower::skip_tower;
+	};
+
+	// a node of a concurrent_map
+	template<typename Key, typename T>
+	struct skip_node : skip_tower
+	{
+		const Key key;
+		T value; // synchronized by mutex
+
+		std::atomic<bool> fully_linked; // set once the node has been linked into all of its levels
+
+		template<typename ...Args>
+		skip_node(int _height, const Key &_key, Args &&...args) : skip_tower(_height), key(_key), value(std::forward<Args>(args)...), fully_linked(false) {}
+	};
+
+public: // -- concurrent map -- //
+
+	// an internally-synchronized ordered map (a lazy skip list) whose nodes are gc objects.
+	// lookups and scans never lock the list structure (they traverse raw arcs inside an epoch guard) - they only lock a node while accessing its value.
+	// insertion and removal only lock the nodes adjacent to the key on each level, so updates to different parts of the map proceed in parallel.
+	// removed nodes are retired (see GC::retire()), so concurrent readers can still traverse them - the gc reclaims them once no reader can see them.
+	// all threads using a map must be in the disjunction it was created in.
+	template<typename Key, typename T, typename Compare = std::less<Key>>
+	class concurrent_map
+	{
+	public: // -- types -- //
+
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef std::pair<const Key, T> value_type;
+
+		typedef Compare key_compare;
+
+		typedef std::size_t size_type;
+
+	private: // -- types -- //
+
+		typedef skip_node<Key, T> node;
+
+		// the maximum number of levels - each level holds about a quarter of the nodes in the level below it
+		static constexpr int max_height = 16;
+
+	private: // -- data -- //
+
+		// the head tower (in every level).
+		// this is the only handle the map has and it is never repointed.
+		GC::ptr<skip_head<Key, T>> head;
+
+		Compare comp;
+
+		std::atomic<size_type> count;
+
+		friend struct GC::router<concurrent_map>;
+
+	private: // -- helpers -- //
+
+		static node *as_node(info *arc) noexcept { return arc ? static_cast<node*>(arc->obj) : nullptr; }
+
+		// picks the height of a new node
+		static int random_height() noexcept
+		{
+			static thread_local std::uint32_t state = static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+
+			int height = 1;
+			for (; height < max_height; ++height)
+			{
+				// xorshift32 - each extra level has a 1/4 chance
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+				if (state & 3) break;
+			}
+			return height;
+		}
+
+		// finds the last tower before key (preds) and the node after that (succs) on each level.
+		// returns the highest level key was found on (or -1 if it wasn't found).
+		// an epoch guard must be active for as long as the results are used.
+		int locate(const key_type &key, skip_tower **preds, info **succs) const
+		{
+			int found = -1;
+			skip_tower *pred = head.get();
+
+			for (int level = max_height - 1; level >= 0; --level)
+			{
+				info *curr = pred->links[level].load(std::memory_order_acquire);
+				while (curr && comp(as_node(curr)->key, key))
+				{
+					pred = as_node(curr);
+					curr = pred->links[level].load(std::memory_order_acquire);
+				}
+
+				if (found < 0 && curr && !comp(key, as_node(curr)->key)) found = level;
+				preds[level] = pred;
+				succs[level] = curr;
+			}
+
+			return found;
+		}
+
+		// gets the first node on level 0 whose key is not less than key (null if none).
+		// an epoch guard must be active for as long as the result is used.
+		info *lower_bound_arc(const key_type &key) const
+		{
+			skip_tower *pred = head.get();
+			info *curr = nullptr;
+
+			for (int level = max_height - 1; level >= 0; --level)
+			{
+				curr = pred->links[level].load(std::memory_order_acquire);
+				while (curr && comp(as_node(curr)->key, key))
+				{
+					pred = as_node(curr);
+					curr = pred->links[level].load(std::memory_order_acquire);
+				}
+			}
+
+			return curr;
+		}
+
+		// gets the node for key (null if there is none or it is not fully inserted/being removed).
+		// an epoch guard must be active for as long as the result is used.
+		node *find_node(const key_type &key) const
+		{
+			node *n = as_node(lower_bound_arc(key));
+			if (!n || comp(key, n->key)) return nullptr;
+
+			return n->fully_linked.load(std::memory_order_acquire) && !n->marked.load(std::memory_order_acquire) ? n : nullptr;
+		}
+
+		// inserts a node for key constructed from args if key is not already present - returns true iff the insertion took place.
+		// otherwise, if assign is non-null, assigns *assign to the existing node's value.
+		template<typename ...Args>
+		bool __insert(const key_type &key, const mapped_type *assign, Args &&...args)
+		{
+			GC::epoch_guard guard;
+
+			skip_tower *preds[max_height];
+			info *succs[max_height];
+
+			const int height = random_height();
+			GC::ptr<node> fresh; // the new node (created the first time we know we need it)
+
+			while (true)
+			{
+				int found = locate(key, preds, succs);
+				if (found >= 0)
+				{
+					node *n = as_node(succs[found]);
+
+					// if it's being removed, wait for it to be unlinked and try again
+					if (n->marked.load(std::memory_order_acquire)) { std::this_thread::yield(); continue; }
+
+					// otherwise wait for it to be fully inserted (at which point the insertion that created it took place)
+					while (!n->fully_linked.load(std::memory_order_acquire)) std::this_thread::yield();
+
+					if (assign)
+					{
+						std::lock_guard<std::mutex> lock(n->mutex);
+						if (n->marked.load(std::memory_order_relaxed)) continue;
+						n->value = *assign;
+					}
+					return false;
+				}
+
+				if (!fresh) fresh = GC::make<node>(height, key, std::forward<Args>(args)...);
+
+				// lock each distinct pred (equal ones are adjacent) and make sure they still link to the succs
+				std::unique_lock<std::mutex> locks[max_height];
+				bool valid = true;
+				for (int level = 0; valid && level < height; ++level)
+				{
+					skip_tower *pred = preds[level];
+					info *succ = succs[level];
+
+					if (level == 0 || pred != preds[level - 1]) locks[level] = std::unique_lock<std::mutex>(pred->mutex);
+					valid = !pred->marked.load(std::memory_order_relaxed) && pred->links[level].load(std::memory_order_relaxed) == succ
+						&& (!succ || !as_node(succ)->marked.load(std::memory_order_relaxed));
+				}
+				if (!valid) continue;
+
+				disjoint_module *const disjunction = head.handle.disjunction;
+
+				// the succs are held by the locked preds, so we can add arcs to them directly
+				for (int level = 0; level < height; ++level)
+				{
+					disjunction->raw_arc_acquire(succs[level]);
+					fresh->links[level].store(succs[level], std::memory_order_relaxed);
+				}
+				// link it in from the bottom up - the old arcs to the succs are still held by fresh, so releasing them calls no destructors
+				for (int level = 0; level < height; ++level)
+				{
+					info *arc = disjunction->raw_arc_acquire(fresh.handle);
+					disjunction->raw_arc_release(preds[level]->links[level].exchange(arc, std::memory_order_release));
+				}
+
+				fresh->fully_linked.store(true, std::memory_order_release);
+				count.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		// unlinks every node front to back (so destroying a large map doesn't recurse through the whole list).
+		// there must be no concurrent access.
+		void dismantle()
+		{
+			disjoint_module *const disjunction = head.handle.disjunction;
+			skip_tower &h = *head;
+
+			for (info *first; (first = h.links[0].load(std::memory_order_relaxed)); )
+			{
+				// the first node is first on each of its levels - hand its links over to the head so that releasing it doesn't cascade
+				const node &n = *as_node(first);
+				const int height = n.height;
+
+				for (int level = 0; level < height; ++level)
+				{
+					info *next = n.links[level].load(std::memory_order_relaxed);
+					disjunction->raw_arc_acquire(next);
+					disjunction->raw_arc_release(h.links[level].exchange(next, std::memory_order_relaxed)); // the last one can destroy n
+				}
+			}
+			count.store(0, std::memory_order_relaxed);
+		}
+
+		template<typename F>
+		void __for_each(const key_type *first, const key_type *last, F f) const
+		{
+			GC::epoch_guard guard;
+
+			info *arc = first ? lower_bound_arc(*first) : head->links[0].load(std::memory_order_acquire);
+			for (; arc; arc = as_node(arc)->links[0].load(std::memory_order_acquire))
+			{
+				node &n = *as_node(arc);
+				if (last && !comp(n.key, *last)) break;
+				if (!n.fully_linked.load(std::memory_order_acquire)) continue;
+
+				std::lock_guard<std::mutex> lock(n.mutex);
+				if (!n.marked.load(std::memory_order_relaxed)) f(n);
+			}
+		}
+
+	public: // -- ctor / dtor / asgn -- //
+
+		// creates an empty map
+		explicit concurrent_map(const key_compare &_comp = key_compare()) : head(GC::make<skip_head<Key, T>>(max_height)), comp(_comp), count(0) {}
+
+		concurrent_map(const concurrent_map&) = delete;
+		concurrent_map &operator=(const concurrent_map&) = delete;
+
+		// the collector destroys unreachable objects in no particular order, so if it's destroying the head we can't touch the nodes
+		~concurrent_map()
+		{
+			if (!head.handle.disjunction->this_is_collector_destroying(head.handle)) dismantle();
+		}
+
+	public: // -- lookup -- //
+
+		// returns a copy of the value associated with key (or empty if there is no such value)
+		std::optional<mapped_type> get(const key_type &key) const
+		{
+			GC::epoch_guard guard;
+
+			node *n = find_node(key);
+			if (!n) return std::nullopt;
+
+			std::lock_guard<std::mutex> lock(n->mutex);
+			if (n->marked.load(std::memory_order_relaxed)) return std::nullopt;
+			return n->value;
+		}
+
+		// returns true iff there is a value associated with key - this never locks
+		bool contains(const key_type &key) const
+		{
+			GC::epoch_guard guard;
+			return find_node(key) != nullptr;
+		}
+
+		// invokes f with a reference to the value associated with key under its node's lock.
+		// returns true iff there was such a value (i.e. if f was invoked).
+		// f must not modify the map, and the reference passed to f must not be used after f returns.
+		template<typename F>
+		bool visit(const key_type &key, F &&f)
+		{
+			GC::epoch_guard guard;
+
+			node *n = find_node(key);
+			if (!n) return false;
+
+			std::lock_guard<std::mutex> lock(n->mutex);
+			if (n->marked.load(std::memory_order_relaxed)) return false;
+			std::forward<F>(f)(n->value);
+			return true;
+		}
+		template<typename F>
+		bool visit(const key_type &key, F &&f) const
+		{
+			GC::epoch_guard guard;
+
+			node *n = find_node(key);
+			if (!n) return false;
+
+			std::lock_guard<std::mutex> lock(n->mutex);
+			if (n->marked.load(std::memory_order_relaxed)) return false;
+			std::forward<F>(f)(std::as_const(n->value));
+			return true;
+		}
+
+	public: // -- modifiers -- //
+
+		// inserts value if its key is not already present - returns true iff the insertion took place
+		bool insert(const value_type &value) { return __insert(value.first, nullptr, value.second); }
+
+		// constructs a value from args in place if key is not already present - returns true iff the insertion took place
+		template<typename ...Args>
+		bool try_emplace(const key_type &key, Args &&...args) { return __insert(key, nullptr, std::forward<Args>(args)...); }
+
+		// inserts value for key, or assigns it if key is already present - returns true iff an insertion took place
+		bool insert_or_assign(const key_type &key, const mapped_type &value) { return __insert(key, &value, value); }
+
+		// removes the value associated with key - returns the number of values removed (0 or 1).
+		// the removed node is retired, so readers that are still traversing it are unaffected.
+		size_type erase(const key_type &key)
+		{
+			GC::epoch_guard guard;
+
+			skip_tower *preds[max_height];
+			info *succs[max_height];
+
+			GC::ptr<node> victim; // the node we're removing (once we've marked it)
+			info *victim_arc = nullptr;
+			std::unique_lock<std::mutex> victim_lock;
+
+			while (true)
+			{
+				int found = locate(key, preds, succs);
+				if (!victim)
+				{
+					if (found < 0) return 0;
+
+					// we can only remove a node that's been fully inserted and isn't already being removed
+					node *n = as_node(succs[found]);
+					if (!n->fully_linked.load(std::memory_order_acquire) || n->height - 1 != found || n->marked.load(std::memory_order_acquire)) return 0;
+
+					victim_lock = std::unique_lock<std::mutex>(n->mutex);
+					if (n->marked.load(std::memory_order_relaxed)) return 0;
+					n->marked.store(true, std::memory_order_release);
+
+					// hold it while unlinking (this puts it through the write barrier, as the collector might not have seen it yet)
+					victim_arc = succs[found];
+					victim = GC::ptr<node>(n, victim_arc, GC::raw_arc);
+				}
+				const int height = victim->height;
+
+				// lock each distinct pred (equal ones are adjacent) and make sure they still link to the victim
+				{
+					std::unique_lock<std::mutex> locks[max_height];
+					bool valid = true;
+					for (int level = 0; valid && level < height; ++level)
+					{
+						skip_tower *pred = preds[level];
+
+						if (level == 0 || pred != preds[level - 1]) locks[level] = std::unique_lock<std::mutex>(pred->mutex);
+						valid = !pred->marked.load(std::memory_order_relaxed) && pred->links[level].load(std::memory_order_relaxed) == victim_arc;
+					}
+					if (!valid) continue;
+
+					disjoint_module *const disjunction = head.handle.disjunction;
+
+					// unlink it from the top down - its own links are left intact for readers that are still traversing it.
+					// the victim handle keeps it alive, so releasing the preds' arcs to it calls no destructors.
+					for (int level = height - 1; level >= 0; --level)
+					{
+						info *next = victim->links[level].load(std::memory_order_relaxed);
+						disjunction->raw_arc_acquire(next);
+						preds[level]->links[level].store(next, std::memory_order_release);
+						disjunction->raw_arc_release(victim_arc);
+					}
+				}
+				victim_lock.unlock();
+
+				count.fetch_sub(1, std::memory_order_relaxed);
+				GC::retire(victim);
+				return 1;
+			}
+		}
+
+		// removes all values - each removal is atomic, but not the clear as a whole
+		void clear()
+		{
+			while (true)
+			{
+				std::optional<key_type> key;
+				{
+					GC::epoch_guard guard;
+
+					info *first = head->links[0].load(std::memory_order_acquire);
+					if (!first) return;
+					key = as_node(first)->key;
+				}
+				// if it's already being removed, this just waits for that to finish (on the next locate)
+				if (erase(*key) == 0) std::this_thread::yield();
+			}
+		}
+
+	public: // -- ordered traversal -- //
+
+		// invokes f with each key and (a reference to) its value in ascending key order - each node is locked while it's being visited.
+		// values inserted/removed concurrently may or may not be visited.
+		// f must not modify the map, and the references passed to f must not be used after f returns.
+		template<typename F>
+		void for_each(F f) { __for_each(nullptr, nullptr, [&](node &n) { f(n.key, n.value); }); }
+		template<typename F>
+		void for_each(F f) const { __for_each(nullptr, nullptr, [&](node &n) { f(n.key, std::as_const(n.value)); }); }
+
+		// as for_each(), but only visits the keys in the range [first, last)
+		template<typename F>
+		void for_each_in_range(const key_type &first, const key_type &last, F f) { __for_each(&first, &last, [&](node &n) { f(n.key, n.value); }); }
+		template<typename F>
+		void for_each_in_range(const key_type &first, const key_type &last, F f) const { __for_each(&first, &last, [&](node &n) { f(n.key, std::as_const(n.value)); }); }
+
+	public: // -- size -- //
+
+		// gets the number of values - this is only a snapshot if there are no concurrent mutators
+		size_type size() const noexcept { return count.load(std::memory_order_relaxed); }
+		bool empty() const noexcept { return size() == 0; }
+
+		key_compare key_comp() const { return comp; }
+	};
+
+	// routes a message directed at a concurrent_map head to its links
+	template<typename Key, typename T>
+	struct router<skip_head<Key, T>>
+	{
+		template<typename F> static void route(const skip_head<Key, T> &head, F func) { head.route_links(func); }
+	};
+	template<typename Key, typename T>
+	struct router<skip_node<Key, T>>
+	{
+		// the links and key can be routed without a lock, but the value is synchronized by the node's mutex
+		template<typename F> static void route(const skip_node<Key, T> &node, F func)
+		{
+			node.route_links(func);
+			GC::route(node.key, func);
+			GC::router_lock_t<std::mutex> lock(node.mutex);
+			GC::route(node.value, func);
+		}
+	};
+
+	// routes a message directed at a concurrent_map to its head (the nodes are routed through their links)
+	template<typename Key, typename T, typename Compare>
+	struct router<concurrent_map<Key, T, Compare>>
+	{
+		template<typename F> static void route(const concurrent_map<Key, T, Compare> &map, F func) { GC::route(map.head, func); }
+	};
+
+public: // -- gc-specific threading stuff -- //
+
+	// specifies that the new thread should use the primary disjunction (i.e. the one created on initial program start - what the primary thread uses).
+	// this is what std::thread and any other os-specific threading utility uses (only because they can't be overridden in standard C++).
+	// you'll probably want to avoid using this option - inherit_disjunction is almost always the better, faster, safer choice.
+	static struct primary_disjunction_t {} primary_disjunction;
+	// specifies that the new thread should inherit its parent's disjunction.
+	static struct inherit_disjunction_t {} inherit_disjunction;
+	// specifies that the new thread should be in its own (new) disjunction.
+	static struct new_disjunction_t {} new_disjunction;
+
+	class thread
+	{
+	private: // -- data -- //
+
+		std::thread t; // the wrapped thread
+
+	public: // -- typedefs -- //
+
+		typedef std::thread::native_handle_type native_handle_type;
+		
+		typedef std::thread::id id;
+
+	public: // -- ctor / dtor / asgn --//
+
+		thread() noexcept = default;
+		~thread() = default;
+
+		thread(thread &&other) noexcept : t(std::move(other.t)) {}
+		thread(std::thread &&other) noexcept : t(std::move(other)) {}
+
+		thread &operator=(thread &&other) noexcept { t = std::move(other.t); return *this; }
+		thread &operator=(std::thread &&other) noexcept { t = std::move(other); return *this; }
+
+		template<typename Function, typename ...Args>
+		explicit thread(primary_disjunction_t, Function &&f, Args &&...args) : t(std::forward<Function>(f), std::forward<Args>(args)...) {}
+
+		template<typename Function, typename ...Args>
+		explicit thread(inherit_disjunction_t, Function &&f, Args &&...args) : t([](shared_disjoint_handle &&parent_module, std::decay_t<Function> &&ff, std::decay_t<Args> &&...fargs)
+		{
+			// now that we're a new thread, repoint our local disjunction handle to our parent.
+			// the danger with non-primary/local shared handles is if the non-primary/local shared handle is the last to be destroyed.
+			// this isn't a problem in this case because we can move the non-primary/local handle (func arg) into the local handle slot.
+			disjoint_module::local_handle() = std::move(parent_module);
+
+			// then invoke the user function
+			std::invoke(std::move(ff), std::move(fargs)...);
+
+		}, disjoint_module::local_handle(), std::forward<Function>(f), std::forward<Args>(args)...)
+		{}
+
+		template<typename Function, typename ...Args>
+		explicit thread(new_disjunction_t, Function &&f, Args &&...args) : t([](std::decay_t<Function> &&ff, std::decay_t<Args> &&...fargs)
+		{
+			// now that we're a new thread, repoint our local disjunction handle to a new disjunction
+			disjoint_module_container::get().create_new_disjunction(disjoint_module::local_handle());
+
+			// then invoke the user function
+			std::invoke(std::move(ff), std::move(fargs)...);
+
+		}, std::forward<Function>(f), std::forward<Args>(args)...)
+		{}
+
+	public: // -- observers -- //
+
+		bool joinable() const noexcept { return t.joinable(); }
+
+		std::thread::id get_id() const noexcept { return t.get_id(); }
+
+		native_handle_type native_handle() { return t.native_handle(); }
+
+		static unsigned int hardware_concurrency() noexcept { return std::thread::hardware_concurrency(); }
+
+	public: // -- operations -- //
+
+		void join() { t.join(); }
+
+		void detach() { t.detach(); }
+
+		void swap(thread &other) noexcept { t.swap(other.t); }
+		void swap(std::thread &other) noexcept { t.swap(other); }
+
+		friend void swap(thread &a, thread &b) noexcept { using std::swap; swap(a.t, b.t); }
+		friend void swap(thread &a, std::thread &b) noexcept { using std::swap; swap(a.t, b); }
+		friend void swap(std::thread &a, thread &b) noexcept { using std::swap; swap(a, b.t); }
+	};
+
+public: // -- collection logic utilities -- //
+
+	// a sentry object that controls the ignore feature of GC::collect().
+	// on construction, begins an ignore action; on destruction ends it.
+	// while this object exists, calls to GC::collect() from any thread bound to the same disjoint gc module will be ignored.
+	// this is typically only used for preventing deadlock situations caused by calling GC::collect() while a router mutex is held.
+	class ignore_collect_sentry
+	{
+	private: // -- data -- //
+
+		std::size_t prev_count;
+
+		// the disjunction this object was constructed in.
+		// must be used for disjoint utility functions involving this object.
+		disjoint_module *const disjunction;
+
+	public: // -- ctor / dtor / asgn -- //
+
+		ignore_collect_sentry() : disjunction(disjoint_module::local()) { prev_count = disjunction->begin_ignore_collect(); }
+		~ignore_collect_sentry() { disjunction->end_ignore_collect(); }
+
+		// returns true iff there were no ignore actions in progress prior to the start of this one.
+		bool no_prev_ignores() const noexcept { return prev_count == 0; }
+	};
+
+	// a sentry object that marks a read-side section for epoch-based reclamation (see GC::retire()).
+	// any gc object that was reachable when read inside this section (even via raw pointer) remains alive until this object is destroyed,
+	// so long as the thread that unlinks it from its data structure retires it rather than simply dropping its reference.
+	// this is meant for lock-free structures over gc objects, where rooting every traversal step with a GC::ptr would be too expensive.
+	// epoch guards are meant to be short-lived - retired objects are held until all guards that could view them have ended.
+	class epoch_guard
+	{
+	private: // -- data -- //
+
+		std::size_t phase;
+
+		// the disjunction this object was constructed in.
+		// must be used for disjoint utility functions involving this object.
+		disjoint_module *const disjunction;
+
+	public: // -- ctor / dtor / asgn -- //
+
+		epoch_guard() : disjunction(disjoint_module::local()) { phase = disjunction->begin_epoch_guard(); }
+		~epoch_guard() { disjunction->end_epoch_guard(phase); }
+
+		epoch_guard(const epoch_guard&) = delete;
+		epoch_guard &operator=(const epoch_guard&) = delete;
+	};
+
+	// retires the object referenced by p (which should have just been unlinked from a shared data structure).
+	// the object will not be released by the retire logic until every epoch guard active in the calling thread's disjunction has ended.
+	// if p is null, does nothing.
+	template<typename T>
+	static void retire(const GC::ptr<T> &p)
+	{
+		if (p) disjoint_module::local()->retire(p);
+	}
+
+private: // -- containers -- //
+
+	// a container of info objects - implemented as a doubly-linked list for fast removal from the middle.
+	// this container has no internal synchronization and is thus not thread safe.
+	class obj_list
+	{
+	private: // -- data -- //
+
+		info *first; // pointer to the first object
+		info *last;  // pointer to the last object
+
+	public: // -- ctor / dtor / asgn -- //
+
+		// creates an empty obj list
+		obj_list();
+
+		// destroys the container but does not release resources - see unsafe_clear()
+		~obj_list() = default;
+
+		obj_list(const obj_list&) = delete;
+		obj_list &operator=(const obj_list&) = delete;
+
+	public: // -- access -- //
+
+		// gets the first info object - null if there is none.
+		// this is supplied for enabling iteration - any non-null value is a valid node.
+		info *front() const { return first; }
+
+		// adds obj to this database - und. if obj already belongs to one or more databases.
+		void add(info *obj);
+		// removes obj from this database - und. if obj does not belong to this database.
+		void remove(info *obj);
+
+		// merges the contents of other with the contents of this.
+		// if other refers to this object, does nothing.
+		// otherwise, other is guaranteed to be empty after this operation.
+		void merge(obj_list &&other);
+
+		// sets the contents of the list to empty without deallocating resources.
+		// this should only be used if you're handling resource deallocation yourself.
+		void unsafe_clear() { first = last = nullptr; }
+
+		// returns true iff the container is empty
+		bool empty() const noexcept { return !first; }
+
+		// returns true iff obj is contained in this list.
+		// this is O(n) and for efficiency reasons should only be used in debug code.
+		bool contains(info *obj) const noexcept;
+	};
+
+private: // -- sentries -- //
+
+	// a sentry for an atomic flag.
+	// on construction, sets the flag and gets the previous value; on destruction, clears the flag if it was successfully taken.
+	// conversion of the sentry to bool gets if the flag was successfully taken (i.e. if it was previously false)
+	struct atomic_flag_sentry
+	{
+	private: // -- data -- //
+
+		std::atomic_flag &_flag;
+		bool _value;
+
+	public: // -- interface -- //
+
+		explicit atomic_flag_sentry(std::atomic_flag &flag) : _flag(flag)
+		{
+			_value = _flag.test_and_set();
+		}
+		~atomic_flag_sentry()
+		{
+			if (!_value) _flag.clear();
+		}
+
+		explicit operator bool() const noexcept { return !_value; }
+		bool operator!() const noexcept { return _value; }
+	};
+
+private: // -- gc disjoint module -- //
+
+	class shared_disjoint_handle;
+	class weak_disjoint_handle;
+	class disjoint_module_container;
+	struct handle_data;
+
+	// provides the gc logic for all objects from a single disjunction.
+	// i.e. all objects and GC::ptr info from the set of all threads that can share gc objects with one another.
+	// it is undefined behavior to point to or access a gc object from a different disjunction.
+	class disjoint_module
+	{
+	private: // -- synchronization -- //
+
+		std::mutex internal_mutex; // mutex used only for internal synchronization
+
+		std::thread::id collector_thread; // the thread id of the collector - none implies no collection is currently processing
+
+		std::size_t ignore_collect_count = 0; // the number of sources requesting collect actions to be ignored for this module
+
+		std::condition_variable collect_cv; // notified (under internal_mutex) each time a collection action on this module terminates
+
+	private: // -- collector-only resources -- //
+
+		// these objects represent a snapshot of the object graph for use by the collector.
+		// the current collector thread need not lock any mutex to use these resources.
+		// if you LOCK internal_mutex and find there's NO current collection action, you can modify them.
+		
+		// the list of all objects currently under gc consideration.
+		// during a collection action, any unreachable object in this list is subject to deletion.
+		obj_list objs;
+
+		// the set of all rooted handles - DO NOT USE THIS FOR COLLECTION LOGIC.
+		// the roots in this set are subject to deletion by arbitrary running threads after the sentry construction.
+		// instead, you should use root_objs, which is guaranteed to be safe during the full collection action.
+		// note: a root is the address of an info* (i.e. info**) not the info* itself.
+		// this is because the same rooted handle can be repointed to a different object and still be a root.
+		// this is what supplies information to the root_objs set for the collector.
+		std::unordered_set<info*const*> roots;
+
+		// the set of all objects that are pointed-to by rooted handles (guaranteed not to contain null).
+		// this should not be modified directly - should only be manipulated by a valid sentry.
+		// this is a set to facilitate fast removal and to ensure there are no duplicates (efficiency).
+		// this is separate from the roots set for two reasons:
+		// 1) it's more convenient / efficient to perform the sweep logic in terms of objects.
+		// 2) if the (rooted) handle the root obj was sourced from is destroyed, said (rooted) handle ceases to exist.
+		//    this would be a problem later on in the collector, as we'd need to dereference the handle to get the obj to sweep.
+		//    but with this approach that's not an issue for the collector, because it won't ever need to be dereferenced again.
+		//    and we know the root obj won't be destroyed because the collector is the only one allowed to do that.
+		std::unordered_set<info*> root_objs;
+
+		// the list of objects that should be destroyed after a collector pass.
+		// this should not be modified directly - should only be manipulated by a valid sentry.
+		// when an object is marked for deletion (i.e. unreachable) it is removed from objs and added to this list.
+		// the sentry dtor will handle the logic of deleting the objects.
+		obj_list del_list;
+
+	private: // -- modified caches -- //
+
+		// these are like caches (see below) but have special rules.
+		// for proper usage, read each modified cache's associated comments.
+
+		// controls ref count deletion behavior:
+		// if false, delete the objects immediately.
+		// if true, cache the request in ref_count_del_cache.
+		// thus if false, the cache is considered a collector-only resource and must not be modified.
+		// if this is false, it is safe to directly modify the obj list under normal mutex lock.
+		bool cache_ref_count_del_actions = false;
+
+		// the shared resource cache for ref count deletion actions.
+		// objects in this cache MUST currently be in the obj list (NOT in the obj add cache).
+		// DO NOT unlink objects from the obj list when you put them in this list (just a cache).
+		// see cache_ref_count_del_actions for how to use this cache properly.
+		std::unordered_set<info*> ref_count_del_cache;
+
+		// the objects that gained a raw arc (or a handle sourced from a raw arc) during the current collection action (see ptr_vector).
+		// unlike handles, raw arcs are not snapshotted, so the collector must mark these objects before sweeping (write barrier).
+		// this also holds the (snapshot) targets of handles destroyed during the collection action (see schedule_handle_destroy).
+		// objects in the obj add cache are never added (they're not under gc consideration).
+		// if there's no collection action in progress, this must be empty.
+		std::unordered_set<info*> raw_arc_barrier_cache;
+
+		// the number of objects condemned by ref count deletion logic (outside of a collection action) that haven't pinned their arcs yet (see pinned_objs).
+		// a collection that starts in the meantime must not sweep until this is zero.
+		// there can't be new ones while ref count deletions are cached, so the collector never waits long.
+		std::atomic<std::size_t> unpinned_count{ 0 };
+
+		// the targets of the arcs out of condemned objects whose destructors are running (each with its number of pins).
+		// those arcs are neither rooted nor reachable, so these are treated as roots to keep a collection from freeing them out from under the destructors.
+		// each pin holds a reference count, and pins taken during a collection action go through the write barrier.
+		// this can be modified at any time so long as internal_mutex is locked.
+		std::unordered_map<info*, std::size_t> pinned_objs;
+
+		// the bound weak slots, keyed by target - each value is the head of a list of slots (see weak_slot).
+		// when a target is condemned its slots are expired and its entry is removed.
+		// this can be modified at any time so long as internal_mutex is locked.
+		std::unordered_map<info*, weak_slot*> weak_slots;
+
+	private: // -- caches -- //
+
+		// these objects can be modified at any time so long as internal_mutex is locked.
+		// operations on these objects should be non-blocking (don't call arbitrary code while it's locked).
+		// among these are several caches:
+		// all actions must be non-blocking, but if there's currently a collector thread you can't modify the collector-only resources.
+		// thus, in these cases you add the action info to a cache, which will be applied when the collection action terminates.
+		// additionally, if there's NOT a collection action in progress, you MUST apply the change immediately (do not cache it).
+		// this is because the caches are only flushed upon termination of a collect action, not before one begins.
+
+		// the scheduled obj add operations.
+		// used by new obj insertion during a collection action.
+		std::unordered_set<info*> objs_add_cache;
+
+		// the scheduled root add/remove operations.
+		// these sets must at all times be disjoint.
+		std::unordered_set<info*const*> roots_add_cache;
+		std::unordered_set<info*const*> roots_remove_cache;
+
+		// cache used to support non-blocking handle repoint actions.
+		// it is structured such that M[&raw_handle] is what it should be repointed to.
+		std::unordered_map<info**, info*> handle_repoint_cache; 
+
+	private: // -- epoch reclamation -- //
+
+		// these objects implement the epoch_guard / retire() api.
+		// they are modified under epoch_mutex (separate from internal_mutex because releasing a retired object calls arbitrary code).
+
+		// an object that was retired while epoch guards were active.
+		// it must be kept alive until each phase it's waiting for has been drained the required number of times.
+		struct retired_obj
+		{
+			GC::ptr<void> obj;
+			std::size_t wait_for[2];
+		};
+
+		std::mutex epoch_mutex;
+
+		std::size_t epoch_phase = 0;                // the phase new epoch guards register under
+		std::size_t epoch_guards[2] = { 0, 0 };     // the number of active epoch guards registered under each phase
+		std::size_t epoch_drains[2] = { 0, 0 };     // the number of times each phase's guard count has fallen to zero
+
+		std::vector<retired_obj> retired_objs;      // retired objects that could still be viewed by an active epoch guard
+
+	public: // -- ctor / dtor / asgn -- //
+
+		disjoint_module() = default;
+
+		~disjoint_module();
+
+		disjoint_module(const disjoint_module&) = delete;
+		disjoint_module &operator=(const disjoint_module&) = delete;
+
+	public: // -- interface -- //
+
+		// performs a collection action on (only) this disjoint gc module.
+		// returns false iff another thread is performing a collection on this module.
+		bool collect();
+		// performs a blocking collection - USE WITH IMMENSE CAUTION.
+		// if another thread is performing a collection on the current module, waits for it to finish before collecting.
+		// semantically equivalent to "while (!collect()) ;" but sleeps on collect_cv rather than spinning.
+		void blocking_collect();
+
+		// returns true iff the calling thread is the current collector thread for (only) this disjoint module
+		bool this_is_collector_thread();
+		// returns true iff the calling thread is the current collector thread for (only) this disjoint module and handle's target is one of the unreachable objects it is destroying.
+		// destructors running in this phase must not access unreachable gc objects (they may have already been destroyed).
+		bool this_is_collector_destroying(const smart_handle &handle);
+
+		// schedules a handle creation action that points to null.
+		// raw_handle need not be initialized prior to this call.
+		void schedule_handle_create_null(smart_handle &handle);
+		// schedules a handle creation action that points to a new object - inserts new_obj into the obj database.
+		// new_obj must not already exist in the gc database (see create alias below).
+		// the reference count for new_obj is initialized to 1.
+		// raw_handle need not be initialized prior to this call.
+		void schedule_handle_create_bind_new_obj(smart_handle &handle, info *new_obj);
+		// schedules a handle creation action that points at a pre-existing handle - marks the new handle as a root.
+		// raw_handle need not be initialized prior to this call.
+		// increments the reference count of the referenced target.
+		void schedule_handle_create_alias(smart_handle &raw_handle, const smart_handle &src_handle);
+		// schedules a handle creation action that points at target, which must currently be held by a raw arc (see ptr_vector) - marks the new handle as a root.
+		// raw_handle need not be initialized prior to this call.
+		// increments the reference count of target (allowed to be null).
+		void schedule_handle_create_raw_arc(smart_handle &handle, info *target);
+
+		// schedules a handle deletion action - unroots the handle and purges it from the handle repoint cache.
+		// for any call to schedule_handle_create_*(), said handle must be sent here before the end of its lifetime.
+		// calling this function implies that the handle no longer exists as far as the gc systems are concerned.
+		// reference counting and other gc logic will commence due to the gc reference being destroyed.
+		void schedule_handle_destroy(const smart_handle &handle);
+
+		// schedules a handle unroot operation - unmarks handle as a root.
+		void schedule_handle_unroot(const smart_handle &raw_handle);
+
+		// schedules a handle repoint action.
+		// handle shall eventually be repointed to null before the next collection action.
+		// automatically performs reference counting logic.
+		void schedule_handle_repoint_null(smart_handle &handle);
+		// schedules a handle repoint action.
+		// handle shall eventually be repointed to new_value before the next collection action.
+		// automatically performs reference counting logic.
+		void schedule_handle_repoint(smart_handle &handle, const smart_handle &new_value);
+		// schedules a handle repoint action that swaps the pointed-to info objects of two handles atomically.
+		// handle_a shall eventually point to whatever handle_b used to point to and vice versa.
+		void schedule_handle_repoint_swap(smart_handle &handle_a, smart_handle &handle_b);
+
+		// acquires a raw arc to the current target of src for storage in an object from this disjunction (see ptr_vector).
+		// increments the reference count of the target and returns it (null if src is null).
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the target is in a different disjunction.
+		info *raw_arc_acquire(const smart_handle &src);
+		// acquires an additional raw arc to target (allowed to be null), which must currently be held by a raw arc.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the target is in a different disjunction.
+		void raw_arc_acquire(info *target);
+		// releases a raw arc to target (allowed to be null) - performs reference counting logic.
+		void raw_arc_release(info *target);
+		// releases raw arcs to targets (allowed to be null) that are being taken out of an object, but defers destroying them.
+		// this must be done before the object can be routed without them (e.g. while still holding its router lock).
+		// otherwise a collection could route past the object while they're only held by the caller and sweep them before they're released.
+		// the targets that need to be destroyed are moved to the front of targets - returns how many there are.
+		std::size_t raw_arc_detach(info **targets, std::size_t count);
+		// destroys the first count targets from a call to raw_arc_detach() - this calls arbitrary code (destructors), so no locks should be held.
+		void raw_arc_destroy(info *const *targets, std::size_t count);
+
+		// initializes handle to the target of slot (null if expired) and marks it as a root.
+		// the target (if any) goes through the write barrier, as it might be an unreachable object that is being revived during a collection action.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the slot is from a different disjunction.
+		void schedule_handle_create_weak(smart_handle &handle, const weak_slot &slot);
+		// binds slot (which must not currently be bound) to the current target of src, which must be non-null.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if the target is in a different disjunction.
+		void weak_bind(weak_slot &slot, const smart_handle &src);
+		// unbinds slot from its target (does nothing if it already expired or was never bound).
+		void weak_unbind(weak_slot &slot);
+		// checks if slot is bound and has not yet expired
+		bool weak_alive(const weak_slot &slot);
+		// checks each of count slots as with weak_alive(), storing the results in alive - this takes the lock only once for the whole batch.
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if any slot is from a different disjunction.
+		void weak_alive(const weak_slot *const *slots, std::size_t count, bool *alive);
+		// acquires raw arcs to the targets of count slots (see raw_arc_acquire()), storing them in targets (null for expired slots).
+		// this revives the targets like creating a GC::ptr from each slot would, but takes the lock only once and roots nothing.
+		// the arcs must later be released (e.g. by raw_arc_detach() and raw_arc_destroy()).
+		// if DISJUNCTION_SAFETY_CHECKS are enabled, throws GC::disjunction_error if any slot is from a different disjunction.
+		void weak_acquire(const weak_slot *const *slots, std::size_t count, info **targets);
+
+		// begins an ignore collect action for this disjoint module.
+		// returns the number of (active) ignore collect actions prior to the start of this one.
+		// e.g. if this returns zero there were no prior ignore collect actions.
+		// the same thread that called this must later call end_ignore_collect() exactly once.
+		std::size_t begin_ignore_collect();
+		// ends an ignore collect action that was previously started by the calling thread.
+		void end_ignore_collect();
+
+		// begins an epoch guard on this disjoint module and returns the phase it was registered under.
+		// the same thread that called this must later call end_epoch_guard() exactly once with the returned phase.
+		std::size_t begin_epoch_guard();
+		// ends an epoch guard that was previously started by the calling thread.
+		// releases any retired objects that can no longer be viewed by an active epoch guard.
+		void end_epoch_guard(std::size_t phase);
+
+		// retires obj - it will be kept alive until every epoch guard that is currently active on this disjoint module has ended.
+		// if there are no active epoch guards, it is released immediately.
+		void retire(const GC::ptr<void> &obj);
+
+	private: // -- epoch reclamation helpers -- //
+
+		// if the non-current phase has no guards and there are retired objects, moves new guards over to it so the current phase can drain.
+		// epoch_mutex must be locked prior to invocation.
+		void __epoch_try_flip();
+		// moves all the retired objects that are safe to release into dest.
+		// epoch_mutex must be locked prior to invocation.
+		void __epoch_collect_released(std::vector<GC::ptr<void>> &dest);
+
+	private: // -- private interface (unsafe) -- //
+		
+		// marks handle as a root - internal_mutex should be locked
+		void __schedule_handle_root(const smart_handle &handle);
+		// unmarks handle as a root - internal_mutex should be locked
+		void __schedule_handle_unroot(const smart_handle &handle);
+
+		// the underlying function for all handle repoint actions.
+		// handles the logic of managing the repoint cache for repointing handle to target.
+		// DOES NOT HANDLE REFERENCE COUNT LOGIC - DO THAT ON YOUR OWN.
+		void __raw_schedule_handle_repoint(smart_handle &handle, info *target);
+
+		// applies the raw arc write barrier to target (allowed to be null) - see raw_arc_barrier_cache.
+		// internal_mutex should be locked.
+		void __raw_arc_barrier(info *target);
+
+		// expires all the weak slots bound to target (which is being condemned) - see weak_slots.
+		// internal_mutex should be locked.
+		void __weak_expire(info *target);
+
+		// gets the current target info object of new_value.
+		// otherwise returns the current repoint target if it's in the repoint database.
+		// otherwise returns the current pointed-to value of value.
+		info *__get_current_target(const smart_handle &handle);
+
+		// performs the reference count decrement logic on target (allowed to be null).
+		// internal_lock is the (already-owned) lock on internal_mutex that was taken previously.
+		// you should do all your other work first before calling this.
+		// if the reference count falls to zero and there's no collection action, deletes the object.
+		// otherwise does nothing (aside from the reference count decrement).
+		// handles all deletion logic internally.
+		// THIS MUST BE THE LAST THING YOU DO UNDER INTERNAL_MUTEX LOCK.
+		void __MUST_BE_LAST_ref_count_dec(info *target, std::unique_lock<std::mutex> internal_lock);
+
+		// performs the ref count deletion logic on target, whose reference count just fell to zero.
+		// returns true if the caller must destroy it with destroy_condemned() (once unlocked), otherwise the collector deletes it later.
+		bool __condemn(info *target);
+		// destroys and deallocates count objects that __condemn() returned true for - this calls arbitrary code (destructors), so no locks should be held.
+		// the targets of their arcs are pinned (see pinned_objs) until their destructors are done, then released (which can condemn more objects).
+		void destroy_condemned(info *const *targets, std::size_t count);
+
+	private: // -- factory accessor shared data -- //
+
+		// the repoint target for the local disjunction.
+		// this is only meant to be used by logic internally imbedded within the below factory accessor functions.
+		// this is not atomic because it's only modified during the dtor of the primary disjunction at static dtor time, and thus threads are not expected to exist.
+		// if this is null, use local_handle().get(), otherwise use this (a detour around the destroyed therad_local local handle object which would otherwise point to the same object).
+		static disjoint_module *local_detour;
+
+		// the module currently being torn down by the calling thread (see disjoint_module_container::teardown()).
+		// while non-null this takes precedence over local_detour and the local handle.
+		// this is a raw pointer (trivially destructible) so it remains usable even after the thread_local dtors have run.
+		static thread_local disjoint_module *teardown_detour;
+
+		friend class disjoint_module_container;
+
+	public: // -- factory accessors -- //
+
+		// gets the primary disjunction - the default one that all threads use unless instructed otherwise.
+		// this has static storage duration - thus this disjoint module's lifetime is the entire program lifetime.
+		static const shared_disjoint_handle &primary_handle();
+		// gets the disjunction that the calling thread belongs to.
+		// this has thread_local storage duration - references/pointers to the handle itself should not be passed between threads.
+		// IF THIS IS EVER REPOINTED IT MUST HAPPEN PRIOR TO CALLING ANY GC MANAGEMENT FUNCTIONS FROM THE CALLING THREAD!!
+		// the only valid repoint targets are sourced from disjoint_module_container::create_new_disjunction().
+		// CALLS TO THIS FUNCTION AFTER THE LIFETIME OF THREAD_LOCAL OBJECTS IN A GIVEN THREAD HAVE EXPIRED (E.G. WITHIN STATIC DTORS) IS UNDEFINED BEHAVIOR - SEE local_raw()).
+		// THIS SHOULD ONLY BE USED IF THE LOCAL THREAD IS GUARANTEED TO BE ALIVE (still running non-dtor code) - WHENEVER POSSIBLE, USE local() INSTEAD.
+		static shared_disjoint_handle &local_handle();
+
+		// gets a pointer to the primary disjunction.
+		static disjoint_module *primary();
+		// gets a pointer to the local disjunction.
+		// works properly even if the local handle has already been destroyed (e.g. for use in static dtors).
+		static disjoint_module *local();
+	};
+
+	// holds the info concerning all allocated disjunctions across all threads - including the primary disjunction.
+	// this is the only source for creating new disjunctions.
+	// this is used by the background collector to perform batch collections accross all threads.
+	class disjoint_module_container
+	{
+	private: // -- data -- //
+
+		std::mutex internal_mutex;
+		
+		// flag that marks if we're performing a collection action.
+		bool collecting = false;
+
+		// all the stored disjunctions.
+		// this can be modfied under internal_mutex lock unless in collecting mode.
+		// in collecting mode this is considered a collector-only resource.
+		std::list<weak_disjoint_handle> disjunctions;
+
+		// all the cached disjunction insertion actions.
+		// this can be modified under internal_mutex lock.
+		// unless in collecting mode, this cache must at all times be empty.
+		std::list<weak_disjoint_handle> disjunction_add_cache;
+
+		// disjunctions whose last strong owner has been severed and are awaiting their final collection/destruction.
+		// each entry holds one weak reference on behalf of the teardown logic - see teardown().
+		// this can be modified under internal_mutex lock.
+		std::vector<handle_data*> teardown_queue;
+
+		// the number of teardown_queue entries that have been removed from the queue but not yet torn down.
+		// this can be modified under internal_mutex lock.
+		std::size_t teardowns_in_progress = 0;
+
+		// marks that static destruction has begun - no more background collection passes may be started.
+		// from this point on teardowns are performed synchronously by whoever severs the last strong owner.
+		bool shutting_down = false;
+
+		// notified (under internal_mutex) whenever teardown_queue gains an entry, a teardown completes, or a collection pass ends
+		std::condition_variable background_cv;
+
+	private: // -- ctor / dtor / asgn -- //
+
+		disjoint_module_container() = default;
+		~disjoint_module_container() = default;
+
+		disjoint_module_container(const disjoint_module_container&) = delete;
+		disjoint_module_container &operator=(const disjoint_module_container&) = delete;
+
+	private: // -- teardown -- //
+
+		// performs the final collection on the disjunction and destroys its module, then releases the weak reference held on its behalf.
+		// the calling thread is temporarily detoured to the dying module so that dtors run during the collection see the right disjunction.
+		// data must have no (non-lock) strong references, and the caller must own a weak reference to it (which is consumed).
+		static void teardown(handle_data *data);
+
+		// pops one entry from the teardown queue and tears it down - returns false if the queue was empty.
+		// internal_lock must be a lock on internal_mutex - it is temporarily released while tearing down.
+		bool __teardown_one(std::unique_lock<std::mutex> &internal_lock);
+
+	public: // -- interface -- //
+
+		// gets the (only) disjoint module container instance
+		static disjoint_module_container &get() { static disjoint_module_container c; return c; }
+
+		// creates a new disjunction and stores it to dest.
+		// this is the only valid repoint target for the local disjunction handle.
+		void create_new_disjunction(shared_disjoint_handle &dest);
+
+		// performs a collection pass for all stored dynamic disjunctions.
+		// additionally performs culling logic for dangling disjunction handles.
+		// THIS MUST ONLY BE INVOKED BY THE BACKGROUND COLLECTOR!!
+		// this is because the internals of this function will repoint the local disjunction handle all over the place and leave it severed.
+		// if collect is true, performs a collection on each stored disjunction, otherwise only culls dangling handles.
+		void BACKGROUND_COLLECTOR_ONLY___collect(bool collect);
+
+		// blocks until the specified time point, tearing down severed disjunctions as they are scheduled in the meantime.
+		// THIS MUST ONLY BE INVOKED BY THE BACKGROUND COLLECTOR!!
+		void BACKGROUND_COLLECTOR_ONLY___wait_until(std::chrono::steady_clock::time_point time);
+
+		// schedules the final collection and destruction of a disjunction whose last strong owner was just severed.
+		// the caller must have converted its strong reference into a weak reference, which is handed off to the teardown logic.
+		// normally this is handed off to the background collector so that exiting threads don't block on the final collection.
+		// during static dtors (where the background collector cannot be relied upon) the teardown is instead performed synchronously.
+		void schedule_teardown(handle_data *data);
+
+		// stops the background collector from starting any further collection passes and waits for the current one (if any) to finish.
+		// then synchronously tears down all scheduled disjunctions and waits for any in-progress teardowns to complete.
+		// this is used at static dtor time to ensure all severed disjunctions are destroyed before program termination.
+		void shutdown();
+	};
+
+	// data object used by shared/weak disjoint handles - entirely externally-managed
+	struct handle_data
+	{
+	public: // -- data / types -- //
+
+		// buffer for holding the module - empty on construction - must be empty before destruction of this object
+		alignas(disjoint_module) char buffer[sizeof(disjoint_module)];
+
+		// type used to represent the tag block
+		typedef std::uint64_t tag_t;
+
+		// the bitfield tag used to represent the 3 types of reference counts on this object.
+		// this takes the form [high bits: lock][weak][low bits: strong]
+		// the utility functions tag_add() and tag_sub() optionally perform additional und testing - i suggest using those instead.
+		// the logic that destroys the module owns a weak reference until it is done, so whoever drops the last weak reference deletes the data block.
+		std::atomic<tag_t> tag = {0};
+
+	public: // -- constants -- //
+
+		static constexpr tag_t strong_bits = 56; // number of bits in the strong field
+		static constexpr tag_t weak_bits = 4;   // number of bits in the weak field
+		static constexpr tag_t lock_bits = 4;   // number of bits in the lock field
+
+		static_assert(strong_bits + weak_bits + lock_bits <= CHAR_BIT * sizeof(tag_t), "handle data bit field problem");
+
+		static constexpr tag_t strong_1 = (tag_t)1 << (0);                     // corresponds to a 1 in the strong field - can be or'd with other 1 values
+		static constexpr tag_t weak_1 = (tag_t)1 << (strong_bits);             // corresponds to a 1 in the weak field - can be or'd with other 1 values
+		static constexpr tag_t lock_1 = (tag_t)1 << (strong_bits + weak_bits); // corresponds to a 1 in the lock field - can be or'd with other 1 values
+
+		static constexpr tag_t strong_mask = (((tag_t)1 << strong_bits) - 1) << (0);                   // the mask for the strong field
+		static constexpr tag_t weak_mask = (((tag_t)1 << weak_bits) - 1) << (strong_bits);             // the mask for the weak field
+		static constexpr tag_t lock_mask = (((tag_t)1 << lock_bits) - 1) << (strong_bits + weak_bits); // the mask for the lock field
+
+	public: // -- utility functions -- //
+
+		// gets the address of the buffer for holding the actual module - see buffer
+		disjoint_module *get() noexcept { return reinterpret_cast<disjoint_module*>(buffer); }
+
+		// adds v to the tag atomically and returns the previous value
+		tag_t tag_add(tag_t v, std::memory_order order = std::memory_order_seq_cst);
+		// subtracts v from the tag atomically and returns the previous value
+		tag_t tag_sub(tag_t v, std::memory_order order = std::memory_order_seq_cst);
+		// atomically converts a strong reference into a weak reference and returns the previous value
+		tag_t tag_strong_to_weak(std::memory_order order = std::memory_order_seq_cst);
+
+		// drops a weak reference to data - if there are no references of any kind remaining, deletes data.
+		static void release_weak(handle_data *data);
+
+		// extracts the strong field from an encoded tag
+		static constexpr tag_t extr_strong(tag_t v) { return v & strong_mask; }
+		// extracts the weak field from an encoded tag
+		static constexpr tag_t extr_weak(tag_t v) { return (v & weak_mask) >> (strong_bits); }
+		// extracts the lock field from an encoded tag
+		static constexpr tag_t extr_lock(tag_t v) { return v >> (strong_bits + weak_bits); }
+
+		// gets the number of non-lock strong referneces - effectively (strong field - lock field)
+		static constexpr tag_t non_lock_strongs(tag_t v) { return extr_strong(v) - extr_lock(v); }
+	};
+
+	// acts as an owning handle for a gc disjunction module.
+	// repointing and destructor actions on this object trigger end-of-thread cleanup for gc resources.
+	// thus, you should NEVER EVER use this type as a local object - undefined behavior.
+	// this should only be used for the primary/local handles - all others should be weak_disjoint_handle.
+	class shared_disjoint_handle
+	{
+	private: // -- data -- //
+
+		disjoint_module *__module; // the pre-cached module pointer - at all times __module and data are both null or __module == data->get()
+		handle_data *data; // the module allocation block - stores all the ref count info and the actual module itself
+
+		friend class weak_disjoint_handle;
+		friend class disjoint_module_container;
+
+	private: // -- repointing -- //
+
+		// repoints this handle at other - performs all relevant reference counting logic for automatic cleanup.
+		// repointing to the same disjunction data block we already point at is no-op.
+		// other must be sourced from a valid SHARED (strong) disjoint handle object.
+		// MUST NOT BE USED FOR LOCKING!!
+		void reset(handle_data *other = nullptr);
+
+		// performs all logic necessary for locking onto a weak reference.
+		// if the lock fails the resulting state is null.
+		// other must be sourced from a valid WEAK disjoint handle object.
+		// MUST BE USED FOR LOCKING!!
+		void lock(handle_data *other);
+
+	public: // -- ctor / dtor / asgn -- //
+
+		// creates an owning handle that does not alias a disjunction
+		explicit shared_disjoint_handle(std::nullptr_t = nullptr) noexcept;
+
+		~shared_disjoint_handle();
+
+		// creates a new owning handle that aliases the same disjunction
+		shared_disjoint_handle(const shared_disjoint_handle &other);
+		// creates a new owning handle that aliases the same disjunction - other is empty after this operation
+		shared_disjoint_handle(shared_disjoint_handle &&other) noexcept;
+
+		// repoints this owning handle to other's disjunction
+		shared_disjoint_handle &operator=(const shared_disjoint_handle &other);
+		// repoints this owning handle to other's disjunction - other is empty after this operation (unless other == this, in which case no-op).
+		// this is the only way to use non-primary/local handles and not invoke undefined behavior (so long as you move into a primary/local handle).
+		shared_disjoint_handle &operator=(shared_disjoint_handle &&other);
+
+		// repoints this owning handle to null (no owned disjunction)
+		shared_disjoint_handle &operator=(std::nullptr_t);
+
+	public: // -- weak handle locking -- //
+
+		// repoints this owning handle to the object aliased by non-owning handle other.
+		// if the object aliased by other is at this point invalid, this results in null (for this object).
+		shared_disjoint_handle &operator=(const weak_disjoint_handle &other);
+
+	public: // -- module access -- //
+
+		// returns true iff this owning handle aliases a disjunction
+		explicit operator bool() const noexcept { return __module != nullptr; }
+		// returns true iff this owning handle does not alias a disjunction
+		bool operator!() const noexcept { return __module == nullptr; }
+
+		// gets the aliased disjunction - if this handle does not alias a disjunction returns null
+		disjoint_module *get() const noexcept { return __module; }
+
+		disjoint_module *operator->() const noexcept { return get(); }
+		disjoint_module &operator*() const { return *get(); }
+	};
+	// the non-owning form of shared_disjoint_handle.
+	// this type is how you store local references to the shared version (which should only be used for primary/local handles).
+	class weak_disjoint_handle
+	{
+	private: // -- data -- //
+
+		handle_data *data; // the managed disjunction - EXTERNAL CODE SHOULD NOT MODIFY DIRECTLY - use reset()
+
+		friend class shared_disjoint_handle;
+
+	private: // -- repointing -- //
+
+		// repoints this handle at other - performs all relevant reference counting logic for automatic cleanup.
+		// repointing to the same disjunction data block we already point at is no-op.
+		// other must be sourced from a valid weak or shared (strong) handle.
+		void reset(handle_data *other = nullptr);
+
+	public: // -- ctor / dtor / asgn -- //
+
+		// creates a non-owning handle that does not alias a disjunction
+		explicit weak_disjoint_handle(std::nullptr_t = nullptr) noexcept;
+
+		~weak_disjoint_handle();
+
+		// creates a new non-owning handle that aliases the same disjunction
+		weak_disjoint_handle(const weak_disjoint_handle &other);
+		// creates a new owning handle that aliases the same disjunction - other is empty after this operation
+		weak_disjoint_handle(weak_disjoint_handle &&other) noexcept;
+		
+		// repoints this non-owning handle to other's disjunction
+		weak_disjoint_handle &operator=(const weak_disjoint_handle &other);
+		// repoints this non-owning handle to other's disjunction - other is empty after this operation (unless other == this, in which case no-op).
+		weak_disjoint_handle &operator=(weak_disjoint_handle &&other);
+
+		// repoints this non-owning handle to null (no owned disjunction)
+		weak_disjoint_handle &operator=(std::nullptr_t);
+
+	public: // -- shared handle aliasing -- //
+
+		// creates a new non-owning handle that aliases the disjunction aliased by an owning handle
+		weak_disjoint_handle(const shared_disjoint_handle &other);
+		// reploints this non-owning handle to the disjunction aliased by an owning handle
+		weak_disjoint_handle &operator=(const shared_disjoint_handle &other);
+
+	public: // -- module queries -- //
+
+		// returns true iff the last owning handle to the aliased disjunction has been severed.
+		// by its very nature this function is racy - depending on your need locking might be a better option.
+		// if this handle does not alias a disjunction, returns true.
+		bool expired() const noexcept;
+	};
+
+	friend struct __gc_primary_usage_guard_t;
+	friend struct __gc_local_usage_guard_t;
+
+private: // -- data -- //
+
+	static std::atomic<strategies> _strategy; // the auto collect tactics currently in place
+
+	static std::atomic<sleep_time_t> _sleep_time; // the amount of time to sleep after an automatic timed collection cycle
+	
+private: // -- misc -- //
+
+	GC() = delete; // not instantiatable
+
+	// allocates space and returns a pointer to at least <size> bytes which is aligned to <align>.
+	// it is undefined behavior if align is not a power of 2.
+	// allocating zero bytes returns null.
+	// on failure, returns null.
+	// must be deallocated via aligned_free().
+	[[nodiscard]]
+	static void *aligned_malloc(std::size_t size, std::size_t align);
+	// deallocates a block of memory allocated by aligned_malloc().
+	// if <ptr> is null, does nothing.
+	static void aligned_free(void *ptr);
+
+	// gets the mutex from the global striped lock table that is responsible for the object at the specified address.
+	// used by atomic ptrs when DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS is enabled.
+	static std::mutex &atomic_ptr_stripe(const void *addr) noexcept;
+
+	// an entry in a global striped wait table (used by atomic ptr wait/notify and compact_recursive_mutex)
+	struct atomic_wait_stripe_t
+	{
+		std::mutex mutex;
+		std::condition_variable cv;
+	};
+
+	// gets the entry from the global striped wait table that is responsible for the object at the specified address.
+	static atomic_wait_stripe_t &atomic_ptr_wait_stripe(const void *addr) noexcept;
+	// as atomic_ptr_wait_stripe() but for parking threads waiting on a compact_recursive_mutex (separate table).
+	static atomic_wait_stripe_t &lockable_wait_stripe(const void *addr) noexcept;
+
+	// computes the stripe index in a striped table of the given size for the object at the specified address.
+	static std::size_t stripe_index(const void *addr, std::size_t stripe_count) noexcept;
+
+private: // -- private interface -- //
+
+	// -----------------------------------------------------------------
+	// from here on out, function names follow these conventions:
+	// starts with "__" = GC::mutex must be locked prior to invocation.
+	// otherwise = GC::mutex must not be locked prior to invocation.
+	// -----------------------------------------------------------------
+	
+	// the first invocation of this function begins a new thread to perform timed garbage collection.
+	// all subsequent invocations do nothing.
+	static void start_timed_collect();
+
+private: // -- utility router functions -- //
+	
+	static void router_unroot(const smart_handle &arc);
+};
+
+// ------------------------- //
+
+// -- std specializations -- //
+
+// ------------------------- //
+
+// hash functions for gc ptr
+template<typename T>
+struct std::hash<GC::ptr<T>>
+{
+	std::size_t operator()(const GC::ptr<T> &p) const { return std::hash<T*>()(p.get()); }
+};
+
+// standard wrapper for atomic_ptr.
+// it might be faster to use atomic_ptr directly (depending on compiler).
+template<typename T>
+struct std::atomic<GC::ptr<T>>
+{
+private: // -- data -- //
+
+	GC::atomic_ptr<T> value;
+
+	friend struct GC::router<std::atomic<GC::ptr<T>>>;
+
+public: // -- ctor / dtor / asgn -- //
+
+	atomic() = default;
+
+	~atomic() = default;
+
+	atomic(const atomic&) = delete;
+	atomic &operator=(const atomic&) = delete;
+
+public: // -- store / load -- //
+
+	atomic(const GC::ptr<T> &desired) : value(desired) {}
+	atomic &operator=(const GC::ptr<T> &desired) { value = desired; return *this; }
+
+	void store(const GC::ptr<T> &desired) { value.store(desired); }
+	GC::ptr<T> load() const { return value.load(); }
+
+	operator GC::ptr<T>() const { return static_cast<GC::ptr<T>>(value); }
+
+public: // -- exchange -- //
+
+	GC::ptr<T> exchange(const GC::ptr<T> &desired) { return value.exchange(desired); }
+
+public: // -- compare exchange -- //
+
+	bool compare_exchange_strong(GC::ptr<T> &expected, const GC::ptr<T> &desired) { return value.compare_exchange_strong(expected, desired); }
+	bool compare_exchange_weak(GC::ptr<T> &expected, const GC::ptr<T> &desired) { return value.compare_exchange_weak(expected, desired); }
+
+public: // -- wait / notify -- //
+
+	void wait(const GC::ptr<T> &old) const { value.wait(old); }
+
+	void notify_one() noexcept { value.notify_one(); }
+	void notify_all() noexcept { value.notify_all(); }
+
+public: // -- lock info -- //
+
+	static constexpr bool is_always_lock_free = GC::atomic_ptr<T>::is_always_lock_free;
+
+	bool is_lock_free() const noexcept { return is_always_lock_free; }
+
+public: // -- swap -- //
+
+	void swap(atomic &other) { value.swap(other.value); }
+	friend void swap(atomic &a, atomic &b) { a.value.swap(b.value); }
+};
+
+// an appropriate specialization for atomic_ptr (does not use any calls to gc functions - see generic std::atomic<T> ill-formed construction)
+template<typename T>
+struct GC::router<std::atomic<GC::ptr<T>>>
+{
+	template<typename F> static void route(const std::atomic<GC::ptr<T>> &atomic, F func)
+	{
+		GC::route(atomic.value, func);
+	}
+};
+
+// -------------------- //
+
+// -- misc functions -- //
+
+// -------------------- //
+
+// outputs the stored pointer to the stream - equivalent to ostr << ptr.get()
+template<typename T, typename U, typename V>
+std::basic_ostream<U, V> &operator<<(std::basic_ostream<U, V> &ostr, const GC::ptr<T> &ptr)
+{
+	ostr << ptr.get();
+	return ostr;
+}
+
+// ------------------------- //
+
+// -- stdlib wrapper impl -- //
+
+// ------------------------- //
+
+template<typename T, typename Deleter, typename Lockable>
+class __gc_unique_ptr
+{
+private: // -- data -- //
+
+	typedef std::unique_ptr<T, Deleter> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_unique_ptr>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- types -- //
+
+	typedef typename wrapped_t::pointer pointer;
+
+	typedef typename wrapped_t::element_type element_type;
+
+	typedef typename wrapped_t::deleter_type deleter_type;
+
+public: // -- ctor / dtor -- //
+
+	constexpr __gc_unique_ptr() noexcept
+	{
+		new (buffer) wrapped_t();
+	}
+	constexpr __gc_unique_ptr(std::nullptr_t) noexcept
+	{
+		new (buffer) wrapped_t(nullptr);
+	}
+
+	explicit __gc_unique_ptr(pointer p) noexcept
+	{
+		new (buffer) wrapped_t(p);
+	}
+
+	template<typename D>
+	__gc_unique_ptr(pointer p, D &&d)
+	{
+		new (buffer) wrapped_t(p, std::forward<D>(d)); // covers both deleter constructor forms
+	}
+
+	__gc_unique_ptr(__gc_unique_ptr &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_unique_ptr(wrapped_t &&other) noexcept
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	template<typename U, typename E, typename L>
+	__gc_unique_ptr(__gc_unique_ptr<U, E, L> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	template<typename U, typename E>
+	__gc_unique_ptr(std::unique_ptr<U, E> &&other) noexcept
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	~__gc_unique_ptr()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_unique_ptr &operator=(__gc_unique_ptr &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_unique_ptr &operator=(wrapped_t &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	template<typename U, typename E, typename L, std::enable_if_t<!std::is_same<__gc_unique_ptr, __gc_unique_ptr<U, E, L>>::value, int> = 0>
+	__gc_unique_ptr &operator=(__gc_unique_ptr<U, E, L> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::scoped_lock locks(this->mutex, other.mutex);
+		wrapped() = std::move(other.wrapped());
+		return *this;
+	}
+	template<typename U, typename E, std::enable_if_t<!std::is_same<wrapped_t, std::unique_ptr<U, E>>::value, int> = 0>
+	__gc_unique_ptr &operator=(std::unique_ptr<U, E> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_unique_ptr &operator=(std::nullptr_t) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = nullptr;
+		return *this;
+	}
+
+public: // -- management -- //
+
+	pointer release() noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().release();
+	}
+
+	void reset(pointer ptr = pointer()) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reset(ptr);
+	}
+
+	template<typename U, typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
+	void reset(U other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reset(other);
+	}
+
+	template<typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
+	void reset(std::nullptr_t = nullptr) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reset(nullptr);
+	}
+
+	void swap(__gc_unique_ptr &other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_unique_ptr &a, __gc_unique_ptr &b) { a.swap(b); }
+	friend void swap(__gc_unique_ptr &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_unique_ptr &b) { b.swap(a); }
+
+public: // -- obj access -- //
+
+	pointer get() const noexcept { return wrapped().get(); }
+
+	decltype(auto) get_deleter() noexcept { return wrapped().get_deleter(); }
+	decltype(auto) get_deleter() const noexcept { return wrapped().get_deleter(); }
+
+	explicit operator bool() const noexcept { return static_cast<bool>(wrapped()); }
+
+	decltype(auto) operator*() const { return *wrapped(); }
+	decltype(auto) operator->() const noexcept { return wrapped().operator->(); }
+
+	template<typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
+	decltype(auto) operator[](std::size_t i) const { return wrapped()[i]; }
+};
+template<typename T, typename Deleter, typename Lockable>
+struct GC::router<__gc_unique_ptr<T, Deleter, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_unique_ptr<T, Deleter, Lockable> &obj, F func)
+	{
+		GC::router_lock_t<Lockable> lock(obj.mutex);
+		GC::route(obj.wrapped(), func);
+	}
+};
+
+// -- __gc_unique_ptr cmp -- //
+
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator==(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() == b.get(); }
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator!=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() != b.get(); }
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator<(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() < b.get(); }
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator<=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() <= b.get(); }
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator>(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() > b.get(); }
+template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
+bool operator>=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() >= b.get(); }
+
+template<typename T, typename D, typename L>
+bool operator==(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() == nullptr; }
+template<typename T, typename D, typename L>
+bool operator==(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr == x.get(); }
+
+template<typename T, typename D, typename L>
+bool operator!=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() != nullptr; }
+template<typename T, typename D, typename L>
+bool operator!=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr != x.get(); }
+
+template<typename T, typename D, typename L>
+bool operator<(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() < nullptr; }
+template<typename T, typename D, typename L>
+bool operator<(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr < x.get(); }
+
+template<typename T, typename D, typename L>
+bool operator<=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() <= nullptr; }
+template<typename T, typename D, typename L>
+bool operator<=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr <= x.get(); }
+
+template<typename T, typename D, typename L>
+bool operator>(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() > nullptr; }
+template<typename T, typename D, typename L>
+bool operator>(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr > x.get(); }
+
+template<typename T, typename D, typename L>
+bool operator>=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() >= nullptr; }
+template<typename T, typename D, typename L>
+bool operator>=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr >= x.get(); }
+
+// --------------------------------------------------------------
+
+template<typename T, typename Allocator, typename Lockable>
+class __gc_vector
+{
+private: // -- data -- //
+
+	typedef std::vector<T, Allocator> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_vector>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::value_type value_type;
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
+
+	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
+
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
+
+	typedef typename wrapped_t::reverse_iterator reverse_iterator;
+	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+
+public: // -- ctor / dtor -- //
+
+	__gc_vector()
+	{
+		new (buffer) wrapped_t();
+	}
+	explicit __gc_vector(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
+	}
+
+	__gc_vector(size_type count, const T& value, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, value, alloc);
+	}
+
+	explicit __gc_vector(size_type count, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, alloc);
+	}
+
+	__gc_vector(const __gc_vector &other)
+	{
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_vector(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
+	}
+
+	__gc_vector(const __gc_vector &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_vector(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_vector(__gc_vector &&other)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_vector(wrapped_t &&other)
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	__gc_vector(__gc_vector &&other, const Allocator &alloc)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+	}
+	__gc_vector(wrapped_t &&other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(std::move(other), alloc);
+	}
+
+	__gc_vector(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_vector()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_vector &operator=(const __gc_vector &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_vector &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_vector &operator=(__gc_vector &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_vector &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_vector &operator=(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+	void assign(size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(count, value);
+	}
+
+	template<typename InputIt>
+	void assign(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(first, last);
+	}
+
+	void assign(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(ilist);
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- obj access -- //
+
+	reference at(size_type pos) { return wrapped().at(pos); }
+	const_reference at(size_type pos) const { return wrapped().at(pos); }
+
+	reference operator[](size_type pos) { return wrapped()[pos]; }
+	const_reference operator[](size_type pos) const { return wrapped()[pos]; }
+
+	reference front() { return wrapped().front(); }
+	const_reference front() const { return wrapped().front(); }
+
+	reference back() { return wrapped().back(); }
+	const_reference back() const { return wrapped().back(); }
+
+	T *data() noexcept { return wrapped().data(); }
+	const T *data() const noexcept { return wrapped().data(); }
+
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+
+	reverse_iterator rend() noexcept { return wrapped().rend(); }
+	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
+	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void reserve(size_type new_cap)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reserve(new_cap);
+	}
+	size_type capacity() const noexcept { return wrapped().capacity(); }
+
+	void shrink_to_fit()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().shrink_to_fit();
+	}
+
+	void clear() noexcept(noexcept(std::declval<Lockable>().lock()))
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	iterator insert(const_iterator pos, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, value);
+	}
+	iterator insert(const_iterator pos, T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, std::move(value));
+	}
+
+	iterator insert(const_iterator pos, size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, count, value);
+	}
+
+	template<typename InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, first, last);
+	}
+
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, ilist);
+	}
+
+	template<typename ...Args>
+	iterator emplace(const_iterator pos, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace(std::forward<Args>(args)...);
+	}
+
+	iterator erase(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(pos);
+	}
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(first, last);
+	}
+
+public: // -- push / pop -- //
+
+	void push_back(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(value);
+	}
+	void push_back(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_back(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_back(std::forward<Args>(args)...);
+	}
+
+	void pop_back()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_back();
+	}
+
+public: // -- resize -- //
+
+	void resize(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count);
+	}
+	void resize(size_type count, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count, value);
+	}
+
+public: // -- swap -- //
+
+	void swap(__gc_vector &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_vector &a, __gc_vector &b) { a.swap(b); }
+	friend void swap(__gc_vector &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_vector &b) { b.swap(a); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() >= b.wrapped(); }
+};
+template<typename T, typename Allocator, typename Lockable>
+struct GC::router<__gc_vector<T, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_vector<T, Allocator, Lockable> &vec, F func)
+	{
+		GC::router_lock_t<Lockable> lock(vec.mutex);
+		GC::route(vec.wrapped(), func);
+	}
+};
+
+template<typename T, typename Allocator, typename Lockable>
+class __gc_deque
+{
+private: // -- data -- //
+
+	typedef std::deque<T, Allocator> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // the router synchronizer
+
+	friend struct GC::router<__gc_deque>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::value_type value_type;
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
+
+	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
+
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
+
+	typedef typename wrapped_t::reverse_iterator reverse_iterator;
+	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+
+public: // -- ctor / dtor -- //
+
+	__gc_deque()
+	{
+		new (buffer) wrapped_t();
+	}
+	explicit __gc_deque(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
+	}
+
+	__gc_deque(size_type count, const T &value, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, value, alloc);
+	}
+
+	explicit __gc_deque(size_type count, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_deque(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, alloc);
+	}
+
+	__gc_deque(const __gc_deque &other)
+	{
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_deque(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
+	}
+
+	__gc_deque(const __gc_deque &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_deque(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_deque(__gc_deque &&other)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_deque(wrapped_t &&other)
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	__gc_deque(__gc_deque &&other, const Allocator &alloc)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+	}
+	__gc_deque(wrapped_t &&other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(std::move(other), alloc);
+	}
+
+	__gc_deque(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_deque()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_deque &operator=(const __gc_deque &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_deque &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_deque &operator=(__gc_deque &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_deque &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_deque &operator=(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+	void assign(size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(count, value);
+	}
+
+	template<typename InputIt>
+	void assign(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(first, last);
+	}
+
+	void assign(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(ilist);
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- obj access -- //
+
+	reference at(size_type pos) { return wrapped().at(pos); }
+	const_reference at(size_type pos) const { return wrapped().at(pos); }
+
+	reference operator[](size_type pos) { return wrapped()[pos]; }
+	const_reference operator[](size_type pos) const { return wrapped()[pos]; }
+
+	reference front() { return wrapped().front(); }
+	const_reference front() const { return wrapped().front(); }
+
+	reference back() { return wrapped().back(); }
+	const_reference back() const { return wrapped().back(); }
+
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+
+	reverse_iterator rend() noexcept { return wrapped().rend(); }
+	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
+	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void reserve(size_type new_cap)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reserve(new_cap);
+	}
+	size_type capacity() const noexcept { return wrapped().capacity(); }
+
+	void shrink_to_fit()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().shrink_to_fit();
+	}
+
+	void clear() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	iterator insert(const_iterator pos, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, value);
+	}
+	iterator insert(const_iterator pos, T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, std::move(value));
+	}
+
+	iterator insert(const_iterator pos, size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, count, value);
+	}
+
+	template<typename InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, first, last);
+	}
+
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, ilist);
+	}
+
+	template<typename ...Args>
+	iterator emplace(const_iterator pos, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace(std::forward<Args>(args)...);
+	}
+
+	iterator erase(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(pos);
+	}
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(first, last);
+	}
+
+public: // -- push / pop -- //
+
+	void push_back(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(value);
+	}
+	void push_back(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_back(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_back(std::forward<Args>(args)...);
+	}
+
+	void pop_back()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_back();
+	}
+
+	void push_front(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(value);
+	}
+	void push_front(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_front(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_front(std::forward<Args>(args)...);
+	}
+
+	void pop_front()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_front();
+	}
+
+public: // -- resize -- //
+
+	void resize(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count);
+	}
+	void resize(size_type count, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count, value);
+	}
+
+public: // -- swap -- //
+
+	void swap(__gc_deque &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_deque &a, __gc_deque &b) { a.swap(b); }
+	friend void swap(__gc_deque &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_deque &b) { b.swap(a); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() >= b.wrapped(); }
+};
+template<typename T, typename Allocator, typename Lockable>
+struct GC::router<__gc_deque<T, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_deque<T, Allocator, Lockable> &vec, F func)
+	{
+		GC::router_lock_t<Lockable> lock(vec.mutex);
+		GC::route(vec.wrapped(), func);
+	}
+};
+
+template<typename T, typename Allocator, typename Lockable>
+class __gc_forward_list
+{
+private: // -- data -- //
+
+	typedef std::forward_list<T, Allocator> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_forward_list>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::value_type value_type;
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
+
+	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
+
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
+
+public: // -- ctor / dtor -- //
+
+	__gc_forward_list()
+	{
+		new (buffer) wrapped_t();
+	}
+	explicit __gc_forward_list(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
+	}
+
+	__gc_forward_list(size_type count, const T &value, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, value, alloc);
+	}
+
+	explicit __gc_forward_list(size_type count, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_forward_list(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, alloc);
+	}
+
+	__gc_forward_list(const __gc_forward_list &other)
+	{
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_forward_list(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
+	}
+
+	__gc_forward_list(const __gc_forward_list &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_forward_list(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_forward_list(__gc_forward_list &&other)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_forward_list(wrapped_t &&other)
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	__gc_forward_list(__gc_forward_list &&other, const Allocator &alloc)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+	}
+	__gc_forward_list(wrapped_t &&other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(std::move(other), alloc);
+	}
+
+	__gc_forward_list(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_forward_list()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_forward_list &operator=(const __gc_forward_list &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_forward_list &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_forward_list &operator=(__gc_forward_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_forward_list &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_forward_list &operator=(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+	void assign(size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(count, value);
+	}
+
+	template<typename InputIt>
+	void assign(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(first, last);
+	}
+
+	void assign(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(ilist);
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- obj access -- //
+
+	reference front() { return wrapped().front(); }
+	const_reference front() const { return wrapped().front(); }
+
+public: // -- iterators -- //
+
+	iterator before_begin() noexcept { return wrapped().before_begin(); }
+	const_iterator before_begin() const noexcept { return wrapped().before_begin(); }
+	const_iterator cbefore_begin() const noexcept { return wrapped().cbefore_begin(); }
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void clear() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	iterator insert_after(const_iterator pos, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_after(pos, value);
+	}
+	iterator insert_after(const_iterator pos, T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_after(pos, std::move(value));
+	}
+
+	iterator insert_after(const_iterator pos, size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_after(pos, count, value);
+	}
+
+	template<typename InputIt>
+	iterator insert_after(const_iterator pos, InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_after(pos, first, last);
+	}
+
+	iterator insert_after(const_iterator pos, std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_after(pos, ilist);
+	}
+
+	template<typename ...Args>
+	iterator emplace_after(const_iterator pos, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_after(pos, std::forward<Args>(args)...);
+	}
+
+	iterator erase_after(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase_after(pos);
+	}
+	iterator erase_after(const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase_after(first, last);
+	}
+
+public: // -- push / pop -- //
+
+	void push_front(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(value);
+	}
+	void push_front(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_front(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_front(std::forward<Args>(args)...);
+	}
+
+	void pop_front()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_front();
+	}
+
+public: // -- resize -- //
+
+	void resize(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count);
+	}
+	void resize(size_type count, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count, value);
+	}
+
+public: // -- swap -- //
+
+	void swap(__gc_forward_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_forward_list &a, __gc_forward_list &b) { a.swap(b); }
+	friend void swap(__gc_forward_list &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_forward_list &b) { b.swap(a); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() >= b.wrapped(); }
+
+public: // -- merge -- //
+
+	void merge(__gc_forward_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(other.wrapped());
+		}
+	}
+	void merge(__gc_forward_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(std::move(other.wrapped()));
+		}
+	}
+
+	template<typename Compare>
+	void merge(__gc_forward_list &other, Compare comp)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(other.wrapped(), comp);
+		}
+	}
+	template<typename Compare>
+	void merge(__gc_forward_list &&other, Compare comp)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(std::move(other.wrapped()), comp);
+		}
+	}
+
+	// ------------------------------------------------------------
+
+	void merge(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(other);
+	}
+	void merge(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(std::move(other));
+	}
+
+	template<typename Compare>
+	void merge(wrapped_t &other, Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(other, comp);
+	}
+	template<typename Compare>
+	void merge(wrapped_t &&other, Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(std::move(other), comp);
+	}
+
+public: // -- splice -- //
+
+	void splice_after(const_iterator pos, __gc_forward_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped());
+		}
+	}
+	void splice_after(const_iterator pos, __gc_forward_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()));
+		}
+	}
+
+	void splice_after(const_iterator pos, __gc_forward_list &other, const_iterator it)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped(), it);
+		}
+	}
+	void splice_after(const_iterator pos, __gc_forward_list &&other, const_iterator it)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()), it);
+		}
+	}
+
+	void splice_after(const_iterator pos, __gc_forward_list &other, const_iterator first, const_iterator last)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped(), first, last);
+		}
+	}
+	void splice_after(const_iterator pos, __gc_forward_list &&other, const_iterator first, const_iterator last)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()), first, last);
+		}
+	}
+
+	// ------------------------------------------------------------
+
+	void splice_after(const_iterator pos, wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other));
+	}
+
+	void splice_after(const_iterator pos, wrapped_t &other, const_iterator it)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other, it);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator it)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other), it);
+	}
+
+	void splice_after(const_iterator pos, wrapped_t &other, const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other, first, last);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other), first, last);
+	}
+
+public: // -- remove -- //
+
+	decltype(auto) remove(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().remove(value);
+	}
+
+	template<typename UnaryPredicate>
+	decltype(auto) remove_if(UnaryPredicate p)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().remove_if(p);
+	}
+
+public: // -- ordering -- //
+
+	void reverse() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reverse();
+	}
+
+	decltype(auto) unique()
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().unique();
+	}
+	template<typename BinaryPredicate>
+	decltype(auto) unique(BinaryPredicate p)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().unique(p);
+	}
+
+	void sort()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().sort();
+	}
+	template<typename Compare>
+	void sort(Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().sort(comp);
+	}
+};
+template<typename T, typename Allocator, typename Lockable>
+struct GC::router<__gc_forward_list<T, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_forward_list<T, Allocator, Lockable> &list, F func)
+	{
+		GC::router_lock_t<Lockable> lock(list.mutex);
+		GC::route(list.wrapped(), func);
+	}
+};
+
+template<typename T, typename Allocator, typename Lockable>
+class __gc_list
+{
+private: // -- data -- //
+
+	typedef std::list<T, Allocator> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_list>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::value_type value_type;
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
+
+	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
+
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
+
+	typedef typename wrapped_t::reverse_iterator reverse_iterator;
+	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+
+public: // -- ctor / dtor -- //
+
+	__gc_list()
+	{
+		new (buffer) wrapped_t();
+	}
+	explicit __gc_list(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
+	}
+
+	__gc_list(size_type count, const T &value = T(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, value, alloc);
+	}
+
+	explicit __gc_list(size_type count, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_list(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, alloc);
+	}
+
+	__gc_list(const __gc_list &other)
+	{
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_list(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
+	}
+
+	__gc_list(const __gc_list &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_list(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_list(__gc_list &&other)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_list(wrapped_t &&other)
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	__gc_list(__gc_list &&other, const Allocator &alloc)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+	}
+	__gc_list(wrapped_t &&other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(std::move(other), alloc);
+	}
+
+	__gc_list(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_list()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_list &operator=(const __gc_list &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_list &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_list &operator=(__gc_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_list &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_list &operator=(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+	void assign(size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(count, value);
+	}
+
+	template<typename InputIt>
+	void assign(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(first, last);
+	}
+
+	void assign(std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().assign(ilist);
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- obj access -- //
+
+	reference front() { return wrapped().front(); }
+	const_reference front() const { return wrapped().front(); }
+
+	reference back() { return wrapped().back(); }
+	const_reference back() const { return wrapped().back(); }
+
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+
+	reverse_iterator rend() noexcept { return wrapped().rend(); }
+	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
+	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void clear() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	iterator insert(const_iterator pos, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, value);
+	}
+	iterator insert(const_iterator pos, T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, std::move(value));
+	}
+
+	iterator insert(const_iterator pos, size_type count, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, count, value);
+	}
+
+	template<typename InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, first, last);
+	}
+
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(pos, ilist);
+	}
+
+	template<typename ...Args>
+	iterator emplace(const_iterator pos, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace(pos, std::forward<Args>(args)...);
+	}
+
+	iterator erase(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(pos);
+	}
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(first, last);
+	}
+
+public: // -- push / pop -- //
+
+	void push_back(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(value);
+	}
+	void push_back(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_back(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_back(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_back(std::forward<Args>(args)...);
+	}
+
+	void pop_back()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_back();
+	}
+
+	void push_front(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(value);
+	}
+	void push_front(T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().push_front(std::move(value));
+	}
+
+	template<typename ...Args>
+	decltype(auto) emplace_front(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_front(std::forward<Args>(args)...);
+	}
+
+	void pop_front()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().pop_front();
+	}
+
+public: // -- resize -- //
+
+	void resize(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count);
+	}
+	void resize(size_type count, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().resize(count, value);
+	}
+
+public: // -- swap -- //
+
+	void swap(__gc_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_list &a, __gc_list &b) { a.swap(b); }
+	friend void swap(__gc_list &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_list &b) { b.swap(a); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_list &a, const __gc_list &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_list &a, const __gc_list &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_list &a, const __gc_list &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_list &a, const __gc_list &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_list &a, const __gc_list &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_list &a, const __gc_list &b) { return a.wrapped() >= b.wrapped(); }
+
+public: // -- merge -- //
+
+	void merge(__gc_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(other.wrapped());
+		}
+	}
+	void merge(__gc_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(std::move(other.wrapped()));
+		}
+	}
+
+	template<typename Compare>
+	void merge(__gc_list &other, Compare comp)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(other.wrapped(), comp);
+		}
+	}
+	template<typename Compare>
+	void merge(__gc_list &&other, Compare comp)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().merge(std::move(other.wrapped()), comp);
+		}
+	}
+
+	// ----------------------------------------------------------
+
+	void merge(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(other);
+	}
+	void merge(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(std::move(other));
+	}
+
+	template<typename Compare>
+	void merge(wrapped_t &other, Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(other, comp);
+	}
+	template<typename Compare>
+	void merge(wrapped_t &&other, Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().merge(std::move(other), comp);
+	}
+
+public: // -- splice -- //
+
+	void splice_after(const_iterator pos, __gc_list &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped());
+		}
+	}
+	void splice_after(const_iterator pos, __gc_list &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()));
+		}
+	}
+
+	void splice_after(const_iterator pos, __gc_list &other, const_iterator it)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped(), it);
+		}
+	}
+	void splice_after(const_iterator pos, __gc_list &&other, const_iterator it)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()), it);
+		}
+	}
+
+	void splice_after(const_iterator pos, __gc_list &other, const_iterator first, const_iterator last)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, other.wrapped(), first, last);
+		}
+	}
+	void splice_after(const_iterator pos, __gc_list &&other, const_iterator first, const_iterator last)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().splice_after(pos, std::move(other.wrapped()), first, last);
+		}
+	}
+
+	// ----------------------------------------------------------
+
+	void splice_after(const_iterator pos, wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other));
+	}
+
+	void splice_after(const_iterator pos, wrapped_t &other, const_iterator it)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other, it);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator it)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other), it);
+	}
+
+	void splice_after(const_iterator pos, wrapped_t &other, const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, other, first, last);
+	}
+	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().splice_after(pos, std::move(other), first, last);
+	}
+
+public: // -- remove -- //
+
+	decltype(auto) remove(const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().remove(value);
+	}
+
+	template<typename UnaryPredicate>
+	decltype(auto) remove_if(UnaryPredicate p)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().remove_if(p);
+	}
+
+public: // -- ordering -- //
+
+	void reverse() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reverse();
+	}
+
+	decltype(auto) unique()
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().unique();
+	}
+	template<typename BinaryPredicate>
+	decltype(auto) unique(BinaryPredicate p)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().unique(p);
+	}
+
+	void sort()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().sort();
+	}
+	template<typename Compare>
+	void sort(Compare comp)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().sort(comp);
+	}
+};
+template<typename T, typename Allocator, typename Lockable>
+struct GC::router<__gc_list<T, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_list<T, Allocator, Lockable> &list, F func)
+	{
+		GC::router_lock_t<Lockable> lock(list.mutex);
+		GC::route(list.wrapped(), func);
+	}
+};
+
+template<typename Key, typename Compare, typename Allocator, typename Lockable>
+class __gc_set
+{
+private: // -- data -- //
+
+	typedef std::set<Key, Compare, Allocator> wrapped_t; // the wrapped type
+
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_set>;
+
+private: // -- data accessors -- //
+
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+
+public: // -- wrapped obj access -- //
+
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
+
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::value_type value_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::key_compare key_compare;
+	typedef typename wrapped_t::value_compare value_compare;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
+
+	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
+
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
+
+	typedef typename wrapped_t::reverse_iterator reverse_iterator;
+	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+
+	typedef typename wrapped_t::node_type node_type;
+	typedef typename wrapped_t::insert_return_type insert_return_type;
+
+public: // -- ctor / dtor -- //
+
+	__gc_set()
+	{
+		new (buffer) wrapped_t();
+	}
+	explicit __gc_set(const Compare &comp, const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(comp, alloc);
+	}
+	explicit __gc_set(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
+	}
+
+	template<typename InputIt>
+	__gc_set(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, comp, alloc);
+	}
+	template<typename InputIt>
+	__gc_set(InputIt first, InputIt last, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, alloc);
+	}
+
+	__gc_set(const __gc_set &other)
+	{
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_set(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
+	}
+
+	__gc_set(const __gc_set &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_set(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_set(__gc_set &&other)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
+	}
+	__gc_set(wrapped_t &&other)
+	{
+		new (buffer) wrapped_t(std::move(other));
+	}
+
+	__gc_set(__gc_set &&other, const Allocator &alloc)
+	{
+		std::lock_guard lock(other.mutex);
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+	}
+	__gc_set(wrapped_t &&other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(std::move(other), alloc);
+	}
+
+	__gc_set(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, comp, alloc);
+	}
+	__gc_set(std::initializer_list<value_type> init, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_set()
+	{
+		wrapped().~wrapped_t();
+	}
+
+public: // -- asgn -- //
+
+	__gc_set &operator=(const __gc_set &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_set &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_set &operator=(__gc_set &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_set &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_set &operator=(std::initializer_list<value_type> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+
+	reverse_iterator rend() noexcept { return wrapped().rend(); }
+	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
+	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void clear() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	std::pair<iterator, bool> insert(const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(value);
+	}
+	std::pair<iterator, bool> insert(value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(value));
+	}
+
+	iterator insert(const_iterator hint, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, value);
+	}
+	iterator insert(const_iterator hint, value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(value));
+	}
+
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().insert(first, last);
+	}
+
+	void insert(std::initializer_list<value_type> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().insert(ilist);
+	}
+
+	insert_return_type insert(node_type &&nh)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(nh));
+	}
+	iterator insert(const_iterator hint, node_type &&nh)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(nh));
+	}
+
+	template<typename ...Args>
+	std::pair<iterator, bool> emplace(Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace(std::forward<Args>(args)...);
+	}
+	template<typename ...Args>
+	iterator emplace_hint(const_iterator hint, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+	}
+
+	iterator erase(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(pos);
+	}
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(first, last);
+	}
+
+	size_type erase(const key_type &key)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(key);
+	}
+
+public: // -- swap -- //
+
+	void swap(__gc_set &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().swap(other);
+	}
+
+	friend void swap(__gc_set &a, __gc_set &b) { a.swap(b); }
+	friend void swap(__gc_set &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_set &b) { b.swap(a); }
+
+public: // -- extract -- //
+
+	node_type extract(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(pos);
+	}
+	node_type extract(const key_type &key)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(key);
+	}
+
+	// !! ADD MERGE FUNCTIONS (C++17)
+
+public: // -- lookup -- //
+
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
+
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
+
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
+
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
+
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+
+	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
+	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
+
+	template<typename K>
+	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
+	template<typename K>
+	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
 
-	// !! add compare exchange stuff !! //
+	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
+	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
 
-public: // -- lock info -- //
+	template<typename K>
+	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
+	template<typename K>
+	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
 
-	static constexpr bool is_always_lock_free = GC::atomic_ptr<T>::is_always_lock_free;
+public: // -- cmp types -- //
 
-	bool is_lock_free() const noexcept { return is_always_lock_free; }
+	key_compare key_comp() const { return wrapped().key_comp(); }
+	value_compare value_comp() const { return wrapped().value_comp(); }
 
-public: // -- swap -- //
+public: // -- cmp -- //
 
-	void swap(atomic &other) { value.swap(other.value); }
-	friend void swap(atomic &a, atomic &b) { a.value.swap(b.value); }
+	friend bool operator==(const __gc_set &a, const __gc_set &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_set &a, const __gc_set &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_set &a, const __gc_set &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_set &a, const __gc_set &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_set &a, const __gc_set &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_set &a, const __gc_set &b) { return a.wrapped() >= b.wrapped(); }
 };
-
-// an appropriate specialization for atomic_ptr (does not use any calls to gc functions - see generic std::atomic<T> ill-formed construction)
-template<typename T>
-struct GC::router<std::atomic<GC::ptr<T>>>
+template<typename Key, typename Compare, typename Allocator, typename Lockable>
+struct GC::router<__gc_set<Key, Compare, Allocator, Lockable>>
 {
-	template<typename F> static void route(const std::atomic<GC::ptr<T>> &atomic, F func)
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+
+	template<typename F>
+	static void route(const __gc_set<Key, Compare, Allocator, Lockable> &set, F func)
 	{
-		GC::route(atomic.value, func);
+		GC::router_lock_t<Lockable> lock(set.mutex);
+		GC::route(set.wrapped(), func);
 	}
 };
 
-// -------------------- //
-
-// -- misc functions -- //
-
-// -------------------- //
-
-// outputs the stored pointer to the stream - equivalent to ostr << ptr.get()
-template<typename T, typename U, typename V>
-std::basic_ostream<U, V> &operator<<(std::basic_ostream<U, V> &ostr, const GC::ptr<T> &ptr)
-{
-	ostr << ptr.get();
-	return ostr;
-}
-
-// ------------------------- //
-
-// -- stdlib wrapper impl -- //
-
-// ------------------------- //
-
-template<typename T, typename Deleter, typename Lockable>
-class __gc_unique_ptr
+template<typename Key, typename Compare, typename Allocator, typename Lockable>
+class __gc_multiset
 {
 private: // -- data -- //
 
-	typedef std::unique_ptr<T, Deleter> wrapped_t; // the wrapped type
+	typedef std::multiset<Key, Compare, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_unique_ptr>;
+	friend struct GC::router<__gc_multiset>;
 
 private: // -- data accessors -- //
 
@@ -2469,132 +7706,284 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
-public: // -- types -- //
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
+public: // -- typedefs -- //
+
+	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::value_type value_type;
+
+	typedef typename wrapped_t::size_type size_type;
+	typedef typename wrapped_t::difference_type difference_type;
+
+	typedef typename wrapped_t::key_compare key_compare;
+	typedef typename wrapped_t::value_compare value_compare;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
+	typedef typename wrapped_t::reference reference;
+	typedef typename wrapped_t::const_reference const_reference;
 
 	typedef typename wrapped_t::pointer pointer;
+	typedef typename wrapped_t::const_pointer const_pointer;
 
-	typedef typename wrapped_t::element_type element_type;
+	typedef typename wrapped_t::iterator iterator;
+	typedef typename wrapped_t::const_iterator const_iterator;
 
-	typedef typename wrapped_t::deleter_type deleter_type;
+	typedef typename wrapped_t::reverse_iterator reverse_iterator;
+	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+
+	typedef typename wrapped_t::node_type node_type;
 
 public: // -- ctor / dtor -- //
 
-	constexpr __gc_unique_ptr() noexcept
+	__gc_multiset()
 	{
 		new (buffer) wrapped_t();
 	}
-	constexpr __gc_unique_ptr(std::nullptr_t) noexcept
+	explicit __gc_multiset(const Compare &comp, const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(nullptr);
+		new (buffer) wrapped_t(comp, alloc);
+	}
+	explicit __gc_multiset(const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(alloc);
 	}
 
-	explicit __gc_unique_ptr(pointer p) noexcept
+	template<typename InputIt>
+	__gc_multiset(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(p);
+		new (buffer) wrapped_t(first, last, comp, alloc);
+	}
+	template<typename InputIt>
+	__gc_multiset(InputIt first, InputIt last, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, alloc);
 	}
 
-	template<typename D>
-	__gc_unique_ptr(pointer p, D &&d)
+	__gc_multiset(const __gc_multiset &other)
 	{
-		new (buffer) wrapped_t(p, std::forward<D>(d)); // covers both deleter constructor forms
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	__gc_multiset(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
 	}
 
-	__gc_unique_ptr(__gc_unique_ptr &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	__gc_multiset(const __gc_multiset &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other.wrapped(), alloc);
+	}
+	__gc_multiset(const wrapped_t &other, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(other, alloc);
+	}
+
+	__gc_multiset(__gc_multiset &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_unique_ptr(wrapped_t &&other) noexcept
+	__gc_multiset(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	template<typename U, typename E, typename L>
-	__gc_unique_ptr(__gc_unique_ptr<U, E, L> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	__gc_multiset(__gc_multiset &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	template<typename U, typename E>
-	__gc_unique_ptr(std::unique_ptr<U, E> &&other) noexcept
+	__gc_multiset(wrapped_t &&other, const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(std::move(other));
+		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	~__gc_unique_ptr()
+	__gc_multiset(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, comp, alloc);
+	}
+	__gc_multiset(std::initializer_list<value_type> init, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, alloc);
+	}
+
+	~__gc_multiset()
 	{
 		wrapped().~wrapped_t();
 	}
 
 public: // -- asgn -- //
 
-	__gc_unique_ptr &operator=(__gc_unique_ptr &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	__gc_multiset &operator=(const __gc_multiset &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other.wrapped();
+		return *this;
+	}
+	__gc_multiset &operator=(const wrapped_t &other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = other;
+		return *this;
+	}
+
+	__gc_multiset &operator=(__gc_multiset &&other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
+	}
+	__gc_multiset &operator=(wrapped_t &&other)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::move(other);
+		return *this;
+	}
+
+	__gc_multiset &operator=(std::initializer_list<value_type> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = ilist;
+		return *this;
+	}
+
+public: // -- misc -- //
+
+	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return wrapped().begin(); }
+	const_iterator begin() const noexcept { return wrapped().begin(); }
+	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+
+	iterator end() noexcept { return wrapped().end(); }
+	const_iterator end() const noexcept { return wrapped().end(); }
+	const_iterator cend() const noexcept { return wrapped().cend(); }
+
+	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
+	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+
+	reverse_iterator rend() noexcept { return wrapped().rend(); }
+	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
+	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
+
+	size_type max_size() const noexcept { return wrapped().max_size(); }
+
+	void clear() noexcept
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().clear();
+	}
+
+public: // -- insert / erase -- //
+
+	iterator insert(const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(value);
+	}
+	iterator insert(value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(value));
+	}
+
+	iterator insert(const_iterator hint, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, value);
+	}
+	iterator insert(const_iterator hint, value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(value));
+	}
+
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
 	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
-		}
-		return *this;
+		std::lock_guard lock(this->mutex);
+		wrapped().insert(first, last);
 	}
-	__gc_unique_ptr &operator=(wrapped_t &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+
+	void insert(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
+		wrapped().insert(ilist);
 	}
 
-	template<typename U, typename E, typename L, std::enable_if_t<!std::is_same<__gc_unique_ptr, __gc_unique_ptr<U, E, L>>::value, int> = 0>
-	__gc_unique_ptr &operator=(__gc_unique_ptr<U, E, L> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	iterator insert(node_type &&nh)
 	{
-		std::scoped_lock locks(this->mutex, other.mutex);
-		wrapped() = std::move(other.wrapped());
-		return *this;
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(nh));
 	}
-	template<typename U, typename E, std::enable_if_t<!std::is_same<wrapped_t, std::unique_ptr<U, E>>::value, int> = 0>
-	__gc_unique_ptr &operator=(std::unique_ptr<U, E> &&other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	iterator insert(const_iterator hint, node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
+		return wrapped().insert(hint, std::move(nh));
 	}
 
-	__gc_unique_ptr &operator=(std::nullptr_t) noexcept(noexcept(std::declval<Lockable>().lock()))
+	template<typename ...Args>
+	std::pair<iterator, bool> emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped() = nullptr;
-		return *this;
+		return wrapped().emplace(std::forward<Args>(args)...);
 	}
-
-public: // -- management -- //
-
-	pointer release() noexcept(noexcept(std::declval<Lockable>().lock()))
+	template<typename ...Args>
+	iterator emplace_hint(const_iterator hint, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().release();
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
 	}
 
-	void reset(pointer ptr = pointer()) noexcept(noexcept(std::declval<Lockable>().lock()))
+	iterator erase(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reset(ptr);
+		return wrapped().erase(pos);
 	}
-
-	template<typename U, typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
-	void reset(U other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	iterator erase(const_iterator first, const_iterator last)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reset(other);
+		return wrapped().erase(first, last);
 	}
 
-	template<typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
-	void reset(std::nullptr_t = nullptr) noexcept(noexcept(std::declval<Lockable>().lock()))
+	size_type erase(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reset(nullptr);
+		return wrapped().erase(key);
 	}
 
-	void swap(__gc_unique_ptr &other) noexcept(noexcept(std::declval<Lockable>().lock()))
+public: // -- swap -- //
+
+	void swap(__gc_multiset &other)
 	{
 		if (this != &other)
 		{
@@ -2602,104 +7991,113 @@ public: // -- management -- //
 			wrapped().swap(other.wrapped());
 		}
 	}
-	void swap(wrapped_t &other) noexcept(noexcept(std::declval<Lockable>().lock()))
+	void swap(wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_unique_ptr &a, __gc_unique_ptr &b) { a.swap(b); }
-	friend void swap(__gc_unique_ptr &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_unique_ptr &b) { b.swap(a); }
+	friend void swap(__gc_multiset &a, __gc_multiset &b) { a.swap(b); }
+	friend void swap(__gc_multiset &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_multiset &b) { b.swap(a); }
 
-public: // -- obj access -- //
+public: // -- extract -- //
 
-	pointer get() const noexcept { return wrapped().get(); }
+	node_type extract(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(pos);
+	}
+	node_type extract(const key_type &key)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(key);
+	}
 
-	decltype(auto) get_deleter() noexcept { return wrapped().get_deleter(); }
-	decltype(auto) get_deleter() const noexcept { return wrapped().get_deleter(); }
+	// !! ADD MERGE FUNCTIONS (C++17)
 
-	explicit operator bool() const noexcept { return static_cast<bool>(wrapped()); }
+public: // -- lookup -- //
 
-	decltype(auto) operator*() const { return *wrapped(); }
-	decltype(auto) operator->() const noexcept { return wrapped().operator->(); }
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
 
-	template<typename Z = T, std::enable_if_t<std::is_same<T, Z>::value && GC::is_unbound_array<T>::value, int> = 0>
-	decltype(auto) operator[](std::size_t i) const { return wrapped()[i]; }
-};
-template<typename T, typename Deleter, typename Lockable>
-struct GC::router<__gc_unique_ptr<T, Deleter, Lockable>>
-{
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
 
-	template<typename F>
-	static void route(const __gc_unique_ptr<T, Deleter, Lockable> &obj, F func)
-	{
-		std::lock_guard lock(obj.mutex);
-		GC::route(obj.wrapped(), func);
-	}
-};
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
 
-// -- __gc_unique_ptr cmp -- //
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
 
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator==(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() == b.get(); }
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator!=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() != b.get(); }
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator<(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() < b.get(); }
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator<=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() <= b.get(); }
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator>(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() > b.get(); }
-template<typename T1, typename D1, typename L1, typename T2, typename D2, typename L2>
-bool operator>=(const __gc_unique_ptr<T1, D1, L1> &a, const __gc_unique_ptr<T2, D2, L2> &b) { return a.get() >= b.get(); }
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
 
-template<typename T, typename D, typename L>
-bool operator==(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() == nullptr; }
-template<typename T, typename D, typename L>
-bool operator==(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr == x.get(); }
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
 
-template<typename T, typename D, typename L>
-bool operator!=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() != nullptr; }
-template<typename T, typename D, typename L>
-bool operator!=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr != x.get(); }
+	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
+	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
 
-template<typename T, typename D, typename L>
-bool operator<(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() < nullptr; }
-template<typename T, typename D, typename L>
-bool operator<(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr < x.get(); }
+	template<typename K>
+	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
+	template<typename K>
+	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
 
-template<typename T, typename D, typename L>
-bool operator<=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() <= nullptr; }
-template<typename T, typename D, typename L>
-bool operator<=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr <= x.get(); }
+	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
+	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
 
-template<typename T, typename D, typename L>
-bool operator>(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() > nullptr; }
-template<typename T, typename D, typename L>
-bool operator>(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr > x.get(); }
+	template<typename K>
+	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
+	template<typename K>
+	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
 
-template<typename T, typename D, typename L>
-bool operator>=(const __gc_unique_ptr<T, D, L> &x, std::nullptr_t) { return x.get() >= nullptr; }
-template<typename T, typename D, typename L>
-bool operator>=(std::nullptr_t, const __gc_unique_ptr<T, D, L> &x) { return nullptr >= x.get(); }
+public: // -- cmp types -- //
 
-// --------------------------------------------------------------
+	key_compare key_comp() const { return wrapped().key_comp(); }
+	value_compare value_comp() const { return wrapped().value_comp(); }
 
-template<typename T, typename Allocator, typename Lockable>
-class __gc_vector
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() >= b.wrapped(); }
+};
+template<typename Key, typename Compare, typename Allocator, typename Lockable>
+struct GC::router<__gc_multiset<Key, Compare, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+
+	template<typename F>
+	static void route(const __gc_multiset<Key, Compare, Allocator, Lockable> &set, F func)
+	{
+		GC::router_lock_t<Lockable> lock(set.mutex);
+		GC::route(set.wrapped(), func);
+	}
+};
+
+template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
+class __gc_map
 {
 private: // -- data -- //
 
-	typedef std::vector<T, Allocator> wrapped_t; // the wrapped type
+	typedef std::map<Key, T, Compare, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_vector>;
+	friend struct GC::router<__gc_map>;
 
 private: // -- data accessors -- //
 
@@ -2713,14 +8111,39 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
+	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::mapped_type mapped_type;
+
 	typedef typename wrapped_t::value_type value_type;
-	typedef typename wrapped_t::allocator_type allocator_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
+	typedef typename wrapped_t::key_compare key_compare;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
 	typedef typename wrapped_t::reference reference;
 	typedef typename wrapped_t::const_reference const_reference;
 
@@ -2733,97 +8156,105 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::reverse_iterator reverse_iterator;
 	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
 
+	typedef typename wrapped_t::node_type node_type;
+	typedef typename wrapped_t::insert_return_type insert_return_type;
+
+	typedef typename wrapped_t::value_compare value_compare; // alias __gc_map's nested value_compare class
+
 public: // -- ctor / dtor -- //
 
-	__gc_vector()
+	__gc_map()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_vector(const Allocator &alloc)
+	explicit __gc_map(const Compare &comp, const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(alloc);
+		new (buffer) wrapped_t(comp, alloc);
 	}
-
-	__gc_vector(size_type count, const T& value, const Allocator &alloc = Allocator())
+	explicit __gc_map(const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(count, value, alloc);
+		new (buffer) wrapped_t(alloc);
 	}
 
-	explicit __gc_vector(size_type count, const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_map(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(count, alloc);
+		new (buffer) wrapped_t(first, last, comp, alloc);
 	}
-
 	template<typename InputIt>
-	__gc_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	__gc_map(InputIt first, InputIt last, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(first, last, alloc);
 	}
 
-	__gc_vector(const __gc_vector &other)
+	__gc_map(const __gc_map &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_vector(const wrapped_t &other)
+	__gc_map(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_vector(const __gc_vector &other, const Allocator &alloc)
+	__gc_map(const __gc_map &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_vector(const wrapped_t &other, const Allocator &alloc)
+	__gc_map(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_vector(__gc_vector &&other)
+	__gc_map(__gc_map &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_vector(wrapped_t &&other)
+	__gc_map(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_vector(__gc_vector &&other, const Allocator &alloc)
+	__gc_map(__gc_map &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_vector(wrapped_t &&other, const Allocator &alloc)
+	__gc_map(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_vector(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	__gc_map(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, comp, alloc);
+	}
+	__gc_map(std::initializer_list<value_type> init, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(init, alloc);
 	}
 
-	~__gc_vector()
+	~__gc_map()
 	{
 		wrapped().~wrapped_t();
 	}
 
 public: // -- asgn -- //
 
-	__gc_vector &operator=(const __gc_vector &other)
+	__gc_map &operator=(const __gc_map &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_vector &operator=(const wrapped_t &other)
+	__gc_map &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_vector &operator=(__gc_vector &&other)
+	__gc_map &operator=(__gc_map &&other)
 	{
 		if (this != &other)
 		{
@@ -2832,59 +8263,39 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_vector &operator=(wrapped_t &&other)
+	__gc_map &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_vector &operator=(std::initializer_list<T> ilist)
+	__gc_map &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = ilist;
 		return *this;
 	}
 
-	void assign(size_type count, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(count, value);
-	}
-
-	template<typename InputIt>
-	void assign(InputIt first, InputIt last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(first, last);
-	}
-
-	void assign(std::initializer_list<T> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(ilist);
-	}
-
 public: // -- misc -- //
 
 	allocator_type get_allocator() const { return wrapped().get_allocator(); }
 
-public: // -- obj access -- //
-
-	reference at(size_type pos) { return wrapped().at(pos); }
-	const_reference at(size_type pos) const { return wrapped().at(pos); }
-
-	reference operator[](size_type pos) { return wrapped()[pos]; }
-	const_reference operator[](size_type pos) const { return wrapped()[pos]; }
-
-	reference front() { return wrapped().front(); }
-	const_reference front() const { return wrapped().front(); }
+public: // -- element access -- //
 
-	reference back() { return wrapped().back(); }
-	const_reference back() const { return wrapped().back(); }
+	T &at(const Key &key) { return wrapped().at(key); }
+	const T &at(const Key &key) const { return wrapped().at(key); }
 
-	T *data() noexcept { return wrapped().data(); }
-	const T *data() const noexcept { return wrapped().data(); }
+	T &operator[](const Key &key)
+	{
+		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
+		return wrapped()[key];
+	}
+	T &operator[](Key &&key)
+	{
+		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
+		return wrapped()[std::move(key)];
+	}
 
 public: // -- iterators -- //
 
@@ -2911,63 +8322,138 @@ public: // -- size / cap -- //
 
 	size_type max_size() const noexcept { return wrapped().max_size(); }
 
-	void reserve(size_type new_cap)
+	void clear() noexcept
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reserve(new_cap);
+		wrapped().clear();
 	}
-	size_type capacity() const noexcept { return wrapped().capacity(); }
 
-	void shrink_to_fit()
+public: // -- insert / erase -- //
+
+	std::pair<iterator, bool> insert(const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().shrink_to_fit();
+		return wrapped().insert(value);
+	}
+	template<typename P>
+	std::pair<iterator, bool> insert(P &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::forward<P>(value));
 	}
 
-	void clear() noexcept(noexcept(std::declval<Lockable>().lock()))
+	iterator insert(const_iterator hint, const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().clear();
+		return wrapped().insert(hint, value);
 	}
 
-public: // -- insert / erase -- //
+	template<typename P>
+	iterator insert(const_iterator hint, P &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::forward<P>(value));
+	}
 
-	iterator insert(const_iterator pos, const T &value)
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, value);
+		wrapped().insert(first, last);
 	}
-	iterator insert(const_iterator pos, T &&value)
+
+	void insert(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, std::move(value));
+		wrapped().insert(ilist);
 	}
 
-	iterator insert(const_iterator pos, size_type count, const T &value)
+	std::pair<iterator, bool> insert(value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, count, value);
+		return wrapped().insert(std::move(value));
+	}
+	iterator insert(const_iterator hint, value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(value));
 	}
 
-	template<typename InputIt>
-	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	insert_return_type insert(node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, first, last);
+		return wrapped().insert(std::move(nh));
+	}
+	iterator insert(const_iterator hint, node_type &&nh)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(nh));
 	}
 
-	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, ilist);
+		return wrapped().insert_or_assign(k, std::forward<M>(obj));
+	}
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(key_type &&k, M &&obj)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_or_assign(std::move(k), std::forward<M>(obj));
+	}
+
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(const_iterator hint, const key_type &k, M &&obj)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_or_assign(hint, k, std::forward<M>(obj));
+	}
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(const_iterator hint, key_type &&k, M &&obj)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_or_assign(hint, std::move(k), std::forward<M>(obj));
 	}
 
 	template<typename ...Args>
-	iterator emplace(const_iterator pos, Args &&...args)
+	std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().try_emplace(k, std::forward<Args>(args)...);
+	}
+	template<typename ...Args>
+	std::pair<iterator, bool> try_emplace(key_type &&k, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().try_emplace(std::move(k), std::forward<Args>(args)...);
+	}
+
+	template<typename ...Args>
+	iterator try_emplace(const_iterator hint, const key_type &k, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().try_emplace(hint, k, std::forward<Args>(args)...);
+	}
+	template<typename ...Args>
+	iterator try_emplace(const_iterator hint, key_type &&k, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().try_emplace(hint, std::move(k), std::forward<Args>(args)...);
+	}
+
+	template<typename ...Args>
+	std::pair<iterator, bool> emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
 		return wrapped().emplace(std::forward<Args>(args)...);
 	}
+	template<typename ...Args>
+	iterator emplace_hint(const_iterator hint, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+	}
 
 	iterator erase(const_iterator pos)
 	{
@@ -2980,100 +8466,129 @@ public: // -- insert / erase -- //
 		return wrapped().erase(first, last);
 	}
 
-public: // -- push / pop -- //
-
-	void push_back(const T &value)
+	size_type erase(const key_type &k)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_back(value);
+		return wrapped().erase(k);
 	}
-	void push_back(T &&value)
+
+public: // -- swap -- //
+
+	void swap(__gc_map &other)
+	{
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped().swap(other.wrapped());
+		}
+	}
+	void swap(wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_back(std::move(value));
+		wrapped().swap(other);
 	}
 
-	template<typename ...Args>
-	decltype(auto) emplace_back(Args &&...args)
+	friend void swap(__gc_map &a, __gc_map &b) { a.swap(b); }
+	friend void swap(__gc_map &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_map &b) { b.swap(a); }
+
+public: // -- extract -- //
+
+	node_type extract(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_back(std::forward<Args>(args)...);
+		return wrapped().extract(pos);
 	}
-
-	void pop_back()
+	node_type extract(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_back();
+		return wrapped().extract(key);
 	}
 
-public: // -- resize -- //
+	// !! ADD MERGE FUNCTIONS (C++17)
+
+public: // -- lookup -- //
+
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
+
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
+
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
+
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
+
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+
+	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
+	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
+
+	template<typename K>
+	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
+	template<typename K>
+	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
 
-	void resize(size_type count)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().resize(count);
-	}
-	void resize(size_type count, const value_type &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().resize(count, value);
-	}
+	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
+	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
 
-public: // -- swap -- //
+	template<typename K>
+	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
+	template<typename K>
+	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
 
-	void swap(__gc_vector &other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
-		}
-	}
-	void swap(wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
-	}
+public: // -- cmp types -- //
 
-	friend void swap(__gc_vector &a, __gc_vector &b) { a.swap(b); }
-	friend void swap(__gc_vector &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_vector &b) { b.swap(a); }
+	key_compare key_comp() const { return wrapped().key_comp(); }
+	value_compare value_comp() const { return wrapped().value_comp(); }
 
 public: // -- cmp -- //
 
-	friend bool operator==(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_vector &a, const __gc_vector &b) { return a.wrapped() >= b.wrapped(); }
+	friend bool operator==(const __gc_map &a, const __gc_map &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_map &a, const __gc_map &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_map &a, const __gc_map &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_map &a, const __gc_map &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_map &a, const __gc_map &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_map &a, const __gc_map &b) { return a.wrapped() >= b.wrapped(); }
 };
-template<typename T, typename Allocator, typename Lockable>
-struct GC::router<__gc_vector<T, Allocator, Lockable>>
+template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
+struct GC::router<__gc_map<Key, T, Compare, Allocator, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
 
 	template<typename F>
-	static void route(const __gc_vector<T, Allocator, Lockable> &vec, F func)
+	static void route(const __gc_map<Key, T, Compare, Allocator, Lockable> &map, F func)
 	{
-		std::lock_guard lock(vec.mutex);
-		GC::route(vec.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		GC::route(map.wrapped(), func);
 	}
 };
 
-template<typename T, typename Allocator, typename Lockable>
-class __gc_deque
+template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
+class __gc_multimap
 {
 private: // -- data -- //
 
-	typedef std::deque<T, Allocator> wrapped_t; // the wrapped type
+	typedef std::multimap<Key, T, Compare, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
-	mutable Lockable mutex; // the router synchronizer
+	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_deque>;
+	friend struct GC::router<__gc_multimap>;
 
 private: // -- data accessors -- //
 
@@ -3087,14 +8602,39 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
+	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::mapped_type mapped_type;
+
 	typedef typename wrapped_t::value_type value_type;
-	typedef typename wrapped_t::allocator_type allocator_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
+	typedef typename wrapped_t::key_compare key_compare;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
 	typedef typename wrapped_t::reference reference;
 	typedef typename wrapped_t::const_reference const_reference;
 
@@ -3107,97 +8647,104 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::reverse_iterator reverse_iterator;
 	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
 
+	typedef typename wrapped_t::node_type node_type;
+
+	typedef typename wrapped_t::value_compare value_compare; // alias __gc_multimap's nested value_compare class
+
 public: // -- ctor / dtor -- //
 
-	__gc_deque()
+	__gc_multimap()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_deque(const Allocator &alloc)
+	explicit __gc_multimap(const Compare &comp, const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(alloc);
+		new (buffer) wrapped_t(comp, alloc);
 	}
-
-	__gc_deque(size_type count, const T &value, const Allocator &alloc = Allocator())
+	explicit __gc_multimap(const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(count, value, alloc);
+		new (buffer) wrapped_t(alloc);
 	}
 
-	explicit __gc_deque(size_type count, const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_multimap(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(count, alloc);
+		new (buffer) wrapped_t(first, last, comp, alloc);
 	}
-
 	template<typename InputIt>
-	__gc_deque(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	__gc_multimap(InputIt first, InputIt last, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(first, last, alloc);
 	}
 
-	__gc_deque(const __gc_deque &other)
+	__gc_multimap(const __gc_multimap &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_deque(const wrapped_t &other)
+	__gc_multimap(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_deque(const __gc_deque &other, const Allocator &alloc)
+	__gc_multimap(const __gc_multimap &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_deque(const wrapped_t &other, const Allocator &alloc)
+	__gc_multimap(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_deque(__gc_deque &&other)
+	__gc_multimap(__gc_multimap &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_deque(wrapped_t &&other)
+	__gc_multimap(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_deque(__gc_deque &&other, const Allocator &alloc)
+	__gc_multimap(__gc_multimap &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_deque(wrapped_t &&other, const Allocator &alloc)
+	__gc_multimap(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_deque(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	__gc_multimap(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, comp, alloc);
+	}
+	__gc_multimap(std::initializer_list<value_type> init, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(init, alloc);
 	}
 
-	~__gc_deque()
+	~__gc_multimap()
 	{
 		wrapped().~wrapped_t();
 	}
 
 public: // -- asgn -- //
 
-	__gc_deque &operator=(const __gc_deque &other)
+	__gc_multimap &operator=(const __gc_multimap &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_deque &operator=(const wrapped_t &other)
+	__gc_multimap &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_deque &operator=(__gc_deque &&other)
+	__gc_multimap &operator=(__gc_multimap &&other)
 	{
 		if (this != &other)
 		{
@@ -3206,57 +8753,24 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_deque &operator=(wrapped_t &&other)
+	__gc_multimap &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_deque &operator=(std::initializer_list<T> ilist)
+	__gc_multimap &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = ilist;
 		return *this;
 	}
 
-	void assign(size_type count, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(count, value);
-	}
-
-	template<typename InputIt>
-	void assign(InputIt first, InputIt last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(first, last);
-	}
-
-	void assign(std::initializer_list<T> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(ilist);
-	}
-
 public: // -- misc -- //
 
 	allocator_type get_allocator() const { return wrapped().get_allocator(); }
 
-public: // -- obj access -- //
-
-	reference at(size_type pos) { return wrapped().at(pos); }
-	const_reference at(size_type pos) const { return wrapped().at(pos); }
-
-	reference operator[](size_type pos) { return wrapped()[pos]; }
-	const_reference operator[](size_type pos) const { return wrapped()[pos]; }
-
-	reference front() { return wrapped().front(); }
-	const_reference front() const { return wrapped().front(); }
-
-	reference back() { return wrapped().back(); }
-	const_reference back() const { return wrapped().back(); }
-
 public: // -- iterators -- //
 
 	iterator begin() noexcept { return wrapped().begin(); }
@@ -3282,19 +8796,6 @@ public: // -- size / cap -- //
 
 	size_type max_size() const noexcept { return wrapped().max_size(); }
 
-	void reserve(size_type new_cap)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reserve(new_cap);
-	}
-	size_type capacity() const noexcept { return wrapped().capacity(); }
-
-	void shrink_to_fit()
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().shrink_to_fit();
-	}
-
 	void clear() noexcept
 	{
 		std::lock_guard lock(this->mutex);
@@ -3303,120 +8804,99 @@ public: // -- size / cap -- //
 
 public: // -- insert / erase -- //
 
-	iterator insert(const_iterator pos, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, value);
-	}
-	iterator insert(const_iterator pos, T &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, std::move(value));
-	}
-
-	iterator insert(const_iterator pos, size_type count, const T &value)
+	iterator insert(const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, count, value);
+		return wrapped().insert(value);
 	}
-
-	template<typename InputIt>
-	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	template<typename P>
+	iterator insert(P &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, first, last);
+		return wrapped().insert(std::forward<P>(value));
 	}
 
-	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+	iterator insert(const_iterator hint, const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, ilist);
+		return wrapped().insert(hint, value);
 	}
 
-	template<typename ...Args>
-	iterator emplace(const_iterator pos, Args &&...args)
+	template<typename P>
+	iterator insert(const_iterator hint, P &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		return wrapped().insert(hint, std::forward<P>(value));
 	}
 
-	iterator erase(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
-	}
-	iterator erase(const_iterator first, const_iterator last)
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		wrapped().insert(first, last);
 	}
 
-public: // -- push / pop -- //
-
-	void push_back(const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().push_back(value);
-	}
-	void push_back(T &&value)
+	void insert(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_back(std::move(value));
+		wrapped().insert(ilist);
 	}
 
-	template<typename ...Args>
-	decltype(auto) emplace_back(Args &&...args)
+	iterator insert(value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_back(std::forward<Args>(args)...);
+		return wrapped().insert(std::move(value));
 	}
-
-	void pop_back()
+	iterator insert(const_iterator hint, value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_back();
+		return wrapped().insert(hint, std::move(value));
 	}
 
-	void push_front(const T &value)
+	iterator insert(node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_front(value);
+		return wrapped().insert(std::move(nh));
 	}
-	void push_front(T &&value)
+	iterator insert(const_iterator hint, node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_front(std::move(value));
+		return wrapped().insert(hint, std::move(nh));
 	}
 
 	template<typename ...Args>
-	decltype(auto) emplace_front(Args &&...args)
+	iterator emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_front(std::forward<Args>(args)...);
+		return wrapped().emplace(std::forward<Args>(args)...);
 	}
-
-	void pop_front()
+	template<typename ...Args>
+	iterator emplace_hint(const_iterator hint, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_front();
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
 	}
 
-public: // -- resize -- //
-
-	void resize(size_type count)
+	iterator erase(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count);
+		return wrapped().erase(pos);
 	}
-	void resize(size_type count, const value_type &value)
+	iterator erase(const_iterator first, const_iterator last)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count, value);
+		return wrapped().erase(first, last);
+	}
+
+	size_type erase(const key_type &k)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().erase(k);
 	}
 
 public: // -- swap -- //
 
-	void swap(__gc_deque &other)
+	void swap(__gc_multimap &other)
 	{
 		if (this != &other)
 		{
@@ -3430,45 +8910,107 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_deque &a, __gc_deque &b) { a.swap(b); }
-	friend void swap(__gc_deque &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_deque &b) { b.swap(a); }
+	friend void swap(__gc_multimap &a, __gc_multimap &b) { a.swap(b); }
+	friend void swap(__gc_multimap &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_multimap &b) { b.swap(a); }
+
+public: // -- extract -- //
+
+	node_type extract(const_iterator pos)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(pos);
+	}
+	node_type extract(const key_type &key)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().extract(key);
+	}
+
+	// !! ADD MERGE FUNCTIONS (C++17)
+
+public: // -- lookup -- //
+
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
+
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
+
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
+
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
+
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+
+	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
+	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
+
+	template<typename K>
+	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
+	template<typename K>
+	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
+
+	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
+	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
+
+	template<typename K>
+	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
+	template<typename K>
+	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
+
+public: // -- cmp types -- //
+
+	key_compare key_comp() const { return wrapped().key_comp(); }
+	value_compare value_comp() const { return wrapped().value_comp(); }
 
 public: // -- cmp -- //
 
-	friend bool operator==(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_deque &a, const __gc_deque &b) { return a.wrapped() >= b.wrapped(); }
+	friend bool operator==(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator<(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() < b.wrapped(); }
+	friend bool operator<=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() <= b.wrapped(); }
+	friend bool operator>(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() > b.wrapped(); }
+	friend bool operator>=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() >= b.wrapped(); }
 };
-template<typename T, typename Allocator, typename Lockable>
-struct GC::router<__gc_deque<T, Allocator, Lockable>>
+template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
+struct GC::router<__gc_multimap<Key, T, Compare, Allocator, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
 
 	template<typename F>
-	static void route(const __gc_deque<T, Allocator, Lockable> &vec, F func)
+	static void route(const __gc_multimap<Key, T, Compare, Allocator, Lockable> &map, F func)
 	{
-		std::lock_guard lock(vec.mutex);
-		GC::route(vec.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		GC::route(map.wrapped(), func);
 	}
 };
 
-template<typename T, typename Allocator, typename Lockable>
-class __gc_forward_list
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_unordered_set
 {
 private: // -- data -- //
 
-	typedef std::forward_list<T, Allocator> wrapped_t; // the wrapped type
+	typedef std::unordered_set<Key, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_forward_list>;
+	friend struct GC::router<__gc_unordered_set>;
 
 private: // -- data accessors -- //
 
@@ -3482,14 +9024,38 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
+	typedef typename wrapped_t::key_type key_type;
 	typedef typename wrapped_t::value_type value_type;
-	typedef typename wrapped_t::allocator_type allocator_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
+	typedef typename wrapped_t::hasher hasher;
+	typedef typename wrapped_t::key_equal key_equal;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
 	typedef typename wrapped_t::reference reference;
 	typedef typename wrapped_t::const_reference const_reference;
 
@@ -3499,97 +9065,137 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::iterator iterator;
 	typedef typename wrapped_t::const_iterator const_iterator;
 
+	typedef typename wrapped_t::local_iterator local_iterator;
+	typedef typename wrapped_t::const_local_iterator const_local_iterator;
+
+	typedef typename wrapped_t::node_type node_type;
+	typedef typename wrapped_t::insert_return_type insert_return_type;
+
 public: // -- ctor / dtor -- //
 
-	__gc_forward_list()
+	__gc_unordered_set()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_forward_list(const Allocator &alloc)
+	explicit __gc_unordered_set(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
+	}
+
+	__gc_unordered_set(size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, alloc);
+	}
+	__gc_unordered_set(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, hash, alloc);
+	}
+
+	explicit __gc_unordered_set(const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(alloc);
 	}
 
-	__gc_forward_list(size_type count, const T &value, const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_unordered_set(InputIt first, InputIt last)
 	{
-		new (buffer) wrapped_t(count, value, alloc);
+		new (buffer) wrapped_t(first, last);
+	}
+	template<typename InputIt>
+	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
 	}
 
-	explicit __gc_forward_list(size_type count, const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(count, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, alloc);
 	}
 
 	template<typename InputIt>
-	__gc_forward_list(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(first, last, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
 	}
 
-	__gc_forward_list(const __gc_forward_list &other)
+	__gc_unordered_set(const __gc_unordered_set &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_forward_list(const wrapped_t &other)
+	__gc_unordered_set(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_forward_list(const __gc_forward_list &other, const Allocator &alloc)
+	__gc_unordered_set(const __gc_unordered_set &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_forward_list(const wrapped_t &other, const Allocator &alloc)
+	__gc_unordered_set(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_forward_list(__gc_forward_list &&other)
+	__gc_unordered_set(__gc_unordered_set &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_forward_list(wrapped_t &&other)
+	__gc_unordered_set(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_forward_list(__gc_forward_list &&other, const Allocator &alloc)
+	__gc_unordered_set(__gc_unordered_set &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_forward_list(wrapped_t &&other, const Allocator &alloc)
+	__gc_unordered_set(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_forward_list(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	__gc_unordered_set(std::initializer_list<value_type> init)
 	{
-		new (buffer) wrapped_t(init, alloc);
+		new (buffer) wrapped_t(init);
+	}
+	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
 	}
 
-	~__gc_forward_list()
+	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, alloc);
+	}
+	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+	}
+
+	~__gc_unordered_set()
 	{
 		wrapped().~wrapped_t();
 	}
 
 public: // -- asgn -- //
 
-	__gc_forward_list &operator=(const __gc_forward_list &other)
+	__gc_unordered_set &operator=(const __gc_unordered_set &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_forward_list &operator=(const wrapped_t &other)
+	__gc_unordered_set &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_forward_list &operator=(__gc_forward_list &&other)
+	__gc_unordered_set &operator=(__gc_unordered_set &&other)
 	{
 		if (this != &other)
 		{
@@ -3597,55 +9203,27 @@ public: // -- asgn -- //
 			wrapped() = std::move(other.wrapped());
 		}
 		return *this;
-	}
-	__gc_forward_list &operator=(wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
-	}
-
-	__gc_forward_list &operator=(std::initializer_list<T> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
-	}
-
-	void assign(size_type count, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(count, value);
-	}
-
-	template<typename InputIt>
-	void assign(InputIt first, InputIt last)
+	}
+	__gc_unordered_set &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().assign(first, last);
+		wrapped() = std::move(other);
+		return *this;
 	}
 
-	void assign(std::initializer_list<T> ilist)
+	__gc_unordered_set &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().assign(ilist);
+		wrapped() = ilist;
+		return *this;
 	}
 
 public: // -- misc -- //
 
 	allocator_type get_allocator() const { return wrapped().get_allocator(); }
 
-public: // -- obj access -- //
-
-	reference front() { return wrapped().front(); }
-	const_reference front() const { return wrapped().front(); }
-
 public: // -- iterators -- //
 
-	iterator before_begin() noexcept { return wrapped().before_begin(); }
-	const_iterator before_begin() const noexcept { return wrapped().before_begin(); }
-	const_iterator cbefore_begin() const noexcept { return wrapped().cbefore_begin(); }
-
 	iterator begin() noexcept { return wrapped().begin(); }
 	const_iterator begin() const noexcept { return wrapped().begin(); }
 	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
@@ -3657,6 +9235,7 @@ public: // -- iterators -- //
 public: // -- size / cap -- //
 
 	bool empty() const noexcept { return wrapped().empty(); }
+	size_type size() const noexcept { return wrapped().size(); }
 
 	size_type max_size() const noexcept { return wrapped().max_size(); }
 
@@ -3668,96 +9247,85 @@ public: // -- size / cap -- //
 
 public: // -- insert / erase -- //
 
-	iterator insert_after(const_iterator pos, const T &value)
+	std::pair<iterator, bool> insert(const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert_after(pos, value);
+		return wrapped().insert(value);
 	}
-	iterator insert_after(const_iterator pos, T &&value)
+	std::pair<iterator, bool> insert(value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert_after(pos, std::move(value));
+		return wrapped().insert(std::move(value));
 	}
 
-	iterator insert_after(const_iterator pos, size_type count, const T &value)
+	iterator insert(const_iterator hint, const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert_after(pos, count, value);
+		return wrapped().insert(hint, value);
 	}
-
-	template<typename InputIt>
-	iterator insert_after(const_iterator pos, InputIt first, InputIt last)
+	iterator insert(const_iterator hint, value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert_after(pos, first, last);
+		return wrapped().insert(hint, std::move(value));
 	}
 
-	iterator insert_after(const_iterator pos, std::initializer_list<T> ilist)
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert_after(pos, ilist);
+		wrapped().insert(first, last);
 	}
 
-	template<typename ...Args>
-	iterator emplace_after(const_iterator pos, Args &&...args)
+	void insert(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_after(pos, std::forward<Args>(args)...);
+		wrapped().insert(ilist);
 	}
 
-	iterator erase_after(const_iterator pos)
+	insert_return_type insert(node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase_after(pos);
+		return wrapped().insert(std::move(nh));
 	}
-	iterator erase_after(const_iterator first, const_iterator last)
+	iterator insert(const_iterator hint, node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase_after(first, last);
+		return wrapped().insert(hint, std::move(nh));
 	}
 
-public: // -- push / pop -- //
-
-	void push_front(const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().push_front(value);
-	}
-	void push_front(T &&value)
+	template<typename ...Args>
+	std::pair<iterator, bool> emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_front(std::move(value));
+		return wrapped().emplace(std::forward<Args>(args)...);
 	}
-
 	template<typename ...Args>
-	decltype(auto) emplace_front(Args &&...args)
+	iterator emplace_hint(const_iterator hint, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_front(std::forward<Args>(args)...);
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
 	}
 
-	void pop_front()
+	iterator erase(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_front();
+		return wrapped().erase(pos);
 	}
-
-public: // -- resize -- //
-
-	void resize(size_type count)
+	iterator erase(const_iterator first, const_iterator last)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count);
+		return wrapped().erase(first, last);
 	}
-	void resize(size_type count, const value_type &value)
+
+	size_type erase(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count, value);
+		return wrapped().erase(key);
 	}
 
 public: // -- swap -- //
 
-	void swap(__gc_forward_list &other)
+	void swap(__gc_unordered_set &other)
 	{
 		if (this != &other)
 		{
@@ -3771,244 +9339,126 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_forward_list &a, __gc_forward_list &b) { a.swap(b); }
-	friend void swap(__gc_forward_list &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_forward_list &b) { b.swap(a); }
-
-public: // -- cmp -- //
-
-	friend bool operator==(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_forward_list &a, const __gc_forward_list &b) { return a.wrapped() >= b.wrapped(); }
-
-public: // -- merge -- //
-
-	void merge(__gc_forward_list &other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(other.wrapped());
-		}
-	}
-	void merge(__gc_forward_list &&other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(std::move(other.wrapped()));
-		}
-	}
-
-	template<typename Compare>
-	void merge(__gc_forward_list &other, Compare comp)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(other.wrapped(), comp);
-		}
-	}
-	template<typename Compare>
-	void merge(__gc_forward_list &&other, Compare comp)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(std::move(other.wrapped()), comp);
-		}
-	}
+	friend void swap(__gc_unordered_set &a, __gc_unordered_set &b) { a.swap(b); }
+	friend void swap(__gc_unordered_set &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_unordered_set &b) { b.swap(a); }
 
-	// ------------------------------------------------------------
+public: // -- extract -- //
 
-	void merge(wrapped_t &other)
+	node_type extract(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().merge(other);
+		return wrapped().extract(pos);
 	}
-	void merge(wrapped_t &&other)
+	node_type extract(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().merge(std::move(other));
+		return wrapped().extract(key);
 	}
 
-	template<typename Compare>
-	void merge(wrapped_t &other, Compare comp)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().merge(other, comp);
-	}
-	template<typename Compare>
-	void merge(wrapped_t &&other, Compare comp)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().merge(std::move(other), comp);
-	}
+	// !! ADD MERGE FUNCTIONS (C++17)
 
-public: // -- splice -- //
+public: // -- lookup -- //
 
-	void splice_after(const_iterator pos, __gc_forward_list &other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped());
-		}
-	}
-	void splice_after(const_iterator pos, __gc_forward_list &&other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()));
-		}
-	}
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
 
-	void splice_after(const_iterator pos, __gc_forward_list &other, const_iterator it)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped(), it);
-		}
-	}
-	void splice_after(const_iterator pos, __gc_forward_list &&other, const_iterator it)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()), it);
-		}
-	}
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
 
-	void splice_after(const_iterator pos, __gc_forward_list &other, const_iterator first, const_iterator last)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped(), first, last);
-		}
-	}
-	void splice_after(const_iterator pos, __gc_forward_list &&other, const_iterator first, const_iterator last)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()), first, last);
-		}
-	}
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
 
-	// ------------------------------------------------------------
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other));
-	}
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other, const_iterator it)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other, it);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator it)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other), it);
-	}
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other, const_iterator first, const_iterator last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other, first, last);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator first, const_iterator last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other), first, last);
-	}
+public: // -- bucket interface -- //
 
-public: // -- remove -- //
+	local_iterator begin(size_type n) { return wrapped().begin(n); }
+	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
+	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
 
-	decltype(auto) remove(const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().remove(value);
-	}
+	local_iterator end(size_type n) { return wrapped().end(n); }
+	const_local_iterator end(size_type n) const { return wrapped().end(n); }
+	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
 
-	template<typename UnaryPredicate>
-	decltype(auto) remove_if(UnaryPredicate p)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().remove_if(p);
-	}
+	size_type bucket_count() const { return wrapped().bucket_count(); }
+	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
 
-public: // -- ordering -- //
+	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
+	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
 
-	void reverse() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reverse();
-	}
+public: // -- hash policy -- //
 
-	decltype(auto) unique()
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().unique();
-	}
-	template<typename BinaryPredicate>
-	decltype(auto) unique(BinaryPredicate p)
+	float load_factor() const { return wrapped().load_factor(); }
+
+	float max_load_factor() const { return wrapped().max_load_factor(); }
+	void max_load_factor(float ml)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().unique(p);
+		wrapped().max_load_factor(ml);
 	}
 
-	void sort()
+	void rehash(size_type count)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().sort();
+		wrapped().rehash(count);
 	}
-	template<typename Compare>
-	void sort(Compare comp)
+
+	void reserve(size_type count)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().sort(comp);
+		wrapped().reserve(count);
 	}
+
+public: // -- observers -- //
+
+	hasher hash_function() const { return wrapped().hash_function(); }
+	key_equal key_eq() const { return wrapped().key_eq(); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_unordered_set &a, const __gc_unordered_set &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_unordered_set &a, const __gc_unordered_set &b) { return a.wrapped() != b.wrapped(); }
 };
-template<typename T, typename Allocator, typename Lockable>
-struct GC::router<__gc_forward_list<T, Allocator, Lockable>>
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+struct GC::router<__gc_unordered_set<Key, Hash, KeyEqual, Allocator, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
 
 	template<typename F>
-	static void route(const __gc_forward_list<T, Allocator, Lockable> &list, F func)
+	static void route(const __gc_unordered_set<Key, Hash, KeyEqual, Allocator, Lockable> &set, F func)
 	{
-		std::lock_guard lock(list.mutex);
-		GC::route(list.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(set.mutex);
+		GC::route(set.wrapped(), func);
 	}
 };
 
-template<typename T, typename Allocator, typename Lockable>
-class __gc_list
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_unordered_multiset
 {
 private: // -- data -- //
 
-	typedef std::list<T, Allocator> wrapped_t; // the wrapped type
+	typedef std::unordered_multiset<Key, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_list>;
+	friend struct GC::router<__gc_unordered_multiset>;
 
 private: // -- data accessors -- //
 
@@ -4022,14 +9472,38 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
+	typedef typename wrapped_t::key_type key_type;
 	typedef typename wrapped_t::value_type value_type;
-	typedef typename wrapped_t::allocator_type allocator_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
+	typedef typename wrapped_t::hasher hasher;
+	typedef typename wrapped_t::key_equal key_equal;
+
+	typedef typename wrapped_t::allocator_type allocator_type;
+
 	typedef typename wrapped_t::reference reference;
 	typedef typename wrapped_t::const_reference const_reference;
 
@@ -4039,100 +9513,136 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::iterator iterator;
 	typedef typename wrapped_t::const_iterator const_iterator;
 
-	typedef typename wrapped_t::reverse_iterator reverse_iterator;
-	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+	typedef typename wrapped_t::local_iterator local_iterator;
+	typedef typename wrapped_t::const_local_iterator const_local_iterator;
+
+	typedef typename wrapped_t::node_type node_type;
 
 public: // -- ctor / dtor -- //
 
-	__gc_list()
+	__gc_unordered_multiset()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_list(const Allocator &alloc)
+	explicit __gc_unordered_multiset(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
+	}
+
+	__gc_unordered_multiset(size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, alloc);
+	}
+	__gc_unordered_multiset(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, hash, alloc);
+	}
+
+	explicit __gc_unordered_multiset(const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(alloc);
 	}
 
-	__gc_list(size_type count, const T &value = T(), const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_unordered_multiset(InputIt first, InputIt last)
 	{
-		new (buffer) wrapped_t(count, value, alloc);
+		new (buffer) wrapped_t(first, last);
+	}
+	template<typename InputIt>
+	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
 	}
 
-	explicit __gc_list(size_type count, const Allocator &alloc = Allocator())
+	template<typename InputIt>
+	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(count, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, alloc);
 	}
 
 	template<typename InputIt>
-	__gc_list(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
 	{
-		new (buffer) wrapped_t(first, last, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
 	}
 
-	__gc_list(const __gc_list &other)
+	__gc_unordered_multiset(const __gc_unordered_multiset &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_list(const wrapped_t &other)
+	__gc_unordered_multiset(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_list(const __gc_list &other, const Allocator &alloc)
+	__gc_unordered_multiset(const __gc_unordered_multiset &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_list(const wrapped_t &other, const Allocator &alloc)
+	__gc_unordered_multiset(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_list(__gc_list &&other)
+	__gc_unordered_multiset(__gc_unordered_multiset &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_list(wrapped_t &&other)
+	__gc_unordered_multiset(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_list(__gc_list &&other, const Allocator &alloc)
+	__gc_unordered_multiset(__gc_unordered_multiset &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_list(wrapped_t &&other, const Allocator &alloc)
+	__gc_unordered_multiset(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_list(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+	__gc_unordered_multiset(std::initializer_list<value_type> init)
 	{
-		new (buffer) wrapped_t(init, alloc);
+		new (buffer) wrapped_t(init);
+	}
+	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
 	}
 
-	~__gc_list()
+	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, alloc);
+	}
+	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+	}
+
+	~__gc_unordered_multiset()
 	{
 		wrapped().~wrapped_t();
 	}
 
 public: // -- asgn -- //
 
-	__gc_list &operator=(const __gc_list &other)
+	__gc_unordered_multiset &operator=(const __gc_unordered_multiset &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_list &operator=(const wrapped_t &other)
+	__gc_unordered_multiset &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_list &operator=(__gc_list &&other)
+	__gc_unordered_multiset &operator=(__gc_unordered_multiset &&other)
 	{
 		if (this != &other)
 		{
@@ -4141,51 +9651,24 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_list &operator=(wrapped_t &&other)
+	__gc_unordered_multiset &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_list &operator=(std::initializer_list<T> ilist)
+	__gc_unordered_multiset &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = ilist;
 		return *this;
 	}
 
-	void assign(size_type count, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(count, value);
-	}
-
-	template<typename InputIt>
-	void assign(InputIt first, InputIt last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(first, last);
-	}
-
-	void assign(std::initializer_list<T> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().assign(ilist);
-	}
-
 public: // -- misc -- //
 
 	allocator_type get_allocator() const { return wrapped().get_allocator(); }
 
-public: // -- obj access -- //
-
-	reference front() { return wrapped().front(); }
-	const_reference front() const { return wrapped().front(); }
-
-	reference back() { return wrapped().back(); }
-	const_reference back() const { return wrapped().back(); }
-
 public: // -- iterators -- //
 
 	iterator begin() noexcept { return wrapped().begin(); }
@@ -4196,143 +9679,100 @@ public: // -- iterators -- //
 	const_iterator end() const noexcept { return wrapped().end(); }
 	const_iterator cend() const noexcept { return wrapped().cend(); }
 
-	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
-
-	reverse_iterator rend() noexcept { return wrapped().rend(); }
-	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
-	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
-
 public: // -- size / cap -- //
 
 	bool empty() const noexcept { return wrapped().empty(); }
 	size_type size() const noexcept { return wrapped().size(); }
 
-	size_type max_size() const noexcept { return wrapped().max_size(); }
-
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
-	}
-
-public: // -- insert / erase -- //
-
-	iterator insert(const_iterator pos, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, value);
-	}
-	iterator insert(const_iterator pos, T &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, std::move(value));
-	}
-
-	iterator insert(const_iterator pos, size_type count, const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, count, value);
-	}
+	size_type max_size() const noexcept { return wrapped().max_size(); }
 
-	template<typename InputIt>
-	iterator insert(const_iterator pos, InputIt first, InputIt last)
+	void clear() noexcept
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, first, last);
+		wrapped().clear();
 	}
 
-	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+public: // -- insert / erase -- //
+
+	iterator insert(const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(pos, ilist);
+		return wrapped().insert(value);
 	}
-
-	template<typename ...Args>
-	iterator emplace(const_iterator pos, Args &&...args)
+	iterator insert(value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(pos, std::forward<Args>(args)...);
+		return wrapped().insert(std::move(value));
 	}
 
-	iterator erase(const_iterator pos)
+	iterator insert(const_iterator hint, const value_type &value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
+		return wrapped().insert(hint, value);
 	}
-	iterator erase(const_iterator first, const_iterator last)
+	iterator insert(const_iterator hint, value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		return wrapped().insert(hint, std::move(value));
 	}
 
-public: // -- push / pop -- //
-
-	void push_back(const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().push_back(value);
-	}
-	void push_back(T &&value)
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_back(std::move(value));
+		wrapped().insert(first, last);
 	}
 
-	template<typename ...Args>
-	decltype(auto) emplace_back(Args &&...args)
+	void insert(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_back(std::forward<Args>(args)...);
+		wrapped().insert(ilist);
 	}
 
-	void pop_back()
+	iterator insert(node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_back();
+		return wrapped().insert(std::move(nh));
 	}
-
-	void push_front(const T &value)
+	iterator insert(const_iterator hint, node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_front(value);
+		return wrapped().insert(hint, std::move(nh));
 	}
-	void push_front(T &&value)
+
+	template<typename ...Args>
+	iterator emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().push_front(std::move(value));
+		return wrapped().emplace(std::forward<Args>(args)...);
 	}
-
 	template<typename ...Args>
-	decltype(auto) emplace_front(Args &&...args)
+	iterator emplace_hint(const_iterator hint, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_front(std::forward<Args>(args)...);
+		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
 	}
 
-	void pop_front()
+	iterator erase(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().pop_front();
+		return wrapped().erase(pos);
 	}
-
-public: // -- resize -- //
-
-	void resize(size_type count)
+	iterator erase(const_iterator first, const_iterator last)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count);
+		return wrapped().erase(first, last);
 	}
-	void resize(size_type count, const value_type &value)
+
+	size_type erase(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().resize(count, value);
+		return wrapped().erase(key);
 	}
 
 public: // -- swap -- //
 
-	void swap(__gc_list &other)
+	void swap(__gc_unordered_multiset &other)
 	{
 		if (this != &other)
 		{
@@ -4346,244 +9786,126 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_list &a, __gc_list &b) { a.swap(b); }
-	friend void swap(__gc_list &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_list &b) { b.swap(a); }
-
-public: // -- cmp -- //
-
-	friend bool operator==(const __gc_list &a, const __gc_list &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_list &a, const __gc_list &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_list &a, const __gc_list &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_list &a, const __gc_list &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_list &a, const __gc_list &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_list &a, const __gc_list &b) { return a.wrapped() >= b.wrapped(); }
-
-public: // -- merge -- //
-
-	void merge(__gc_list &other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(other.wrapped());
-		}
-	}
-	void merge(__gc_list &&other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(std::move(other.wrapped()));
-		}
-	}
-
-	template<typename Compare>
-	void merge(__gc_list &other, Compare comp)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(other.wrapped(), comp);
-		}
-	}
-	template<typename Compare>
-	void merge(__gc_list &&other, Compare comp)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().merge(std::move(other.wrapped()), comp);
-		}
-	}
+	friend void swap(__gc_unordered_multiset &a, __gc_unordered_multiset &b) { a.swap(b); }
+	friend void swap(__gc_unordered_multiset &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_unordered_multiset &b) { b.swap(a); }
 
-	// ----------------------------------------------------------
+public: // -- extract -- //
 
-	void merge(wrapped_t &other)
+	node_type extract(const_iterator pos)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().merge(other);
+		return wrapped().extract(pos);
 	}
-	void merge(wrapped_t &&other)
+	node_type extract(const key_type &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().merge(std::move(other));
+		return wrapped().extract(key);
 	}
 
-	template<typename Compare>
-	void merge(wrapped_t &other, Compare comp)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().merge(other, comp);
-	}
-	template<typename Compare>
-	void merge(wrapped_t &&other, Compare comp)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().merge(std::move(other), comp);
-	}
+	// !! ADD MERGE FUNCTIONS (C++17)
 
-public: // -- splice -- //
+public: // -- lookup -- //
 
-	void splice_after(const_iterator pos, __gc_list &other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped());
-		}
-	}
-	void splice_after(const_iterator pos, __gc_list &&other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()));
-		}
-	}
+	size_type count(const Key &key) const { return wrapped().count(key); }
+	template<typename K>
+	size_type count(const K &key) const { return wrapped().count(key); }
 
-	void splice_after(const_iterator pos, __gc_list &other, const_iterator it)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped(), it);
-		}
-	}
-	void splice_after(const_iterator pos, __gc_list &&other, const_iterator it)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()), it);
-		}
-	}
+	iterator find(const Key &key) { return wrapped().find(key); }
+	const_iterator find(const Key &key) const { return wrapped().find(key); }
 
-	void splice_after(const_iterator pos, __gc_list &other, const_iterator first, const_iterator last)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, other.wrapped(), first, last);
-		}
-	}
-	void splice_after(const_iterator pos, __gc_list &&other, const_iterator first, const_iterator last)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().splice_after(pos, std::move(other.wrapped()), first, last);
-		}
-	}
+	template<typename K>
+	iterator find(const K &key) { return wrapped().find(key); }
+	template<typename K>
+	const_iterator find(const K &key) const { return wrapped().find(key); }
 
-	// ----------------------------------------------------------
+	bool contains(const Key &key) const { return wrapped().contains(key); }
+	template<typename K>
+	bool contains(const K &key) const { return wrapped().contains(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other));
-	}
+	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
+	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other, const_iterator it)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other, it);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator it)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other), it);
-	}
+	template<typename K>
+	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
+	template<typename K>
+	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
 
-	void splice_after(const_iterator pos, wrapped_t &other, const_iterator first, const_iterator last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, other, first, last);
-	}
-	void splice_after(const_iterator pos, wrapped_t &&other, const_iterator first, const_iterator last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().splice_after(pos, std::move(other), first, last);
-	}
+public: // -- bucket interface -- //
 
-public: // -- remove -- //
+	local_iterator begin(size_type n) { return wrapped().begin(n); }
+	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
+	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
 
-	decltype(auto) remove(const T &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().remove(value);
-	}
+	local_iterator end(size_type n) { return wrapped().end(n); }
+	const_local_iterator end(size_type n) const { return wrapped().end(n); }
+	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
 
-	template<typename UnaryPredicate>
-	decltype(auto) remove_if(UnaryPredicate p)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().remove_if(p);
-	}
+	size_type bucket_count() const { return wrapped().bucket_count(); }
+	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
 
-public: // -- ordering -- //
+	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
+	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
 
-	void reverse() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reverse();
-	}
+public: // -- hash policy -- //
 
-	decltype(auto) unique()
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().unique();
-	}
-	template<typename BinaryPredicate>
-	decltype(auto) unique(BinaryPredicate p)
+	float load_factor() const { return wrapped().load_factor(); }
+
+	float max_load_factor() const { return wrapped().max_load_factor(); }
+	void max_load_factor(float ml)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().unique(p);
+		wrapped().max_load_factor(ml);
 	}
 
-	void sort()
+	void rehash(size_type count)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().sort();
+		wrapped().rehash(count);
 	}
-	template<typename Compare>
-	void sort(Compare comp)
+
+	void reserve(size_type count)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().sort(comp);
+		wrapped().reserve(count);
 	}
+
+public: // -- observers -- //
+
+	hasher hash_function() const { return wrapped().hash_function(); }
+	key_equal key_eq() const { return wrapped().key_eq(); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_unordered_multiset &a, const __gc_unordered_multiset &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_unordered_multiset &a, const __gc_unordered_multiset &b) { return a.wrapped() != b.wrapped(); }
 };
-template<typename T, typename Allocator, typename Lockable>
-struct GC::router<__gc_list<T, Allocator, Lockable>>
+template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+struct GC::router<__gc_unordered_multiset<Key, Hash, KeyEqual, Allocator, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
 
 	template<typename F>
-	static void route(const __gc_list<T, Allocator, Lockable> &list, F func)
+	static void route(const __gc_unordered_multiset<Key, Hash, KeyEqual, Allocator, Lockable> &set, F func)
 	{
-		std::lock_guard lock(list.mutex);
-		GC::route(list.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(set.mutex);
+		GC::route(set.wrapped(), func);
 	}
 };
 
-template<typename Key, typename Compare, typename Allocator, typename Lockable>
-class __gc_set
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_unordered_map
 {
 private: // -- data -- //
 
-	typedef std::set<Key, Compare, Allocator> wrapped_t; // the wrapped type
+	typedef std::unordered_map<Key, T, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_set>;
+	friend struct GC::router<__gc_unordered_map>;
 
 private: // -- data accessors -- //
 
@@ -4597,16 +9919,37 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
 	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::mapped_type mapped_type;
+
 	typedef typename wrapped_t::value_type value_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
-	typedef typename wrapped_t::key_compare key_compare;
-	typedef typename wrapped_t::value_compare value_compare;
+	typedef typename wrapped_t::hasher hasher;
+	typedef typename wrapped_t::key_equal key_equal;
 
 	typedef typename wrapped_t::allocator_type allocator_type;
 
@@ -4619,106 +9962,137 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::iterator iterator;
 	typedef typename wrapped_t::const_iterator const_iterator;
 
-	typedef typename wrapped_t::reverse_iterator reverse_iterator;
-	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+	typedef typename wrapped_t::local_iterator local_iterator;
+	typedef typename wrapped_t::const_local_iterator const_local_iterator;
 
 	typedef typename wrapped_t::node_type node_type;
 	typedef typename wrapped_t::insert_return_type insert_return_type;
 
 public: // -- ctor / dtor -- //
 
-	__gc_set()
+	__gc_unordered_map()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_set(const Compare &comp, const Allocator &alloc = Allocator())
+	explicit __gc_unordered_map(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(comp, alloc);
+		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
 	}
-	explicit __gc_set(const Allocator &alloc)
+
+	__gc_unordered_map(size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, alloc);
+	}
+	__gc_unordered_map(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, hash, alloc);
+	}
+
+	explicit __gc_unordered_map(const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(alloc);
 	}
 
 	template<typename InputIt>
-	__gc_set(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	__gc_unordered_map(InputIt first, InputIt last)
 	{
-		new (buffer) wrapped_t(first, last, comp, alloc);
+		new (buffer) wrapped_t(first, last);
 	}
 	template<typename InputIt>
-	__gc_set(InputIt first, InputIt last, const Allocator &alloc)
+	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(first, last, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
 	}
 
-	__gc_set(const __gc_set &other)
+	template<typename InputIt>
+	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
+	}
+
+	__gc_unordered_map(const __gc_unordered_map &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_set(const wrapped_t &other)
+	__gc_unordered_map(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_set(const __gc_set &other, const Allocator &alloc)
+	__gc_unordered_map(const __gc_unordered_map &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_set(const wrapped_t &other, const Allocator &alloc)
+	__gc_unordered_map(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_set(__gc_set &&other)
+	__gc_unordered_map(__gc_unordered_map &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_set(wrapped_t &&other)
+	__gc_unordered_map(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_set(__gc_set &&other, const Allocator &alloc)
+	__gc_unordered_map(__gc_unordered_map &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_set(wrapped_t &&other, const Allocator &alloc)
+	__gc_unordered_map(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_set(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	__gc_unordered_map(std::initializer_list<value_type> init)
 	{
-		new (buffer) wrapped_t(init, comp, alloc);
+		new (buffer) wrapped_t(init);
 	}
-	__gc_set(std::initializer_list<value_type> init, const Allocator &alloc)
+	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(init, alloc);
+		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
 	}
 
-	~__gc_set()
+	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, alloc);
+	}
+	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+	}
+
+	~__gc_unordered_map()
 	{
 		wrapped().~wrapped_t();
 	}
 
-public: // -- asgn -- //
+public: // -- assign -- //
 
-	__gc_set &operator=(const __gc_set &other)
+	__gc_unordered_map &operator=(const __gc_unordered_map &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_set &operator=(const wrapped_t &other)
+	__gc_unordered_map &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_set &operator=(__gc_set &&other)
+	__gc_unordered_map &operator=(__gc_unordered_map &&other)
 	{
 		if (this != &other)
 		{
@@ -4727,14 +10101,14 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_set &operator=(wrapped_t &&other)
+	__gc_unordered_map &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_set &operator=(std::initializer_list<value_type> ilist)
+	__gc_unordered_map &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = ilist;
@@ -4755,14 +10129,6 @@ public: // -- iterators -- //
 	const_iterator end() const noexcept { return wrapped().end(); }
 	const_iterator cend() const noexcept { return wrapped().cend(); }
 
-	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
-
-	reverse_iterator rend() noexcept { return wrapped().rend(); }
-	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
-	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
-
 public: // -- size / cap -- //
 
 	bool empty() const noexcept { return wrapped().empty(); }
@@ -4783,45 +10149,112 @@ public: // -- insert / erase -- //
 		std::lock_guard lock(this->mutex);
 		return wrapped().insert(value);
 	}
+
+	template<typename P>
+	std::pair<iterator, bool> insert(P &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::forward<P>(value));
+	}
+
+	iterator insert(const_iterator hint, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, value);
+	}
+
+	template<typename P>
+	iterator insert(const_iterator hint, P &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::forward<P>(value));
+	}
+
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().insert(first, last);
+	}
+
+	void insert(std::initializer_list<value_type> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().insert(ilist);
+	}
+
 	std::pair<iterator, bool> insert(value_type &&value)
 	{
 		std::lock_guard lock(this->mutex);
 		return wrapped().insert(std::move(value));
 	}
+	iterator insert(const_iterator hint, value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(value));
+	}
+
+	insert_return_type insert(node_type &&nh)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(nh));
+	}
+	iterator insert(const_iterator hint, node_type &&nh)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(nh));
+	}
+
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_or_assign(k, std::forward<M>(obj));
+	}
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(key_type &&k, M &&obj)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert_or_assign(std::move(k), std::forward<M>(obj));
+	}
 
-	iterator insert(const_iterator hint, const value_type &value)
+	template<typename M>
+	iterator insert_or_assign(const_iterator hint, const key_type &k, M &&obj)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
+		return wrapped().insert_or_assign(hint, k, std::forward<M>(obj));
 	}
-	iterator insert(const_iterator hint, value_type &&value)
+	template<typename M>
+	iterator insert_or_assign(const_iterator hint, key_type &&k, M &&obj)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
+		return wrapped().insert_or_assign(hint, std::move(k), std::forward<M>(obj));
 	}
 
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
+	template<typename ...Args>
+	std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
+		return wrapped().try_emplace(k, std::forward<Args>(args)...);
 	}
-
-	void insert(std::initializer_list<value_type> ilist)
+	template<typename ...Args>
+	std::pair<iterator, bool> try_emplace(key_type &&k, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
+		return wrapped().try_emplace(std::move(k), std::forward<Args>(args)...);
 	}
 
-	insert_return_type insert(node_type &&nh)
+	template<typename ...Args>
+	iterator try_emplace(const_iterator hint, const key_type &k, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		return wrapped().try_emplace(hint, k, std::forward<Args>(args)...);
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+	template<typename ...Args>
+	iterator try_emplace(const_iterator hint, key_type &&k, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		return wrapped().try_emplace(hint, std::move(k), std::forward<Args>(args)...);
 	}
 
 	template<typename ...Args>
@@ -4848,15 +10281,15 @@ public: // -- insert / erase -- //
 		return wrapped().erase(first, last);
 	}
 
-	size_type erase(const key_type &key)
+	size_type erase(const key_type &k)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(key);
+		return wrapped().erase(k);
 	}
 
 public: // -- swap -- //
 
-	void swap(__gc_set &other)
+	void swap(__gc_unordered_map &other)
 	{
 		if (this != &other)
 		{
@@ -4870,9 +10303,9 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_set &a, __gc_set &b) { a.swap(b); }
-	friend void swap(__gc_set &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_set &b) { b.swap(a); }
+	friend void swap(__gc_unordered_map &a, __gc_unordered_map &b) { a.swap(b); }
+	friend void swap(__gc_unordered_map &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_unordered_map &b) { b.swap(a); }
 
 public: // -- extract -- //
 
@@ -4889,6 +10322,22 @@ public: // -- extract -- //
 
 	// !! ADD MERGE FUNCTIONS (C++17)
 
+public: // -- element access -- //
+
+	T &at(const Key &key) { return wrapped().at(key); }
+	const T &at(const Key &key) const { return wrapped().at(key); }
+
+	T &operator[](const Key &key)
+	{
+		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
+		return wrapped()[key];
+	}
+	T &operator[](Key &&key)
+	{
+		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
+		return wrapped()[std::move(key)];
+	}
+
 public: // -- lookup -- //
 
 	size_type count(const Key &key) const { return wrapped().count(key); }
@@ -4915,62 +10364,81 @@ public: // -- lookup -- //
 	template<typename K>
 	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
 
-	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
-	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
+public: // -- bucket interface -- //
 
-	template<typename K>
-	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
-	template<typename K>
-	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
+	local_iterator begin(size_type n) { return wrapped().begin(n); }
+	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
+	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
 
-	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
-	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
+	local_iterator end(size_type n) { return wrapped().end(n); }
+	const_local_iterator end(size_type n) const { return wrapped().end(n); }
+	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
 
-	template<typename K>
-	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
-	template<typename K>
-	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
+	size_type bucket_count() const { return wrapped().bucket_count(); }
+	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
 
-public: // -- cmp types -- //
+	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
+	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
 
-	key_compare key_comp() const { return wrapped().key_comp(); }
-	value_compare value_comp() const { return wrapped().value_comp(); }
+public: // -- hash policy -- //
+
+	float load_factor() const { return wrapped().load_factor(); }
+
+	float max_load_factor() const { return wrapped().max_load_factor(); }
+	void max_load_factor(float ml)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().max_load_factor(ml);
+	}
+
+	void rehash(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().rehash(count);
+	}
+
+	void reserve(size_type count)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reserve(count);
+	}
+
+public: // -- observers -- //
+
+	hasher hash_function() const { return wrapped().hash_function(); }
+	key_equal key_eq() const { return wrapped().key_eq(); }
 
 public: // -- cmp -- //
 
-	friend bool operator==(const __gc_set &a, const __gc_set &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_set &a, const __gc_set &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_set &a, const __gc_set &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_set &a, const __gc_set &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_set &a, const __gc_set &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_set &a, const __gc_set &b) { return a.wrapped() >= b.wrapped(); }
+	friend bool operator==(const __gc_unordered_map &a, const __gc_unordered_map &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_unordered_map &a, const __gc_unordered_map &b) { return a.wrapped() != b.wrapped(); }
 };
-template<typename Key, typename Compare, typename Allocator, typename Lockable>
-struct GC::router<__gc_set<Key, Compare, Allocator, Lockable>>
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+struct GC::router<__gc_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
 
 	template<typename F>
-	static void route(const __gc_set<Key, Compare, Allocator, Lockable> &set, F func)
+	static void route(const __gc_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable> &map, F func)
 	{
-		std::lock_guard lock(set.mutex);
-		GC::route(set.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		GC::route(map.wrapped(), func);
 	}
 };
 
-template<typename Key, typename Compare, typename Allocator, typename Lockable>
-class __gc_multiset
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_unordered_multimap
 {
 private: // -- data -- //
 
-	typedef std::multiset<Key, Compare, Allocator> wrapped_t; // the wrapped type
+	typedef std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_multiset>;
+	friend struct GC::router<__gc_unordered_multimap>;
 
 private: // -- data accessors -- //
 
@@ -4984,16 +10452,37 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
+public: // -- transactional access -- //
+
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+
 public: // -- typedefs -- //
 
 	typedef typename wrapped_t::key_type key_type;
+	typedef typename wrapped_t::mapped_type mapped_type;
+
 	typedef typename wrapped_t::value_type value_type;
 
 	typedef typename wrapped_t::size_type size_type;
 	typedef typename wrapped_t::difference_type difference_type;
 
-	typedef typename wrapped_t::key_compare key_compare;
-	typedef typename wrapped_t::value_compare value_compare;
+	typedef typename wrapped_t::hasher hasher;
+	typedef typename wrapped_t::key_equal key_equal;
 
 	typedef typename wrapped_t::allocator_type allocator_type;
 
@@ -5006,105 +10495,136 @@ public: // -- typedefs -- //
 	typedef typename wrapped_t::iterator iterator;
 	typedef typename wrapped_t::const_iterator const_iterator;
 
-	typedef typename wrapped_t::reverse_iterator reverse_iterator;
-	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+	typedef typename wrapped_t::local_iterator local_iterator;
+	typedef typename wrapped_t::const_local_iterator const_local_iterator;
 
 	typedef typename wrapped_t::node_type node_type;
 
 public: // -- ctor / dtor -- //
 
-	__gc_multiset()
+	__gc_unordered_multimap()
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_multiset(const Compare &comp, const Allocator &alloc = Allocator())
+	explicit __gc_unordered_multimap(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(comp, alloc);
+		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
 	}
-	explicit __gc_multiset(const Allocator &alloc)
+
+	__gc_unordered_multimap(size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, alloc);
+	}
+	__gc_unordered_multimap(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(bucket_count, hash, alloc);
+	}
+
+	explicit __gc_unordered_multimap(const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(alloc);
 	}
 
 	template<typename InputIt>
-	__gc_multiset(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	__gc_unordered_multimap(InputIt first, InputIt last)
 	{
-		new (buffer) wrapped_t(first, last, comp, alloc);
+		new (buffer) wrapped_t(first, last);
 	}
 	template<typename InputIt>
-	__gc_multiset(InputIt first, InputIt last, const Allocator &alloc)
+	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(first, last, alloc);
+		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
 	}
 
-	__gc_multiset(const __gc_multiset &other)
+	template<typename InputIt>
+	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+	}
+
+	template<typename InputIt>
+	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
+	}
+
+	__gc_unordered_multimap(const __gc_unordered_multimap &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_multiset(const wrapped_t &other)
+	__gc_unordered_multimap(const wrapped_t &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_multiset(const __gc_multiset &other, const Allocator &alloc)
+	__gc_unordered_multimap(const __gc_unordered_multimap &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other.wrapped(), alloc);
 	}
-	__gc_multiset(const wrapped_t &other, const Allocator &alloc)
+	__gc_unordered_multimap(const wrapped_t &other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(other, alloc);
 	}
 
-	__gc_multiset(__gc_multiset &&other)
+	__gc_unordered_multimap(__gc_unordered_multimap &&other)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_multiset(wrapped_t &&other)
+	__gc_unordered_multimap(wrapped_t &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_multiset(__gc_multiset &&other, const Allocator &alloc)
+	__gc_unordered_multimap(__gc_unordered_multimap &&other, const Allocator &alloc)
 	{
 		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
 	}
-	__gc_multiset(wrapped_t &&other, const Allocator &alloc)
+	__gc_unordered_multimap(wrapped_t &&other, const Allocator &alloc)
 	{
 		new (buffer) wrapped_t(std::move(other), alloc);
 	}
 
-	__gc_multiset(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	__gc_unordered_multimap(std::initializer_list<value_type> init)
 	{
-		new (buffer) wrapped_t(init, comp, alloc);
+		new (buffer) wrapped_t(init);
 	}
-	__gc_multiset(std::initializer_list<value_type> init, const Allocator &alloc)
+	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
 	{
-		new (buffer) wrapped_t(init, alloc);
+		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
 	}
 
-	~__gc_multiset()
+	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, alloc);
+	}
+	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	{
+		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+	}
+
+	~__gc_unordered_multimap()
 	{
 		wrapped().~wrapped_t();
 	}
 
-public: // -- asgn -- //
+public: // -- assign -- //
 
-	__gc_multiset &operator=(const __gc_multiset &other)
+	__gc_unordered_multimap &operator=(const __gc_unordered_multimap &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_multiset &operator=(const wrapped_t &other)
+	__gc_unordered_multimap &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_multiset &operator=(__gc_multiset &&other)
+	__gc_unordered_multimap &operator=(__gc_unordered_multimap &&other)
 	{
 		if (this != &other)
 		{
@@ -5113,14 +10633,14 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_multiset &operator=(wrapped_t &&other)
+	__gc_unordered_multimap &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_multiset &operator=(std::initializer_list<value_type> ilist)
+	__gc_unordered_multimap &operator=(std::initializer_list<value_type> ilist)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = ilist;
@@ -5141,14 +10661,6 @@ public: // -- iterators -- //
 	const_iterator end() const noexcept { return wrapped().end(); }
 	const_iterator cend() const noexcept { return wrapped().cend(); }
 
-	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
-
-	reverse_iterator rend() noexcept { return wrapped().rend(); }
-	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
-	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
-
 public: // -- size / cap -- //
 
 	bool empty() const noexcept { return wrapped().empty(); }
@@ -5169,10 +10681,12 @@ public: // -- insert / erase -- //
 		std::lock_guard lock(this->mutex);
 		return wrapped().insert(value);
 	}
-	iterator insert(value_type &&value)
+
+	template<typename P>
+	iterator insert(P &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
+		return wrapped().insert(std::forward<P>(value));
 	}
 
 	iterator insert(const_iterator hint, const value_type &value)
@@ -5180,10 +10694,12 @@ public: // -- insert / erase -- //
 		std::lock_guard lock(this->mutex);
 		return wrapped().insert(hint, value);
 	}
-	iterator insert(const_iterator hint, value_type &&value)
+
+	template<typename P>
+	iterator insert(const_iterator hint, P &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
+		return wrapped().insert(hint, std::forward<P>(value));
 	}
 
 	template<typename InputIt>
@@ -5199,6 +10715,17 @@ public: // -- insert / erase -- //
 		wrapped().insert(ilist);
 	}
 
+	iterator insert(value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(std::move(value));
+	}
+	iterator insert(const_iterator hint, value_type &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return wrapped().insert(hint, std::move(value));
+	}
+
 	iterator insert(node_type &&nh)
 	{
 		std::lock_guard lock(this->mutex);
@@ -5211,7 +10738,7 @@ public: // -- insert / erase -- //
 	}
 
 	template<typename ...Args>
-	std::pair<iterator, bool> emplace(Args &&...args)
+	iterator emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
 		return wrapped().emplace(std::forward<Args>(args)...);
@@ -5234,15 +10761,15 @@ public: // -- insert / erase -- //
 		return wrapped().erase(first, last);
 	}
 
-	size_type erase(const key_type &key)
+	size_type erase(const key_type &k)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(key);
+		return wrapped().erase(k);
 	}
 
 public: // -- swap -- //
 
-	void swap(__gc_multiset &other)
+	void swap(__gc_unordered_multimap &other)
 	{
 		if (this != &other)
 		{
@@ -5256,9 +10783,9 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_multiset &a, __gc_multiset &b) { a.swap(b); }
-	friend void swap(__gc_multiset &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_multiset &b) { b.swap(a); }
+	friend void swap(__gc_unordered_multimap &a, __gc_unordered_multimap &b) { a.swap(b); }
+	friend void swap(__gc_unordered_multimap &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_unordered_multimap &b) { b.swap(a); }
 
 public: // -- extract -- //
 
@@ -5301,420 +10828,263 @@ public: // -- lookup -- //
 	template<typename K>
 	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
 
-	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
-	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
-
-	template<typename K>
-	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
-	template<typename K>
-	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
-
-	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
-	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
-
-	template<typename K>
-	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
-	template<typename K>
-	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
-
-public: // -- cmp types -- //
-
-	key_compare key_comp() const { return wrapped().key_comp(); }
-	value_compare value_comp() const { return wrapped().value_comp(); }
-
-public: // -- cmp -- //
-
-	friend bool operator==(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_multiset &a, const __gc_multiset &b) { return a.wrapped() >= b.wrapped(); }
-};
-template<typename Key, typename Compare, typename Allocator, typename Lockable>
-struct GC::router<__gc_multiset<Key, Compare, Allocator, Lockable>>
-{
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
-
-	template<typename F>
-	static void route(const __gc_multiset<Key, Compare, Allocator, Lockable> &set, F func)
-	{
-		std::lock_guard lock(set.mutex);
-		GC::route(set.wrapped(), func);
-	}
-};
-
-template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
-class __gc_map
-{
-private: // -- data -- //
-
-	typedef std::map<Key, T, Compare, Allocator> wrapped_t; // the wrapped type
-
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
-
-	mutable Lockable mutex; // router synchronizer
-
-	friend struct GC::router<__gc_map>;
-
-private: // -- data accessors -- //
-
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
-
-public: // -- wrapped obj access -- //
-
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
-
-public: // -- typedefs -- //
-
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::mapped_type mapped_type;
-
-	typedef typename wrapped_t::value_type value_type;
-
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
-
-	typedef typename wrapped_t::key_compare key_compare;
-
-	typedef typename wrapped_t::allocator_type allocator_type;
-
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
-
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
-
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
-
-	typedef typename wrapped_t::reverse_iterator reverse_iterator;
-	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
-
-	typedef typename wrapped_t::node_type node_type;
-	typedef typename wrapped_t::insert_return_type insert_return_type;
+public: // -- bucket interface -- //
 
-	typedef typename wrapped_t::value_compare value_compare; // alias __gc_map's nested value_compare class
+	local_iterator begin(size_type n) { return wrapped().begin(n); }
+	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
+	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
 
-public: // -- ctor / dtor -- //
+	local_iterator end(size_type n) { return wrapped().end(n); }
+	const_local_iterator end(size_type n) const { return wrapped().end(n); }
+	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
 
-	__gc_map()
-	{
-		new (buffer) wrapped_t();
-	}
-	explicit __gc_map(const Compare &comp, const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(comp, alloc);
-	}
-	explicit __gc_map(const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(alloc);
-	}
+	size_type bucket_count() const { return wrapped().bucket_count(); }
+	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
 
-	template<typename InputIt>
-	__gc_map(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(first, last, comp, alloc);
-	}
-	template<typename InputIt>
-	__gc_map(InputIt first, InputIt last, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(first, last, alloc);
-	}
+	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
+	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
 
-	__gc_map(const __gc_map &other)
-	{
-		new (buffer) wrapped_t(other.wrapped());
-	}
-	__gc_map(const wrapped_t &other)
-	{
-		new (buffer) wrapped_t(other);
-	}
+public: // -- hash policy -- //
 
-	__gc_map(const __gc_map &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
-	}
-	__gc_map(const wrapped_t &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other, alloc);
-	}
+	float load_factor() const { return wrapped().load_factor(); }
 
-	__gc_map(__gc_map &&other)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
-	}
-	__gc_map(wrapped_t &&other)
+	float max_load_factor() const { return wrapped().max_load_factor(); }
+	void max_load_factor(float ml)
 	{
-		new (buffer) wrapped_t(std::move(other));
+		std::lock_guard lock(this->mutex);
+		wrapped().max_load_factor(ml);
 	}
 
-	__gc_map(__gc_map &&other, const Allocator &alloc)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
-	}
-	__gc_map(wrapped_t &&other, const Allocator &alloc)
+	void rehash(size_type count)
 	{
-		new (buffer) wrapped_t(std::move(other), alloc);
+		std::lock_guard lock(this->mutex);
+		wrapped().rehash(count);
 	}
 
-	__gc_map(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(init, comp, alloc);
-	}
-	__gc_map(std::initializer_list<value_type> init, const Allocator &alloc)
+	void reserve(size_type count)
 	{
-		new (buffer) wrapped_t(init, alloc);
+		std::lock_guard lock(this->mutex);
+		wrapped().reserve(count);
 	}
 
-	~__gc_map()
-	{
-		wrapped().~wrapped_t();
-	}
+public: // -- observers -- //
 
-public: // -- asgn -- //
+	hasher hash_function() const { return wrapped().hash_function(); }
+	key_equal key_eq() const { return wrapped().key_eq(); }
 
-	__gc_map &operator=(const __gc_map &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
-	}
-	__gc_map &operator=(const wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
-	}
+public: // -- cmp -- //
 
-	__gc_map &operator=(__gc_map &&other)
-	{
-		if (this != &other)
-		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
-		}
-		return *this;
-	}
-	__gc_map &operator=(wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
-	}
+	friend bool operator==(const __gc_unordered_multimap &a, const __gc_unordered_multimap &b) { return a.wrapped() == b.wrapped(); }
+	friend bool operator!=(const __gc_unordered_multimap &a, const __gc_unordered_multimap &b) { return a.wrapped() != b.wrapped(); }
+};
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+struct GC::router<__gc_unordered_multimap<Key, T, Hash, KeyEqual, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
 
-	__gc_map &operator=(std::initializer_list<value_type> ilist)
+	template<typename F>
+	static void route(const __gc_unordered_multimap<Key, T, Hash, KeyEqual, Allocator, Lockable> &map, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		GC::route(map.wrapped(), func);
 	}
+};
 
-public: // -- misc -- //
-
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+// -------------------------------------------------------------------------
 
-public: // -- element access -- //
+// checks if T is a valid type for value forwarding ctor/asgn for __gc_variant type objects.
+// the type checked should already be passed through std::decay.
+template<typename T>
+struct __gc_variant_valid_forward_type : std::true_type {};
 
-	T &at(const Key &key) { return wrapped().at(key); }
-	const T &at(const Key &key) const { return wrapped().at(key); }
+template<typename Lockable, typename ...Types>
+struct __gc_variant_valid_forward_type<__gc_variant<Lockable, Types...>> : std::false_type {};
+template<typename ...Types>
+struct __gc_variant_valid_forward_type<std::variant<Types...>> : std::false_type {};
 
-	T &operator[](const Key &key)
-	{
-		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
-		return wrapped()[key];
-	}
-	T &operator[](Key &&key)
-	{
-		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
-		return wrapped()[std::move(key)];
-	}
+template<typename T>
+struct __gc_variant_valid_forward_type<std::in_place_type_t<T>> : std::false_type {};
+template<std::size_t I>
+struct __gc_variant_valid_forward_type<std::in_place_index_t<I>> : std::false_type {};
 
-public: // -- iterators -- //
+template<typename Lockable, typename ...Types>
+class __gc_variant
+{
+private: // -- data -- //
 
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+	typedef std::variant<Types...> wrapped_t; // the wrapped type
 
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
+	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
-	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
+	mutable Lockable mutex; // router synchronizer
 
-	reverse_iterator rend() noexcept { return wrapped().rend(); }
-	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
-	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
+	friend struct GC::router<__gc_variant>;
+	
+	friend struct std::hash<__gc_variant>;
 
-public: // -- size / cap -- //
+private: // -- data accessors -- //
 
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
+	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
+	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
+	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
 
-	size_type max_size() const noexcept { return wrapped().max_size(); }
+public: // -- wrapped obj access -- //
 
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
-	}
+	// gets the std::variant wrapped object
+	operator const wrapped_t&() const& { return wrapped(); }
+	operator wrapped_t() && { return std::move(wrapped()); }
 
-public: // -- insert / erase -- //
+public: // -- transactional access -- //
 
-	std::pair<iterator, bool> insert(const value_type &value)
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
+		return std::forward<F>(f)(wrapped());
 	}
-	template<typename P>
-	std::pair<iterator, bool> insert(P &&value)
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::forward<P>(value));
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
 	}
 
-	iterator insert(const_iterator hint, const value_type &value)
+public: // -- ctor / dtor -- //
+	
+	constexpr __gc_variant()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
+		new (buffer) wrapped_t();
 	}
 
-	template<typename P>
-	iterator insert(const_iterator hint, P &&value)
+	constexpr __gc_variant(const __gc_variant &other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::forward<P>(value));
+		new (buffer) wrapped_t(other.wrapped());
 	}
-
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
+	constexpr __gc_variant(const wrapped_t &other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
+		new (buffer) wrapped_t(other);
 	}
 
-	void insert(std::initializer_list<value_type> ilist)
+	constexpr __gc_variant(__gc_variant &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-
-	std::pair<iterator, bool> insert(value_type &&value)
+	constexpr __gc_variant(wrapped_t &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
+		new (buffer) wrapped_t(std::move(other));
 	}
-	iterator insert(const_iterator hint, value_type &&value)
+
+	template<typename T, std::enable_if_t<__gc_variant_valid_forward_type<std::decay_t<T>>::value, int> = 0>
+	constexpr __gc_variant(T &&t)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
+		new (buffer) wrapped_t(std::forward<T>(t));
 	}
 
-	insert_return_type insert(node_type &&nh)
+	template<typename T, typename ...Args>
+	constexpr explicit __gc_variant(std::in_place_type_t<T>, Args &&...args)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		new (buffer) wrapped_t(std::in_place_type<T>, std::forward<Args>(args)...);
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+	template<typename T, typename U, typename ...Args>
+	constexpr explicit __gc_variant(std::in_place_type_t<T>, std::initializer_list<U> il, Args &&...args)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		new (buffer) wrapped_t(std::in_place_type<T>, il, std::forward<Args>(args)...);
 	}
 
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj)
+	template<std::size_t I, typename ...Args>
+	constexpr explicit __gc_variant(std::in_place_index_t<I>, Args &&...args)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(k, std::forward<M>(obj));
+		new (buffer) wrapped_t(std::in_place_index<I>, std::forward<Args>(args)...);
 	}
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(key_type &&k, M &&obj)
+	template<std::size_t I, typename U, typename ...Args>
+	constexpr explicit __gc_variant(std::in_place_index_t<I>, std::initializer_list<U> il, Args &&...args)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(std::move(k), std::forward<M>(obj));
+		new (buffer) wrapped_t(std::in_place_index<I>, il, std::forward<Args>(args)...);
 	}
 
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(const_iterator hint, const key_type &k, M &&obj)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(hint, k, std::forward<M>(obj));
-	}
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(const_iterator hint, key_type &&k, M &&obj)
+	~__gc_variant()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(hint, std::move(k), std::forward<M>(obj));
+		wrapped().~wrapped_t();
 	}
 
-	template<typename ...Args>
-	std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
+public: // -- assign -- //
+
+	__gc_variant &operator=(const __gc_variant &other)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(k, std::forward<Args>(args)...);
+		wrapped() = other.wrapped();
+		return *this;
 	}
-	template<typename ...Args>
-	std::pair<iterator, bool> try_emplace(key_type &&k, Args &&...args)
+	__gc_variant &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(std::move(k), std::forward<Args>(args)...);
+		wrapped() = other;
+		return *this;
 	}
 
-	template<typename ...Args>
-	iterator try_emplace(const_iterator hint, const key_type &k, Args &&...args)
+	__gc_variant &operator=(__gc_variant &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(hint, k, std::forward<Args>(args)...);
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			wrapped() = std::move(other.wrapped());
+		}
+		return *this;
 	}
-	template<typename ...Args>
-	iterator try_emplace(const_iterator hint, key_type &&k, Args &&...args)
+	__gc_variant &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(hint, std::move(k), std::forward<Args>(args)...);
+		wrapped() = std::move(other);
+		return *this;
 	}
 
-	template<typename ...Args>
-	std::pair<iterator, bool> emplace(Args &&...args)
+	template<typename T, std::enable_if_t<!std::is_same<std::decay_t<T>, __gc_variant>::value, int> = 0>
+	__gc_variant &operator=(T &&t)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		wrapped() = std::forward<T>(t);
+		return *this;
 	}
-	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
+
+public: // -- observers -- //
+
+	constexpr std::size_t index() const noexcept { return wrapped().index(); }
+	constexpr bool valueless_by_exception() const noexcept { return wrapped().valueless_by_exception(); }
+
+public: // -- modifiers -- //
+
+	template<typename T, typename ...Args>
+	decltype(auto) emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+		return wrapped().template emplace<T>(std::forward<Args>(args)...);
 	}
-
-	iterator erase(const_iterator pos)
+	template<typename T, typename U, typename ...Args>
+	decltype(auto) emplace(std::initializer_list<U> il, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
+		return wrapped().template emplace<T>(il, std::forward<Args>(args)...);
 	}
-	iterator erase(const_iterator first, const_iterator last)
+
+	template<std::size_t I, typename ...Args>
+	decltype(auto) emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		return wrapped().template emplace<I>(std::forward<Args>(args)...);
 	}
-
-	size_type erase(const key_type &k)
+	template<std::size_t I, typename U, typename ...Args>
+	decltype(auto) emplace(std::initializer_list<U> il, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(k);
+		return wrapped().template emplace<I>(il, std::forward<Args>(args)...);
 	}
 
-public: // -- swap -- //
-
-	void swap(__gc_map &other)
+	void swap(__gc_variant &other)
 	{
 		if (this != &other)
 		{
@@ -5728,107 +11098,131 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_map &a, __gc_map &b) { a.swap(b); }
-	friend void swap(__gc_map &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_map &b) { b.swap(a); }
-
-public: // -- extract -- //
+	friend void swap(__gc_variant &a, __gc_variant &b) { a.swap(b); }
+	friend void swap(__gc_variant &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_variant &b) { b.swap(a); }
 
-	node_type extract(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
-	}
-	node_type extract(const key_type &key)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
-	}
+public: // -- helpers -- //
 
-	// !! ADD MERGE FUNCTIONS (C++17)
+	// equivalent to std::get<I> for the wrapped object.
+	// safe to use, but because std::variant doesn't have this i suggest you use GC::get<I> instead for compatibility.
+	template<std::size_t I>
+	constexpr decltype(auto) get() & { return std::get<I>(wrapped()); }
+	template<std::size_t I>
+	constexpr decltype(auto) get() const& { return std::get<I>(wrapped()); }
+	template<std::size_t I>
+	constexpr decltype(auto) get() && { return std::get<I>(std::move(wrapped())); }
 
-public: // -- lookup -- //
+	// equivalent to std::get<T> for the wrapped object.
+	// safe to use, but because std::variant doesn't have this i suggest you use GC::get<T> instead for compatibility.
+	template<typename T>
+	constexpr decltype(auto) get() & { return std::get<T>(wrapped()); }
+	template<typename T>
+	constexpr decltype(auto) get() const& { return std::get<T>(wrapped()); }
+	template<typename T>
+	constexpr decltype(auto) get() && { return std::get<T>(std::move(wrapped())); }
 
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
+	// equivalent to std::get_if<I> for the wrapped object (except that this can't be null).
+	// safe to use, but because std::variant doesn't have this i suggest you use GC::get_if<I> instead for compatibility.
+	template<std::size_t I>
+	constexpr decltype(auto) get_if() & { return std::get_if<I>(std::addressof(wrapped())); }
+	template<std::size_t I>
+	constexpr decltype(auto) get_if() const& { return std::get_if<I>(std::addressof(wrapped())); }
 
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
+	// equivalent to std::get_if<T> for the wrapped object (except that this can't be null).
+	// safe to use, but because std::variant doesn't have this i suggest you use GC::get_if<T> instead for compatibility.
+	template<typename T>
+	constexpr decltype(auto) get_if() & { return std::get_if<T>(std::addressof(wrapped())); }
+	template<typename T>
+	constexpr decltype(auto) get_if() const& { return std::get_if<T>(std::addressof(wrapped())); }
 
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
+	// equivalent to std::holds_alternative<T> for the wrapped object
+	template<typename T>
+	constexpr bool holds_alternative() const noexcept { return std::holds_alternative<T>(wrapped()); }
 
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
+public: // -- comparison -- //
 
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+	friend constexpr bool operator==(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() == b.wrapped(); }
+	friend constexpr bool operator!=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() != b.wrapped(); }
+	friend constexpr bool operator<(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() < b.wrapped(); }
+	friend constexpr bool operator<=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() <= b.wrapped(); }
+	friend constexpr bool operator>(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() > b.wrapped(); }
+	friend constexpr bool operator>=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() >= b.wrapped(); }
+};
+template<typename Lockable, typename ...Types>
+struct GC::router<__gc_variant<Lockable, Types...>>
+{
+	// if all the variant options are trivial, the variant is always trivial
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Types...>::value;
 
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+	template<typename F>
+	static void route(const __gc_variant<Lockable, Types...> &var, F func)
+	{
+		GC::router_lock_t<Lockable> lock(var.mutex);
+		GC::route(var.wrapped(), func);
+	}
+};
 
-	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
-	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
+namespace std
+{
+	template<std::size_t I, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &var) { return var.template get<I>(); }
+	template<std::size_t I, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(const __gc_variant<Lockable, Types...> &var) { return var.template get<I>(); }
+	template<std::size_t I, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &&var) { return std::move(var).template get<I>(); }
 
-	template<typename K>
-	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
-	template<typename K>
-	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &var) { return var.template get<T>(); }
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(const __gc_variant<Lockable, Types...> &var) { return var.template get<T>(); }
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &&var) { return std::move(var).template get<T>(); }
 
-	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
-	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
+	template<std::size_t I, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get_if(__gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<I>() : nullptr; }
+	template<std::size_t I, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get_if(const __gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<I>() : nullptr; }
 
-	template<typename K>
-	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
-	template<typename K>
-	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get_if(__gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<T>() : nullptr; }
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr decltype(auto) get_if(const __gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<T>() : nullptr; }
 
-public: // -- cmp types -- //
+	template<typename T, typename Lockable, typename ...Types>
+	constexpr bool holds_alternative(const __gc_variant<Lockable, Types...> &var) noexcept { return var.template holds_alternative<T>(); }
+}
 
-	key_compare key_comp() const { return wrapped().key_comp(); }
-	value_compare value_comp() const { return wrapped().value_comp(); }
+template<typename Lockable, typename ...Types>
+struct std::variant_size<__gc_variant<Lockable, Types...>> : std::variant_size<std::variant<Types...>> {};
 
-public: // -- cmp -- //
+template<std::size_t I, typename Lockable, typename ...Types>
+struct std::variant_alternative<I, __gc_variant<Lockable, Types...>> : std::variant_alternative<I, std::variant<Types...>> {};
 
-	friend bool operator==(const __gc_map &a, const __gc_map &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_map &a, const __gc_map &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_map &a, const __gc_map &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_map &a, const __gc_map &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_map &a, const __gc_map &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_map &a, const __gc_map &b) { return a.wrapped() >= b.wrapped(); }
-};
-template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
-struct GC::router<__gc_map<Key, T, Compare, Allocator, Lockable>>
+// hash function for gc variant
+template<typename Lockable, typename ...Types>
+struct std::hash<__gc_variant<Lockable, Types...>>
 {
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
-
-	template<typename F>
-	static void route(const __gc_map<Key, T, Compare, Allocator, Lockable> &map, F func)
-	{
-		std::lock_guard lock(map.mutex);
-		GC::route(map.wrapped(), func);
-	}
+	std::hash<std::variant<Types...>> hasher; // the hasher may be non-trivial, so store it
+	std::size_t operator()(const __gc_variant<Lockable, Types...> &var) const { return hasher(var.wrapped()); }
 };
 
-template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
-class __gc_multimap
+// ------------------------------------------------------------------------------------
+
+template<typename T, typename Lockable>
+class __gc_optional
 {
 private: // -- data -- //
 
-	typedef std::multimap<Key, T, Compare, Allocator> wrapped_t; // the wrapped type
+	typedef std::optional<T> wrapped_t; // the wrapped type
 
 	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_multimap>;
+	friend struct GC::router<__gc_optional>;
+
+	friend struct std::hash<__gc_optional>;
 
 private: // -- data accessors -- //
 
@@ -5842,130 +11236,152 @@ public: // -- wrapped obj access -- //
 	operator const wrapped_t&() const& { return wrapped(); }
 	operator wrapped_t() && { return std::move(wrapped()); }
 
-public: // -- typedefs -- //
-
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::mapped_type mapped_type;
-
-	typedef typename wrapped_t::value_type value_type;
-
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
-
-	typedef typename wrapped_t::key_compare key_compare;
-
-	typedef typename wrapped_t::allocator_type allocator_type;
-
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
-
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
-
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
+public: // -- transactional access -- //
 
-	typedef typename wrapped_t::reverse_iterator reverse_iterator;
-	typedef typename wrapped_t::const_reverse_iterator const_reverse_iterator;
+	// invokes f with a reference to the wrapped object under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// the const form only takes a shared lock if the lockable supports it, and so only allows reading.
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(wrapped());
+	}
 
-	typedef typename wrapped_t::node_type node_type;
+public: // -- types -- //
 
-	typedef typename wrapped_t::value_compare value_compare; // alias __gc_multimap's nested value_compare class
+	typedef T value_type;
 
 public: // -- ctor / dtor -- //
 
-	__gc_multimap()
+	constexpr __gc_optional() noexcept
 	{
 		new (buffer) wrapped_t();
 	}
-	explicit __gc_multimap(const Compare &comp, const Allocator &alloc = Allocator())
+	constexpr __gc_optional(std::nullopt_t) noexcept
 	{
-		new (buffer) wrapped_t(comp, alloc);
+		new (buffer) wrapped_t(std::nullopt);
 	}
-	explicit __gc_multimap(const Allocator &alloc)
+
+	constexpr __gc_optional(const __gc_optional &other)
 	{
-		new (buffer) wrapped_t(alloc);
+		new (buffer) wrapped_t(other.wrapped());
+	}
+	constexpr __gc_optional(const wrapped_t &other)
+	{
+		new (buffer) wrapped_t(other);
 	}
 
-	template<typename InputIt>
-	__gc_multimap(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	constexpr __gc_optional(__gc_optional &&other)
 	{
-		new (buffer) wrapped_t(first, last, comp, alloc);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	template<typename InputIt>
-	__gc_multimap(InputIt first, InputIt last, const Allocator &alloc)
+	constexpr __gc_optional(wrapped_t &&other)
 	{
-		new (buffer) wrapped_t(first, last, alloc);
+		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_multimap(const __gc_multimap &other)
+	template<typename U, typename ULockable, std::enable_if_t<std::is_convertible<const U&, T>::value, int> = 0>
+	__gc_optional(const __gc_optional<U, ULockable> &other)
 	{
 		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_multimap(const wrapped_t &other)
+	template<typename U, std::enable_if_t<std::is_convertible<const U&, T>::value, int> = 0>
+	__gc_optional(const std::optional<U> &other)
 	{
 		new (buffer) wrapped_t(other);
 	}
 
-	__gc_multimap(const __gc_multimap &other, const Allocator &alloc)
+	template<typename U, typename ULockable, std::enable_if_t<!std::is_convertible<const U&, T>::value, int> = 0>
+	explicit __gc_optional(const __gc_optional<U, ULockable> &other)
 	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
+		new (buffer) wrapped_t(other.wrapped());
 	}
-	__gc_multimap(const wrapped_t &other, const Allocator &alloc)
+	template<typename U, std::enable_if_t<!std::is_convertible<const U&, T>::value, int> = 0>
+	explicit __gc_optional(const std::optional<U> &other)
 	{
-		new (buffer) wrapped_t(other, alloc);
+		new (buffer) wrapped_t(other);
 	}
 
-	__gc_multimap(__gc_multimap &&other)
+	template<typename U, typename ULockable, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
+	__gc_optional(__gc_optional<U, ULockable> &&other)
 	{
-		std::lock_guard lock(other.mutex);
 		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_multimap(wrapped_t &&other)
+	template<typename U, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
+	__gc_optional(std::optional<U> &&other)
 	{
 		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_multimap(__gc_multimap &&other, const Allocator &alloc)
+	template<typename U, typename ULockable, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
+	explicit __gc_optional(__gc_optional<U, ULockable> &&other)
 	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+		new (buffer) wrapped_t(std::move(other.wrapped()));
 	}
-	__gc_multimap(wrapped_t &&other, const Allocator &alloc)
+	template<typename U, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
+	explicit __gc_optional(std::optional<U> &&other)
 	{
-		new (buffer) wrapped_t(std::move(other), alloc);
+		new (buffer) wrapped_t(std::move(other));
 	}
 
-	__gc_multimap(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+	template<typename ...Args>
+	constexpr explicit __gc_optional(std::in_place_t, Args &&...args)
 	{
-		new (buffer) wrapped_t(init, comp, alloc);
+		new (buffer) wrapped_t(std::in_place, std::forward<Args>(args)...);
+	}
+	template<typename U, typename ...Args>
+	constexpr explicit __gc_optional(std::in_place_t, std::initializer_list<U> il, Args &&...args)
+	{
+		new (buffer) wrapped_t(std::in_place, il, std::forward<Args>(args)...);
+	}
+
+	template<typename U = value_type, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
+	constexpr __gc_optional(U &&value)
+	{
+		new (buffer) wrapped_t(std::forward<U>(value));
 	}
-	__gc_multimap(std::initializer_list<value_type> init, const Allocator &alloc)
+	template<typename U = value_type, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
+	constexpr explicit __gc_optional(U &&value)
 	{
-		new (buffer) wrapped_t(init, alloc);
+		new (buffer) wrapped_t(std::forward<U>(value));
 	}
 
-	~__gc_multimap()
+	~__gc_optional()
 	{
 		wrapped().~wrapped_t();
 	}
 
-public: // -- asgn -- //
+public: // -- assign -- //
 
-	__gc_multimap &operator=(const __gc_multimap &other)
+	__gc_optional &operator=(std::nullopt_t)
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped() = std::nullopt;
+		return *this;
+	}
+
+	constexpr __gc_optional &operator=(const __gc_optional &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other.wrapped();
 		return *this;
 	}
-	__gc_multimap &operator=(const wrapped_t &other)
+	constexpr __gc_optional &operator=(const wrapped_t &other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = other;
 		return *this;
 	}
 
-	__gc_multimap &operator=(__gc_multimap &&other)
+	constexpr __gc_optional &operator=(__gc_optional &&other)
 	{
 		if (this != &other)
 		{
@@ -5974,150 +11390,97 @@ public: // -- asgn -- //
 		}
 		return *this;
 	}
-	__gc_multimap &operator=(wrapped_t &&other)
+	constexpr __gc_optional &operator=(wrapped_t &&other)
 	{
 		std::lock_guard lock(this->mutex);
 		wrapped() = std::move(other);
 		return *this;
 	}
 
-	__gc_multimap &operator=(std::initializer_list<value_type> ilist)
+	template<typename U = T>
+	__gc_optional &operator=(U &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
+		wrapped() = std::forward<U>(value);
 		return *this;
 	}
 
-public: // -- misc -- //
-
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
-
-public: // -- iterators -- //
-
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
-
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
-
-	reverse_iterator rbegin() noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator rbegin() const noexcept { return wrapped().rbegin(); }
-	const_reverse_iterator crbegin() const noexcept { return wrapped().crbegin(); }
-
-	reverse_iterator rend() noexcept { return wrapped().rend(); }
-	const_reverse_iterator rend() const noexcept { return wrapped().rend(); }
-	const_reverse_iterator crend() const noexcept { return wrapped().crend(); }
-
-public: // -- size / cap -- //
-
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
-
-	size_type max_size() const noexcept { return wrapped().max_size(); }
-
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
-	}
-
-public: // -- insert / erase -- //
-
-	iterator insert(const value_type &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
-	}
-	template<typename P>
-	iterator insert(P &&value)
+	template<typename U, typename ULockable, std::enable_if_t<!std::is_same<__gc_optional, __gc_optional<U, ULockable>>::value, int> = 0>
+	__gc_optional &operator=(const __gc_optional<U, ULockable> &other)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::forward<P>(value));
+		wrapped() = other.wrapped();
+		return *this;
 	}
-
-	iterator insert(const_iterator hint, const value_type &value)
+	template<typename U, std::enable_if_t<!std::is_same<wrapped_t, std::optional<U>>::value, int> = 0>
+	__gc_optional &operator=(const std::optional<U> &other)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
+		wrapped() = other;
+		return *this;
 	}
 
-	template<typename P>
-	iterator insert(const_iterator hint, P &&value)
+	template<typename U, typename ULockable, std::enable_if_t<!std::is_same<__gc_optional, __gc_optional<U, ULockable>>::value, int> = 0>
+	__gc_optional &operator=(__gc_optional<U, ULockable> &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::forward<P>(value));
+		std::scoped_lock locks(this->mutex, other.mutex);
+		wrapped() = std::move(other.wrapped());
+		return *this;
 	}
-
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
+	template<typename U, std::enable_if_t<!std::is_same<wrapped_t, std::optional<U>>::value, int> = 0>
+	__gc_optional &operator=(std::optional<U> &&other)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
+		wrapped() = std::move(other);
+		return *this;
 	}
 
-	void insert(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
-	}
+public: // -- observers -- //
 
-	iterator insert(value_type &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
-	}
-	iterator insert(const_iterator hint, value_type &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
-	}
+	constexpr decltype(auto) operator->() { return wrapped().operator->(); }
+	constexpr decltype(auto) operator->() const { return wrapped().operator->(); }
 
-	iterator insert(node_type &&nh)
+	constexpr decltype(auto) operator*() & { return *wrapped(); }
+	constexpr decltype(auto) operator*() const& { return *wrapped(); }
+	constexpr decltype(auto) operator*() &&
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		std::lock_guard lock(this->mutex); // not sure if this lock is needed
+		return *std::move(wrapped());
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+	constexpr decltype(auto) operator*() const&&
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		std::lock_guard lock(this->mutex); // not sure if this lock is needed
+		return *std::move(wrapped());
 	}
 
-	template<typename ...Args>
-	iterator emplace(Args &&...args)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
-	}
-	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
-	}
+	constexpr explicit operator bool() const noexcept { return static_cast<bool>(wrapped()); }
+	constexpr bool has_value() const noexcept { return wrapped().has_value(); }
 
-	iterator erase(const_iterator pos)
+	constexpr decltype(auto) value() & { return wrapped().value(); }
+	constexpr decltype(auto) value() const& { return wrapped().value(); }
+	constexpr decltype(auto) value() &&
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
+		std::lock_guard lock(this->mutex); // not sure if this lock is needed
+		return std::move(wrapped()).value();
 	}
-	iterator erase(const_iterator first, const_iterator last)
+	constexpr decltype(auto) value() const&&
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		std::lock_guard lock(this->mutex); // not sure if this lock is needed
+		return std::move(wrapped()).value();
 	}
 
-	size_type erase(const key_type &k)
+	template<typename U>
+	constexpr T value_or(U &&default_value) const& { return wrapped().value_or(std::forward<U>(default_value)); }
+	template<typename U>
+	constexpr T value_or(U &&default_value) &&
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(k);
+		std::lock_guard lock(this->mutex); // not sure if this lock is needed
+		return std::move(wrapped()).value_or(std::forward<U>(default_value));
 	}
 
-public: // -- swap -- //
+public: // -- modifiers -- //
 
-	void swap(__gc_multimap &other)
+	void swap(__gc_optional &other)
 	{
 		if (this != &other)
 		{
@@ -6131,2527 +11494,3983 @@ public: // -- swap -- //
 		wrapped().swap(other);
 	}
 
-	friend void swap(__gc_multimap &a, __gc_multimap &b) { a.swap(b); }
-	friend void swap(__gc_multimap &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_multimap &b) { b.swap(a); }
+	friend void swap(__gc_optional &a, __gc_optional &b) { a.swap(b); }
+	friend void swap(__gc_optional &a, wrapped_t &b) { a.swap(b); }
+	friend void swap(wrapped_t &a, __gc_optional &b) { b.swap(a); }
 
-public: // -- extract -- //
+	void reset()
+	{
+		std::lock_guard lock(this->mutex);
+		wrapped().reset();
+	}
 
-	node_type extract(const_iterator pos)
+	template<typename ...Args>
+	T &emplace(Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
+		return wrapped().emplace(std::forward<Args>(args)...);
 	}
-	node_type extract(const key_type &key)
+	template<typename U, typename ...Args>
+	T &emplace(std::initializer_list<U> il, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
+		return wrapped().emplace(il, std::forward<Args>(args)...);
 	}
 
-	// !! ADD MERGE FUNCTIONS (C++17)
-
-public: // -- lookup -- //
-
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
-
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
-
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
-
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
-
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
-
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
-
-	iterator lower_bound(const Key &key) { return wrapped().lower_bound(key); }
-	const_iterator lower_bound(const Key &key) const { return wrapped().lower_bound(key); }
-
-	template<typename K>
-	iterator lower_bound(const K &key) { return wrapped().lower_bound(key); }
-	template<typename K>
-	const_iterator lower_bound(const K &key) const { return wrapped().lower_bound(key); }
-
-	iterator upper_bound(const Key &key) { return wrapped().upper_bound(key); }
-	const_iterator upper_bound(const Key &key) const { return wrapped().upper_bound(key); }
-
-	template<typename K>
-	iterator upper_bound(const K &key) { return wrapped().upper_bound(key); }
-	template<typename K>
-	const_iterator upper_bound(const K &key) const { return wrapped().upper_bound(key); }
-
-public: // -- cmp types -- //
-
-	key_compare key_comp() const { return wrapped().key_comp(); }
-	value_compare value_comp() const { return wrapped().value_comp(); }
-
-public: // -- cmp -- //
-
-	friend bool operator==(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() != b.wrapped(); }
-	friend bool operator<(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() < b.wrapped(); }
-	friend bool operator<=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() <= b.wrapped(); }
-	friend bool operator>(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() > b.wrapped(); }
-	friend bool operator>=(const __gc_multimap &a, const __gc_multimap &b) { return a.wrapped() >= b.wrapped(); }
+public: // -- comparison -- //
+
+	friend constexpr bool operator==(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() == b.wrapped(); }
+	friend constexpr bool operator!=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() != b.wrapped(); }
+	friend constexpr bool operator<(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() < b.wrapped(); }
+	friend constexpr bool operator<=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() <= b.wrapped(); }
+	friend constexpr bool operator>(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() > b.wrapped(); }
+	friend constexpr bool operator>=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() >= b.wrapped(); }
 };
-template<typename Key, typename T, typename Compare, typename Allocator, typename Lockable>
-struct GC::router<__gc_multimap<Key, T, Compare, Allocator, Lockable>>
+template<typename T, typename Lockable>
+struct GC::router<__gc_optional<T, Lockable>>
 {
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
+	// if the optional type is trivial, so is this
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
 
 	template<typename F>
-	static void route(const __gc_multimap<Key, T, Compare, Allocator, Lockable> &map, F func)
+	static void route(const __gc_optional<T, Lockable> &var, F func)
 	{
-		std::lock_guard lock(map.mutex);
-		GC::route(map.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(var.mutex);
+		GC::route(var.wrapped(), func);
 	}
 };
 
-template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-class __gc_unordered_set
+template<typename T, typename Lockable>
+struct std::hash<__gc_optional<T, Lockable>>
 {
-private: // -- data -- //
-
-	typedef std::unordered_set<Key, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
+	std::hash<std::optional<T>> hasher; // the hasher may be non-trivial, so store it
+	std::size_t operator()(const __gc_optional<T, Lockable> &var) const { return hasher(var.wrapped()); }
+};
 
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+// ---------------------------- //
 
-	mutable Lockable mutex; // router synchronizer
+// -- compact container impl -- //
 
-	friend struct GC::router<__gc_unordered_set>;
+// ---------------------------- //
 
-private: // -- data accessors -- //
+template<typename T, std::size_t N, typename Lockable>
+class __gc_small_vector
+{
+	static_assert(N > 0, "small_vector inline capacity must be nonzero");
 
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+public: // -- typedefs -- //
 
-public: // -- wrapped obj access -- //
+	typedef T value_type;
 
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
 
-public: // -- typedefs -- //
+	typedef T &reference;
+	typedef const T &const_reference;
 
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::value_type value_type;
+	typedef T *pointer;
+	typedef const T *const_pointer;
 
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
+	typedef T *iterator;
+	typedef const T *const_iterator;
 
-	typedef typename wrapped_t::hasher hasher;
-	typedef typename wrapped_t::key_equal key_equal;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
-	typedef typename wrapped_t::allocator_type allocator_type;
+private: // -- data -- //
 
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
+	alignas(T) unsigned char inline_buffer[N * sizeof(T)]; // inline storage used for up to N elements
 
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
+	T *first;        // the current storage - either inline_buffer or a heap allocation
+	size_type count; // the number of (constructed) elements
+	size_type cap;   // the capacity of the current storage
 
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
+	mutable Lockable mutex; // router synchronizer
 
-	typedef typename wrapped_t::local_iterator local_iterator;
-	typedef typename wrapped_t::const_local_iterator const_local_iterator;
+	friend struct GC::router<__gc_small_vector>;
 
-	typedef typename wrapped_t::node_type node_type;
-	typedef typename wrapped_t::insert_return_type insert_return_type;
+private: // -- storage helpers -- //
 
-public: // -- ctor / dtor -- //
+	T *inline_data() noexcept { return reinterpret_cast<T*>(inline_buffer); }
+	bool is_inline() const noexcept { return first == reinterpret_cast<const T*>(inline_buffer); }
 
-	__gc_unordered_set()
-	{
-		new (buffer) wrapped_t();
-	}
-	explicit __gc_unordered_set(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	// moves the elements into new storage with capacity new_cap (which must be at least count).
+	// if new_cap fits in the inline buffer, the inline buffer is used.
+	void __reallocate(size_type new_cap)
 	{
-		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
-	}
+		T *buf = new_cap <= N ? inline_data() : std::allocator<T>().allocate(new_cap);
+		if (buf == first) return;
 
-	__gc_unordered_set(size_type bucket_count, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(bucket_count, alloc);
+		try { std::uninitialized_move(first, first + count, buf); }
+		catch (...) { if (buf != inline_data()) std::allocator<T>().deallocate(buf, new_cap); throw; }
+
+		std::destroy(first, first + count);
+		if (!is_inline()) std::allocator<T>().deallocate(first, cap);
+
+		first = buf;
+		cap = std::max(new_cap, N);
 	}
-	__gc_unordered_set(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	// makes room for at least extra more elements
+	void __grow_for(size_type extra)
 	{
-		new (buffer) wrapped_t(bucket_count, hash, alloc);
+		if (count + extra > cap) __reallocate(std::max(cap * 2, count + extra));
 	}
 
-	explicit __gc_unordered_set(const Allocator &alloc)
+	// destroys all the elements (keeps the current storage)
+	void __clear() noexcept
 	{
-		new (buffer) wrapped_t(alloc);
+		std::destroy(first, first + count);
+		count = 0;
 	}
-
-	template<typename InputIt>
-	__gc_unordered_set(InputIt first, InputIt last)
+	// destroys all the elements and returns to the inline buffer
+	void __release() noexcept
 	{
-		new (buffer) wrapped_t(first, last);
+		__clear();
+		if (!is_inline()) std::allocator<T>().deallocate(first, cap);
+		first = inline_data();
+		cap = N;
 	}
-	template<typename InputIt>
-	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	// takes other's elements - this must be empty and using the inline buffer (e.g. after __release()).
+	// other is left empty.
+	void __steal(__gc_small_vector &other)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
-	}
+		if (other.is_inline())
+		{
+			std::uninitialized_move(other.first, other.first + other.count, inline_data());
+			count = other.count;
+			other.__clear();
+		}
+		else
+		{
+			first = other.first;
+			count = other.count;
+			cap = other.cap;
 
-	template<typename InputIt>
-	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+			other.first = other.inline_data();
+			other.count = 0;
+			other.cap = N;
+		}
 	}
 
 	template<typename InputIt>
-	__gc_unordered_set(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
-	}
-
-	__gc_unordered_set(const __gc_unordered_set &other)
-	{
-		new (buffer) wrapped_t(other.wrapped());
-	}
-	__gc_unordered_set(const wrapped_t &other)
+	void __assign(InputIt b, InputIt e)
 	{
-		new (buffer) wrapped_t(other);
+		__clear();
+		for (; b != e; ++b) __emplace_back(*b);
 	}
 
-	__gc_unordered_set(const __gc_unordered_set &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
-	}
-	__gc_unordered_set(const wrapped_t &other, const Allocator &alloc)
+	template<typename ...Args>
+	T &__emplace_back(Args &&...args)
 	{
-		new (buffer) wrapped_t(other, alloc);
-	}
+		if (count == cap)
+		{
+			// construct the value first - args could refer to an element we're about to relocate
+			T value(std::forward<Args>(args)...);
+			__grow_for(1);
+			new (first + count) T(std::move(value));
+		}
+		else new (first + count) T(std::forward<Args>(args)...);
 
-	__gc_unordered_set(__gc_unordered_set &&other)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		return first[count++];
 	}
-	__gc_unordered_set(wrapped_t &&other)
+	template<typename ...Args>
+	iterator __emplace(size_type index, Args &&...args)
 	{
-		new (buffer) wrapped_t(std::move(other));
-	}
+		if (index == count) return &__emplace_back(std::forward<Args>(args)...);
 
-	__gc_unordered_set(__gc_unordered_set &&other, const Allocator &alloc)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
-	}
-	__gc_unordered_set(wrapped_t &&other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(std::move(other), alloc);
-	}
+		T value(std::forward<Args>(args)...);
+		__grow_for(1);
 
-	__gc_unordered_set(std::initializer_list<value_type> init)
-	{
-		new (buffer) wrapped_t(init);
-	}
-	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
-	}
+		new (first + count) T(std::move(first[count - 1]));
+		std::move_backward(first + index, first + count - 1, first + count);
+		first[index] = std::move(value);
+		++count;
 
-	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(init, bucket_count, alloc);
+		return first + index;
 	}
-	__gc_unordered_set(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	// inserts the values in [b, e) at index
+	template<typename InputIt>
+	iterator __insert(size_type index, InputIt b, InputIt e)
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
-	}
+		// append them and rotate them into position
+		size_type old_count = count;
+		for (; b != e; ++b) __emplace_back(*b);
+		std::rotate(first + index, first + old_count, first + count);
 
-	~__gc_unordered_set()
-	{
-		wrapped().~wrapped_t();
+		return first + index;
 	}
 
-public: // -- asgn -- //
-
-	__gc_unordered_set &operator=(const __gc_unordered_set &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
-	}
-	__gc_unordered_set &operator=(const wrapped_t &other)
+	void __erase(size_type index, size_type n)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
+		std::move(first + index + n, first + count, first + index);
+		std::destroy(first + count - n, first + count);
+		count -= n;
 	}
 
-	__gc_unordered_set &operator=(__gc_unordered_set &&other)
+	void __resize(size_type new_count, const T *value)
 	{
-		if (this != &other)
+		if (new_count < count)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			std::destroy(first + new_count, first + count);
+			count = new_count;
+		}
+		else if (value && new_count > cap)
+		{
+			// copy the value first - it could refer to an element we're about to relocate
+			T copy(*value);
+			__grow_for(new_count - count);
+			for (; count < new_count; ++count) new (first + count) T(copy);
+		}
+		else
+		{
+			__grow_for(new_count - count);
+			while (count < new_count)
+			{
+				if (value) new (first + count) T(*value);
+				else new (first + count) T();
+				++count;
+			}
 		}
-		return *this;
-	}
-	__gc_unordered_set &operator=(wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
-	}
-
-	__gc_unordered_set &operator=(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
-	}
-
-public: // -- misc -- //
-
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
-
-public: // -- iterators -- //
-
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
-
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
-
-public: // -- size / cap -- //
-
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
-
-	size_type max_size() const noexcept { return wrapped().max_size(); }
-
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
 	}
 
-public: // -- insert / erase -- //
-
-	std::pair<iterator, bool> insert(const value_type &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
-	}
-	std::pair<iterator, bool> insert(value_type &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
-	}
+public: // -- transactional access -- //
 
-	iterator insert(const_iterator hint, const value_type &value)
+	// invokes f with a reference to this vector under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// f's calls on the vector lock it again, so this requires a recursive lockable (as the default lockable is).
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
+		return std::forward<F>(f)(*this);
 	}
-	iterator insert(const_iterator hint, value_type &&value)
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
 
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
-	}
+public: // -- ctor / dtor -- //
 
-	void insert(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
-	}
+	__gc_small_vector() noexcept : first(inline_data()), count(0), cap(N) {}
 
-	insert_return_type insert(node_type &&nh)
+	__gc_small_vector(size_type n, const T &value) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		__resize(n, &value);
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+	explicit __gc_small_vector(size_type n) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		__resize(n, nullptr);
 	}
 
-	template<typename ...Args>
-	std::pair<iterator, bool> emplace(Args &&...args)
+	template<typename InputIt, std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+	__gc_small_vector(InputIt b, InputIt e) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		__assign(b, e);
 	}
-	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
+
+	__gc_small_vector(std::initializer_list<T> init) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+		__grow_for(init.size());
+		__assign(init.begin(), init.end());
 	}
 
-	iterator erase(const_iterator pos)
+	__gc_small_vector(const __gc_small_vector &other) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
+		GC::router_lock_t<Lockable> lock(other.mutex);
+		__grow_for(other.count);
+		__assign(other.first, other.first + other.count);
 	}
-	iterator erase(const_iterator first, const_iterator last)
+	__gc_small_vector(__gc_small_vector &&other) : __gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		std::lock_guard lock(other.mutex);
+		__steal(other);
 	}
 
-	size_type erase(const key_type &key)
+	~__gc_small_vector()
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(key);
+		__release();
 	}
 
-public: // -- swap -- //
+public: // -- asgn -- //
 
-	void swap(__gc_unordered_set &other)
+	__gc_small_vector &operator=(const __gc_small_vector &other)
+	{
+		if (this != &other)
+		{
+			// copy other under its own (router) lock like the copy ctor does, then take the copy under ours
+			__gc_small_vector temp(other);
+
+			std::lock_guard lock(this->mutex);
+			__release();
+			__steal(temp);
+		}
+		return *this;
+	}
+	__gc_small_vector &operator=(__gc_small_vector &&other)
 	{
 		if (this != &other)
 		{
 			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			__release();
+			__steal(other);
 		}
+		return *this;
 	}
-	void swap(wrapped_t &other)
+
+	__gc_small_vector &operator=(std::initializer_list<T> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
+		__assign(ilist.begin(), ilist.end());
+		return *this;
 	}
 
-	friend void swap(__gc_unordered_set &a, __gc_unordered_set &b) { a.swap(b); }
-	friend void swap(__gc_unordered_set &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_unordered_set &b) { b.swap(a); }
-
-public: // -- extract -- //
+	void assign(size_type n, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		__clear();
+		__resize(n, &value);
+	}
 
-	node_type extract(const_iterator pos)
+	template<typename InputIt, std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+	void assign(InputIt b, InputIt e)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
+		__assign(b, e);
 	}
-	node_type extract(const key_type &key)
+
+	void assign(std::initializer_list<T> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
+		__assign(ilist.begin(), ilist.end());
 	}
 
-	// !! ADD MERGE FUNCTIONS (C++17)
+public: // -- obj access -- //
 
-public: // -- lookup -- //
+	reference at(size_type pos) { if (pos >= count) throw std::out_of_range("small_vector index out of range"); return first[pos]; }
+	const_reference at(size_type pos) const { if (pos >= count) throw std::out_of_range("small_vector index out of range"); return first[pos]; }
 
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
+	reference operator[](size_type pos) { return first[pos]; }
+	const_reference operator[](size_type pos) const { return first[pos]; }
 
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
+	reference front() { return first[0]; }
+	const_reference front() const { return first[0]; }
 
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
+	reference back() { return first[count - 1]; }
+	const_reference back() const { return first[count - 1]; }
 
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
+	T *data() noexcept { return first; }
+	const T *data() const noexcept { return first; }
 
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+public: // -- iterators -- //
 
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+	iterator begin() noexcept { return first; }
+	const_iterator begin() const noexcept { return first; }
+	const_iterator cbegin() const noexcept { return first; }
 
-public: // -- bucket interface -- //
+	iterator end() noexcept { return first + count; }
+	const_iterator end() const noexcept { return first + count; }
+	const_iterator cend() const noexcept { return first + count; }
 
-	local_iterator begin(size_type n) { return wrapped().begin(n); }
-	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
-	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
+	reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
 
-	local_iterator end(size_type n) { return wrapped().end(n); }
-	const_local_iterator end(size_type n) const { return wrapped().end(n); }
-	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
+	reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
 
-	size_type bucket_count() const { return wrapped().bucket_count(); }
-	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
+public: // -- size / cap -- //
 
-	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
-	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
+	bool empty() const noexcept { return count == 0; }
+	size_type size() const noexcept { return count; }
 
-public: // -- hash policy -- //
+	size_type max_size() const noexcept { return std::allocator_traits<std::allocator<T>>::max_size(std::allocator<T>()); }
 
-	float load_factor() const { return wrapped().load_factor(); }
+	// gets the number of elements that are stored inline (i.e. without a heap allocation)
+	static constexpr size_type inline_capacity() noexcept { return N; }
 
-	float max_load_factor() const { return wrapped().max_load_factor(); }
-	void max_load_factor(float ml)
+	void reserve(size_type new_cap)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().max_load_factor(ml);
+		if (new_cap > cap) __reallocate(new_cap);
 	}
+	size_type capacity() const noexcept { return cap; }
 
-	void rehash(size_type count)
+	// releases unused heap capacity - moves the elements back inline if they fit
+	void shrink_to_fit()
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().rehash(count);
+		if (!is_inline() && count < cap) __reallocate(count);
 	}
 
-	void reserve(size_type count)
+	void clear() noexcept(noexcept(std::declval<Lockable>().lock()))
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reserve(count);
+		__clear();
 	}
 
-public: // -- observers -- //
-
-	hasher hash_function() const { return wrapped().hash_function(); }
-	key_equal key_eq() const { return wrapped().key_eq(); }
-
-public: // -- cmp -- //
-
-	friend bool operator==(const __gc_unordered_set &a, const __gc_unordered_set &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_unordered_set &a, const __gc_unordered_set &b) { return a.wrapped() != b.wrapped(); }
-};
-template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-struct GC::router<__gc_unordered_set<Key, Hash, KeyEqual, Allocator, Lockable>>
-{
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+public: // -- insert / erase -- //
 
-	template<typename F>
-	static void route(const __gc_unordered_set<Key, Hash, KeyEqual, Allocator, Lockable> &set, F func)
+	iterator insert(const_iterator pos, const T &value)
 	{
-		std::lock_guard lock(set.mutex);
-		GC::route(set.wrapped(), func);
+		std::lock_guard lock(this->mutex);
+		return __emplace(pos - first, value);
+	}
+	iterator insert(const_iterator pos, T &&value)
+	{
+		std::lock_guard lock(this->mutex);
+		return __emplace(pos - first, std::move(value));
 	}
-};
-
-template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-class __gc_unordered_multiset
-{
-private: // -- data -- //
-
-	typedef std::unordered_multiset<Key, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
-
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
-
-	mutable Lockable mutex; // router synchronizer
-
-	friend struct GC::router<__gc_unordered_multiset>;
-
-private: // -- data accessors -- //
-
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
-
-public: // -- wrapped obj access -- //
-
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
-
-public: // -- typedefs -- //
-
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::value_type value_type;
-
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
-
-	typedef typename wrapped_t::hasher hasher;
-	typedef typename wrapped_t::key_equal key_equal;
-
-	typedef typename wrapped_t::allocator_type allocator_type;
-
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
-
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
-
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
-
-	typedef typename wrapped_t::local_iterator local_iterator;
-	typedef typename wrapped_t::const_local_iterator const_local_iterator;
 
-	typedef typename wrapped_t::node_type node_type;
+	iterator insert(const_iterator pos, size_type n, const T &value)
+	{
+		std::lock_guard lock(this->mutex);
+		size_type index = pos - first, old_count = count;
+		__resize(count + n, &value);
+		std::rotate(first + index, first + old_count, first + count);
+		return first + index;
+	}
 
-public: // -- ctor / dtor -- //
+	template<typename InputIt, std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+	iterator insert(const_iterator pos, InputIt b, InputIt e)
+	{
+		std::lock_guard lock(this->mutex);
+		return __insert(pos - first, b, e);
+	}
 
-	__gc_unordered_multiset()
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist)
 	{
-		new (buffer) wrapped_t();
+		std::lock_guard lock(this->mutex);
+		return __insert(pos - first, ilist.begin(), ilist.end());
 	}
-	explicit __gc_unordered_multiset(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+
+	template<typename ...Args>
+	iterator emplace(const_iterator pos, Args &&...args)
 	{
-		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
+		std::lock_guard lock(this->mutex);
+		return __emplace(pos - first, std::forward<Args>(args)...);
 	}
 
-	__gc_unordered_multiset(size_type bucket_count, const Allocator &alloc)
+	iterator erase(const_iterator pos)
 	{
-		new (buffer) wrapped_t(bucket_count, alloc);
+		std::lock_guard lock(this->mutex);
+		size_type index = pos - first;
+		__erase(index, 1);
+		return first + index;
 	}
-	__gc_unordered_multiset(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	iterator erase(const_iterator b, const_iterator e)
 	{
-		new (buffer) wrapped_t(bucket_count, hash, alloc);
+		std::lock_guard lock(this->mutex);
+		size_type index = b - first;
+		__erase(index, e - b);
+		return first + index;
 	}
 
-	explicit __gc_unordered_multiset(const Allocator &alloc)
+public: // -- push / pop -- //
+
+	void push_back(const T &value)
 	{
-		new (buffer) wrapped_t(alloc);
+		std::lock_guard lock(this->mutex);
+		__emplace_back(value);
 	}
-
-	template<typename InputIt>
-	__gc_unordered_multiset(InputIt first, InputIt last)
+	void push_back(T &&value)
 	{
-		new (buffer) wrapped_t(first, last);
+		std::lock_guard lock(this->mutex);
+		__emplace_back(std::move(value));
 	}
-	template<typename InputIt>
-	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+
+	template<typename ...Args>
+	reference emplace_back(Args &&...args)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
+		std::lock_guard lock(this->mutex);
+		return __emplace_back(std::forward<Args>(args)...);
 	}
 
-	template<typename InputIt>
-	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
+	void pop_back()
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+		std::lock_guard lock(this->mutex);
+		__erase(count - 1, 1);
 	}
 
-	template<typename InputIt>
-	__gc_unordered_multiset(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+public: // -- resize -- //
+
+	void resize(size_type n)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
+		std::lock_guard lock(this->mutex);
+		__resize(n, nullptr);
+	}
+	void resize(size_type n, const value_type &value)
+	{
+		std::lock_guard lock(this->mutex);
+		__resize(n, &value);
 	}
 
-	__gc_unordered_multiset(const __gc_unordered_multiset &other)
+public: // -- swap -- //
+
+	void swap(__gc_small_vector &other)
 	{
-		new (buffer) wrapped_t(other.wrapped());
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+
+			__gc_small_vector temp;
+			temp.__steal(*this);
+			__steal(other);
+			other.__steal(temp);
+		}
 	}
-	__gc_unordered_multiset(const wrapped_t &other)
+
+	friend void swap(__gc_small_vector &a, __gc_small_vector &b) { a.swap(b); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_small_vector &a, const __gc_small_vector &b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); }
+	friend bool operator!=(const __gc_small_vector &a, const __gc_small_vector &b) { return !(a == b); }
+	friend bool operator<(const __gc_small_vector &a, const __gc_small_vector &b) { return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()); }
+	friend bool operator<=(const __gc_small_vector &a, const __gc_small_vector &b) { return !(b < a); }
+	friend bool operator>(const __gc_small_vector &a, const __gc_small_vector &b) { return b < a; }
+	friend bool operator>=(const __gc_small_vector &a, const __gc_small_vector &b) { return !(a < b); }
+};
+template<typename T, std::size_t N, typename Lockable>
+struct GC::router<__gc_small_vector<T, N, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_small_vector<T, N, Lockable> &vec, F func)
 	{
-		new (buffer) wrapped_t(other);
+		GC::router_lock_t<Lockable> lock(vec.mutex);
+		GC::route_range(vec.first, vec.first + vec.count, func);
 	}
+};
+
+template<typename Key, typename T, typename Compare, typename Lockable>
+class __gc_flat_map
+{
+public: // -- typedefs -- //
+
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef Compare key_compare;
+
+	typedef std::size_t size_type;
+
+private: // -- data -- //
+
+	std::vector<Key> _keys;  // the keys in sorted order (no duplicates)
+	std::vector<T> _values;  // the values - _values[i] is the value for _keys[i]
+
+	Compare comp; // the key comparator
+
+	mutable Lockable mutex; // router synchronizer
 
-	__gc_unordered_multiset(const __gc_unordered_multiset &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
-	}
-	__gc_unordered_multiset(const wrapped_t &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other, alloc);
-	}
+	friend struct GC::router<__gc_flat_map>;
 
-	__gc_unordered_multiset(__gc_unordered_multiset &&other)
+private: // -- helpers -- //
+
+	bool equiv(const Key &a, const Key &b) const { return !comp(a, b) && !comp(b, a); }
+
+	// gets the index of the first key not less than key (branchless binary search)
+	size_type lower_bound(const Key &key) const
 	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		const Key *base = _keys.data();
+		size_type len = _keys.size();
+		if (len == 0) return 0;
+
+		while (len > 1)
+		{
+			size_type half = len / 2;
+			base = comp(base[half], key) ? base + half : base;
+			len -= half;
+		}
+		return (base - _keys.data()) + (comp(*base, key) ? 1 : 0);
 	}
-	__gc_unordered_multiset(wrapped_t &&other)
+	// gets the index of key, or size() if not present
+	size_type index_of(const Key &key) const
 	{
-		new (buffer) wrapped_t(std::move(other));
+		size_type i = lower_bound(key);
+		return i < _keys.size() && !comp(key, _keys[i]) ? i : _keys.size();
 	}
 
-	__gc_unordered_multiset(__gc_unordered_multiset &&other, const Allocator &alloc)
+	// inserts key/value at index i (which must be the lower bound of key)
+	template<typename K, typename ...Args>
+	T *__insert_at(size_type i, K &&key, Args &&...args)
 	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+		_keys.emplace(_keys.begin() + i, std::forward<K>(key));
+		try { _values.emplace(_values.begin() + i, std::forward<Args>(args)...); }
+		catch (...) { _keys.erase(_keys.begin() + i); throw; }
+		return &_values[i];
 	}
-	__gc_unordered_multiset(wrapped_t &&other, const Allocator &alloc)
+
+	// inserts each pair-like value in [b, e) whose key is not already present (as std::map::insert).
+	// the batch is sorted and merged in with a single pass over the existing elements.
+	template<typename InputIt>
+	void __insert_bulk(InputIt b, InputIt e)
 	{
-		new (buffer) wrapped_t(std::move(other), alloc);
+		std::vector<std::pair<Key, T>> batch;
+		for (; b != e; ++b) batch.emplace_back(b->first, b->second);
+		if (batch.empty()) return;
+
+		// sort and keep only the first occurrence of each key
+		std::stable_sort(batch.begin(), batch.end(), [this](const auto &a, const auto &b) { return comp(a.first, b.first); });
+		batch.erase(std::unique(batch.begin(), batch.end(), [this](const auto &a, const auto &b) { return equiv(a.first, b.first); }), batch.end());
+
+		// if the batch is entirely after the existing keys (e.g. sorted loading), just append.
+		// if an append throws, the appended entries are removed again (so the keys and values stay in step).
+		if (_keys.empty() || comp(_keys.back(), batch.front().first))
+		{
+			const size_type old_size = _keys.size();
+			_keys.reserve(old_size + batch.size());
+			_values.reserve(old_size + batch.size());
+			try
+			{
+				for (auto &entry : batch)
+				{
+					_keys.push_back(std::move(entry.first));
+					_values.push_back(std::move(entry.second));
+				}
+			}
+			catch (...)
+			{
+				_keys.erase(_keys.begin() + old_size, _keys.end());
+				_values.erase(_values.begin() + old_size, _values.end());
+				throw;
+			}
+			return;
+		}
+
+		// otherwise merge into new vectors and swap them in once everything has succeeded.
+		// the existing entries are only moved if that can't throw (e.g. GC::ptr's move is a copy), so a failed merge leaves them untouched.
+		std::vector<Key> new_keys;
+		std::vector<T> new_values;
+		new_keys.reserve(_keys.size() + batch.size());
+		new_values.reserve(_values.size() + batch.size());
+
+		size_type i = 0;
+		for (auto &entry : batch)
+		{
+			for (; i < _keys.size() && comp(_keys[i], entry.first); ++i)
+			{
+				new_keys.push_back(std::move_if_noexcept(_keys[i]));
+				new_values.push_back(std::move_if_noexcept(_values[i]));
+			}
+			// existing keys take priority
+			if (i < _keys.size() && !comp(entry.first, _keys[i])) continue;
+
+			new_keys.push_back(std::move(entry.first));
+			new_values.push_back(std::move(entry.second));
+		}
+		for (; i < _keys.size(); ++i)
+		{
+			new_keys.push_back(std::move_if_noexcept(_keys[i]));
+			new_values.push_back(std::move_if_noexcept(_values[i]));
+		}
+
+		_keys.swap(new_keys);
+		_values.swap(new_values);
 	}
 
-	__gc_unordered_multiset(std::initializer_list<value_type> init)
+public: // -- transactional access -- //
+
+	// invokes f with a reference to this map under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// f's calls on the map lock it again, so this requires a recursive lockable (as the default lockable is).
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
 	{
-		new (buffer) wrapped_t(init);
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
-	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
 
-	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+public: // -- ctor / dtor -- //
+
+	__gc_flat_map() = default;
+	explicit __gc_flat_map(const Compare &_comp) : comp(_comp) {}
+
+	template<typename InputIt>
+	__gc_flat_map(InputIt b, InputIt e, const Compare &_comp = Compare()) : comp(_comp)
 	{
-		new (buffer) wrapped_t(init, bucket_count, alloc);
+		__insert_bulk(b, e);
 	}
-	__gc_unordered_multiset(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+
+	__gc_flat_map(std::initializer_list<std::pair<Key, T>> init, const Compare &_comp = Compare()) : comp(_comp)
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+		__insert_bulk(init.begin(), init.end());
 	}
 
-	~__gc_unordered_multiset()
+	__gc_flat_map(const __gc_flat_map &other) : _keys(other._keys), _values(other._values), comp(other.comp) {}
+	__gc_flat_map(__gc_flat_map &&other) : comp(other.comp)
 	{
-		wrapped().~wrapped_t();
+		std::lock_guard lock(other.mutex);
+		_keys.swap(other._keys);
+		_values.swap(other._values);
 	}
 
 public: // -- asgn -- //
 
-	__gc_unordered_multiset &operator=(const __gc_unordered_multiset &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
-	}
-	__gc_unordered_multiset &operator=(const wrapped_t &other)
+	__gc_flat_map &operator=(const __gc_flat_map &other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
+		if (this != &other)
+		{
+			// copy outside the lock, then swap the copies in
+			std::vector<Key> keys(other._keys);
+			std::vector<T> values(other._values);
+
+			std::lock_guard lock(this->mutex);
+			_keys.swap(keys);
+			_values.swap(values);
+			comp = other.comp;
+		}
 		return *this;
 	}
-
-	__gc_unordered_multiset &operator=(__gc_unordered_multiset &&other)
+	__gc_flat_map &operator=(__gc_flat_map &&other)
 	{
 		if (this != &other)
 		{
 			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			_keys.swap(other._keys);
+			_values.swap(other._values);
+			std::swap(comp, other.comp);
 		}
 		return *this;
 	}
-	__gc_unordered_multiset &operator=(wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
-	}
-
-	__gc_unordered_multiset &operator=(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
-	}
-
-public: // -- misc -- //
-
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
 
-public: // -- iterators -- //
-
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
-
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
+public: // -- obj access -- //
 
-public: // -- size / cap -- //
+	// gets a pointer to the value associated with key, or null if not present.
+	// the pointer is invalidated by any insertion or erasure.
+	T *find(const Key &key) { size_type i = index_of(key); return i < _keys.size() ? &_values[i] : nullptr; }
+	const T *find(const Key &key) const { size_type i = index_of(key); return i < _keys.size() ? &_values[i] : nullptr; }
 
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
+	bool contains(const Key &key) const { return index_of(key) < _keys.size(); }
+	size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
 
-	size_type max_size() const noexcept { return wrapped().max_size(); }
+	T &at(const Key &key) { T *val = find(key); if (!val) throw std::out_of_range("flat_map key not found"); return *val; }
+	const T &at(const Key &key) const { const T *val = find(key); if (!val) throw std::out_of_range("flat_map key not found"); return *val; }
 
-	void clear() noexcept
+	// gets the value associated with key - if not present, a default value is inserted first
+	T &operator[](const Key &key)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().clear();
+		size_type i = lower_bound(key);
+		if (i < _keys.size() && !comp(key, _keys[i])) return _values[i];
+		return *__insert_at(i, key);
 	}
 
-public: // -- insert / erase -- //
+	// the sorted keys and their (parallel) values
+	const std::vector<Key> &keys() const noexcept { return _keys; }
+	const std::vector<T> &values() const noexcept { return _values; }
 
-	iterator insert(const value_type &value)
+	// invokes f(key, value) for each entry in key order
+	template<typename F>
+	void for_each(F f)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
+		for (size_type i = 0; i < _keys.size(); ++i) f(std::as_const(_keys[i]), _values[i]);
 	}
-	iterator insert(value_type &&value)
+	template<typename F>
+	void for_each(F f) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
+		for (size_type i = 0; i < _keys.size(); ++i) f(_keys[i], _values[i]);
 	}
 
-	iterator insert(const_iterator hint, const value_type &value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
-	}
-	iterator insert(const_iterator hint, value_type &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
-	}
+public: // -- insert / erase -- //
 
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
+	// constructs a value from args and inserts it under key if key is not already present.
+	// returns a pointer to the value associated with key and true if an insertion took place.
+	template<typename ...Args>
+	std::pair<T*, bool> try_emplace(const Key &key, Args &&...args)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
+		size_type i = lower_bound(key);
+		if (i < _keys.size() && !comp(key, _keys[i])) return { &_values[i], false };
+		return { __insert_at(i, key, std::forward<Args>(args)...), true };
 	}
 
-	void insert(std::initializer_list<value_type> ilist)
+	std::pair<T*, bool> insert(const Key &key, const T &value) { return try_emplace(key, value); }
+	std::pair<T*, bool> insert(const Key &key, T &&value) { return try_emplace(key, std::move(value)); }
+
+	template<typename V>
+	std::pair<T*, bool> insert_or_assign(const Key &key, V &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
+		size_type i = lower_bound(key);
+		if (i < _keys.size() && !comp(key, _keys[i])) { _values[i] = std::forward<V>(value); return { &_values[i], false }; }
+		return { __insert_at(i, key, std::forward<V>(value)), true };
 	}
 
-	iterator insert(node_type &&nh)
+	// inserts each key/value pair in [b, e) whose key is not already present (as std::map::insert).
+	// this is O(n + m log m) for m new entries, rather than O(n * m) for repeated single insertions.
+	template<typename InputIt>
+	void insert(InputIt b, InputIt e)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		__insert_bulk(b, e);
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+	void insert(std::initializer_list<std::pair<Key, T>> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		__insert_bulk(ilist.begin(), ilist.end());
 	}
 
-	template<typename ...Args>
-	iterator emplace(Args &&...args)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
-	}
-	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
+	size_type erase(const Key &key)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+		size_type i = index_of(key);
+		if (i == _keys.size()) return 0;
+
+		_keys.erase(_keys.begin() + i);
+		_values.erase(_values.begin() + i);
+		return 1;
 	}
 
-	iterator erase(const_iterator pos)
+	void clear()
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
+		_keys.clear();
+		_values.clear();
 	}
-	iterator erase(const_iterator first, const_iterator last)
+
+public: // -- size / cap -- //
+
+	bool empty() const noexcept { return _keys.empty(); }
+	size_type size() const noexcept { return _keys.size(); }
+
+	void reserve(size_type new_cap)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		_keys.reserve(new_cap);
+		_values.reserve(new_cap);
 	}
+	size_type capacity() const noexcept { return std::min(_keys.capacity(), _values.capacity()); }
 
-	size_type erase(const key_type &key)
+	void shrink_to_fit()
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(key);
+		_keys.shrink_to_fit();
+		_values.shrink_to_fit();
 	}
 
+	key_compare key_comp() const { return comp; }
+
 public: // -- swap -- //
 
-	void swap(__gc_unordered_multiset &other)
+	void swap(__gc_flat_map &other)
 	{
 		if (this != &other)
 		{
 			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			_keys.swap(other._keys);
+			_values.swap(other._values);
+			std::swap(comp, other.comp);
 		}
 	}
-	void swap(wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
-	}
 
-	friend void swap(__gc_unordered_multiset &a, __gc_unordered_multiset &b) { a.swap(b); }
-	friend void swap(__gc_unordered_multiset &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_unordered_multiset &b) { b.swap(a); }
+	friend void swap(__gc_flat_map &a, __gc_flat_map &b) { a.swap(b); }
 
-public: // -- extract -- //
+public: // -- cmp -- //
 
-	node_type extract(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
-	}
-	node_type extract(const key_type &key)
+	friend bool operator==(const __gc_flat_map &a, const __gc_flat_map &b) { return a._keys == b._keys && a._values == b._values; }
+	friend bool operator!=(const __gc_flat_map &a, const __gc_flat_map &b) { return !(a == b); }
+};
+template<typename Key, typename T, typename Compare, typename Lockable>
+struct GC::router<__gc_flat_map<Key, T, Compare, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
+
+	template<typename F>
+	static void route(const __gc_flat_map<Key, T, Compare, Lockable> &map, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
+		// the values are contiguous, so this is a linear scan (keys are usually trivial, in which case they're skipped entirely)
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		GC::route_range(map._values.begin(), map._values.end(), func);
+		GC::route_range(map._keys.begin(), map._keys.end(), func);
 	}
+};
 
-	// !! ADD MERGE FUNCTIONS (C++17)
-
-public: // -- lookup -- //
-
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
+// the implementation of btree_map and btree_set - a b+ tree whose entries live in the leaves (as parallel arrays of keys and values).
+// the leaves are doubly-linked in key order for iteration and routing. inner nodes hold copies of keys as separators.
+// if T is void, the leaves only hold keys (a set).
+template<typename Key, typename T, typename Compare, typename Lockable>
+class __gc_btree
+{
+public: // -- typedefs -- //
 
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
+	typedef Key key_type;
+	typedef Compare key_compare;
 
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
 
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
+protected: // -- node types -- //
 
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+	static constexpr bool has_values = !std::is_void<T>::value;
 
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+	// the number of entries in a full leaf - about 256 bytes of keys and values (but at least 8, so the tree stays shallow for large entries)
+	static constexpr size_type leaf_slots = std::max<size_type>(8, 256 / (sizeof(Key) + (has_values ? sizeof(std::conditional_t<has_values, T, char>) : 0)));
+	// the number of children of a full inner node - about 256 bytes of separators and child pointers (but at least 8)
+	static constexpr size_type inner_slots = std::max<size_type>(8, 256 / (sizeof(Key) + sizeof(void*)));
 
-public: // -- bucket interface -- //
+	static constexpr size_type max_keys = inner_slots - 1;  // the number of separators in a full inner node
+	static constexpr size_type min_keys = (max_keys - 1) / 2; // the minimum number of separators in a (non-root) inner node
+	static constexpr size_type min_leaf = leaf_slots / 2;    // the minimum number of entries in a (non-root) leaf
 
-	local_iterator begin(size_type n) { return wrapped().begin(n); }
-	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
-	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
+	// every inner node has at least 4 children, so this is more levels than a size_type could ever need
+	static constexpr size_type max_height = sizeof(size_type) * CHAR_BIT / 2;
 
-	local_iterator end(size_type n) { return wrapped().end(n); }
-	const_local_iterator end(size_type n) const { return wrapped().end(n); }
-	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
+	struct node_base
+	{
+		const bool is_leaf;
+		size_type count = 0; // the number of (constructed) entries in a leaf, or separators in an inner node
 
-	size_type bucket_count() const { return wrapped().bucket_count(); }
-	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
+		explicit node_base(bool leaf) noexcept : is_leaf(leaf) {}
+	};
 
-	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
-	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
+	// separators[i] is the least key in the subtree children[i + 1] had when it was created (all keys in children[i] are less than it).
+	// separators are not updated when that key is erased, so they can be stale (but are still valid bounds).
+	struct inner_node : node_base
+	{
+		alignas(Key) unsigned char separator_buffer[max_keys * sizeof(Key)];
+		node_base *children[inner_slots];
 
-public: // -- hash policy -- //
+		inner_node() noexcept : node_base(false) {}
 
-	float load_factor() const { return wrapped().load_factor(); }
+		Key *separators() noexcept { return reinterpret_cast<Key*>(separator_buffer); }
+		const Key *separators() const noexcept { return reinterpret_cast<const Key*>(separator_buffer); }
+	};
 
-	float max_load_factor() const { return wrapped().max_load_factor(); }
-	void max_load_factor(float ml)
+	template<typename U, typename = void>
+	struct value_buffer
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().max_load_factor(ml);
-	}
+		alignas(U) unsigned char buffer[leaf_slots * sizeof(U)];
 
-	void rehash(size_type count)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().rehash(count);
-	}
+		U *data() noexcept { return reinterpret_cast<U*>(buffer); }
+		const U *data() const noexcept { return reinterpret_cast<const U*>(buffer); }
+	};
+	template<typename D>
+	struct value_buffer<void, D> {};
 
-	void reserve(size_type count)
+	struct leaf_node : node_base
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reserve(count);
-	}
+		leaf_node *prev = nullptr; // the previous leaf in key order
+		leaf_node *next = nullptr; // the next leaf in key order
 
-public: // -- observers -- //
-
-	hasher hash_function() const { return wrapped().hash_function(); }
-	key_equal key_eq() const { return wrapped().key_eq(); }
+		alignas(Key) unsigned char key_buffer[leaf_slots * sizeof(Key)];
+		value_buffer<T> values; // values.data()[i] is the value for keys()[i]
 
-public: // -- cmp -- //
+		leaf_node() noexcept : node_base(true) {}
 
-	friend bool operator==(const __gc_unordered_multiset &a, const __gc_unordered_multiset &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_unordered_multiset &a, const __gc_unordered_multiset &b) { return a.wrapped() != b.wrapped(); }
-};
-template<typename Key, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-struct GC::router<__gc_unordered_multiset<Key, Hash, KeyEqual, Allocator, Lockable>>
-{
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+		Key *keys() noexcept { return reinterpret_cast<Key*>(key_buffer); }
+		const Key *keys() const noexcept { return reinterpret_cast<const Key*>(key_buffer); }
+	};
 
-	template<typename F>
-	static void route(const __gc_unordered_multiset<Key, Hash, KeyEqual, Allocator, Lockable> &set, F func)
+	// an inner node on the path from the root to a leaf, and the index of the child the path took
+	struct path_entry
 	{
-		std::lock_guard lock(set.mutex);
-		GC::route(set.wrapped(), func);
-	}
-};
+		inner_node *node;
+		size_type index;
+	};
 
-template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-class __gc_unordered_map
-{
-private: // -- data -- //
+protected: // -- data -- //
 
-	typedef std::unordered_map<Key, T, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
+	node_base *root = nullptr; // the root node (null if empty)
+	leaf_node *head = nullptr; // the first leaf (null if empty)
+	leaf_node *tail = nullptr; // the last leaf (null if empty)
 
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+	size_type height = 0; // the number of inner node levels
+	size_type _size = 0;  // the number of entries
+
+	Compare comp; // the key comparator
 
 	mutable Lockable mutex; // router synchronizer
 
-	friend struct GC::router<__gc_unordered_map>;
+public: // -- iterators -- //
 
-private: // -- data accessors -- //
+	// a bidirectional iterator over the entries in key order.
+	// for a map, dereferencing yields a (key, value) pair of references - for a set, it yields a reference to the key.
+	// iterators are invalidated by any insertion or erasure.
+	template<bool Const>
+	class basic_iterator
+	{
+	public: // -- types -- //
 
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef std::conditional_t<has_values, std::pair<const Key, T>, Key> value_type;
+		typedef std::conditional_t<has_values, std::pair<const Key&, std::add_lvalue_reference_t<std::conditional_t<Const, const T, T>>>, const Key&> reference;
+		typedef void pointer;
+		typedef std::ptrdiff_t difference_type;
 
-public: // -- wrapped obj access -- //
+	private: // -- data -- //
 
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
+		const __gc_btree *tree = nullptr;
+		leaf_node *leaf = nullptr; // null for end()
+		size_type slot = 0;
 
-public: // -- typedefs -- //
+		friend class __gc_btree;
+		template<bool> friend class basic_iterator;
 
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::mapped_type mapped_type;
+		basic_iterator(const __gc_btree *_tree, leaf_node *_leaf, size_type _slot) noexcept : tree(_tree), leaf(_leaf), slot(_slot) {}
 
-	typedef typename wrapped_t::value_type value_type;
+	public: // -- ctor / dtor / asgn -- //
 
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
+		basic_iterator() noexcept = default;
 
-	typedef typename wrapped_t::hasher hasher;
-	typedef typename wrapped_t::key_equal key_equal;
+		template<bool C = Const, std::enable_if_t<C, int> = 0>
+		basic_iterator(const basic_iterator<false> &other) noexcept : tree(other.tree), leaf(other.leaf), slot(other.slot) {}
 
-	typedef typename wrapped_t::allocator_type allocator_type;
+	public: // -- access -- //
 
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
+		reference operator*() const
+		{
+			if constexpr (has_values) return { leaf->keys()[slot], leaf->values.data()[slot] };
+			else return leaf->keys()[slot];
+		}
 
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
+		const Key &key() const { return leaf->keys()[slot]; }
 
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
+	public: // -- iteration -- //
 
-	typedef typename wrapped_t::local_iterator local_iterator;
-	typedef typename wrapped_t::const_local_iterator const_local_iterator;
+		basic_iterator &operator++() noexcept
+		{
+			if (++slot == leaf->count) { leaf = leaf->next; slot = 0; }
+			return *this;
+		}
+		basic_iterator &operator--() noexcept
+		{
+			if (!leaf) { leaf = tree->tail; slot = leaf->count - 1; }
+			else if (slot == 0) { leaf = leaf->prev; slot = leaf->count - 1; }
+			else --slot;
+			return *this;
+		}
 
-	typedef typename wrapped_t::node_type node_type;
-	typedef typename wrapped_t::insert_return_type insert_return_type;
+		basic_iterator operator++(int) noexcept { basic_iterator old = *this; ++*this; return old; }
+		basic_iterator operator--(int) noexcept { basic_iterator old = *this; --*this; return old; }
 
-public: // -- ctor / dtor -- //
+	public: // -- cmp -- //
 
-	__gc_unordered_map()
-	{
-		new (buffer) wrapped_t();
-	}
-	explicit __gc_unordered_map(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
-	}
+		friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept { return a.leaf == b.leaf && a.slot == b.slot; }
+		friend bool operator!=(const basic_iterator &a, const basic_iterator &b) noexcept { return !(a == b); }
+	};
 
-	__gc_unordered_map(size_type bucket_count, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(bucket_count, alloc);
-	}
-	__gc_unordered_map(size_type bucket_count, const Hash &hash, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(bucket_count, hash, alloc);
-	}
+	typedef basic_iterator<false> iterator;
+	typedef basic_iterator<true> const_iterator;
 
-	explicit __gc_unordered_map(const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(alloc);
-	}
+protected: // -- entry helpers -- //
 
-	template<typename InputIt>
-	__gc_unordered_map(InputIt first, InputIt last)
+	// constructs the entry at slot i of leaf (which must be unconstructed)
+	template<typename K, typename ...Args>
+	static void __construct(leaf_node *leaf, size_type i, K &&key, Args &&...args)
 	{
-		new (buffer) wrapped_t(first, last);
+		::new (leaf->keys() + i) Key(std::forward<K>(key));
+		if constexpr (has_values)
+		{
+			try { ::new (leaf->values.data() + i) T(std::forward<Args>(args)...); }
+			catch (...) { leaf->keys()[i].~Key(); throw; }
+		}
 	}
-	template<typename InputIt>
-	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+	// copy constructs the entry at slot j of dest (which must be unconstructed) from the entry at slot i of src
+	static void __copy(const leaf_node *src, size_type i, leaf_node *dest, size_type j)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
+		if constexpr (has_values) __construct(dest, j, src->keys()[i], src->values.data()[i]);
+		else __construct(dest, j, src->keys()[i]);
 	}
-
-	template<typename InputIt>
-	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
+	// moves the entry at slot i of src into slot j of dest (which must be unconstructed) - slot i of src is left unconstructed
+	static void __relocate(leaf_node *src, size_type i, leaf_node *dest, size_type j)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+		::new (dest->keys() + j) Key(std::move(src->keys()[i]));
+		src->keys()[i].~Key();
+		if constexpr (has_values)
+		{
+			::new (dest->values.data() + j) T(std::move(src->values.data()[i]));
+			src->values.data()[i].~T();
+		}
 	}
-
-	template<typename InputIt>
-	__gc_unordered_map(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	static void __destroy(leaf_node *leaf, size_type i) noexcept
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
+		leaf->keys()[i].~Key();
+		if constexpr (has_values) leaf->values.data()[i].~T();
 	}
 
-	__gc_unordered_map(const __gc_unordered_map &other)
+	// moves keys [first, last) one slot to the right (or left) - the vacated slot is left unconstructed
+	static void __shift_right(Key *keys, size_type first, size_type last)
 	{
-		new (buffer) wrapped_t(other.wrapped());
+		for (size_type i = last; i > first; --i) { ::new (keys + i) Key(std::move(keys[i - 1])); keys[i - 1].~Key(); }
 	}
-	__gc_unordered_map(const wrapped_t &other)
+	static void __shift_left(Key *keys, size_type first, size_type last)
 	{
-		new (buffer) wrapped_t(other);
+		for (size_type i = first; i < last; ++i) { ::new (keys + i - 1) Key(std::move(keys[i])); keys[i].~Key(); }
 	}
 
-	__gc_unordered_map(const __gc_unordered_map &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
-	}
-	__gc_unordered_map(const wrapped_t &other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(other, alloc);
-	}
+protected: // -- search helpers -- //
 
-	__gc_unordered_map(__gc_unordered_map &&other)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
-	}
-	__gc_unordered_map(wrapped_t &&other)
+	// gets the index of the first of the count keys that is not less than key (if Upper, the first that is greater than key).
+	// this is a branchless binary search, as in flat_map.
+	template<bool Upper>
+	size_type __search(const Key *keys, size_type count, const Key &key) const
 	{
-		new (buffer) wrapped_t(std::move(other));
-	}
+		if (count == 0) return 0;
 
-	__gc_unordered_map(__gc_unordered_map &&other, const Allocator &alloc)
-	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
-	}
-	__gc_unordered_map(wrapped_t &&other, const Allocator &alloc)
-	{
-		new (buffer) wrapped_t(std::move(other), alloc);
+		const Key *base = keys;
+		size_type len = count;
+		while (len > 1)
+		{
+			size_type half = len / 2;
+			base = (Upper ? !comp(key, base[half]) : comp(base[half], key)) ? base + half : base;
+			len -= half;
+		}
+		return (base - keys) + ((Upper ? !comp(key, *base) : comp(*base, key)) ? 1 : 0);
 	}
 
-	__gc_unordered_map(std::initializer_list<value_type> init)
+	// gets the leaf that key belongs in, recording the path to it (if path is non-null).
+	// the tree must not be empty.
+	leaf_node *__descend(const Key &key, path_entry *path) const
 	{
-		new (buffer) wrapped_t(init);
-	}
-	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
-	{
-		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
+		node_base *node = root;
+		for (size_type depth = 0; !node->is_leaf; ++depth)
+		{
+			inner_node *inner = static_cast<inner_node*>(node);
+			size_type i = __search<true>(inner->separators(), inner->count, key);
+
+			if (path) path[depth] = { inner, i };
+			node = inner->children[i];
+		}
+		return static_cast<leaf_node*>(node);
 	}
 
-	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+	// gets the position of key (end if not present)
+	const_iterator __find(const Key &key) const
 	{
-		new (buffer) wrapped_t(init, bucket_count, alloc);
+		if (!root) return { this, nullptr, 0 };
+
+		leaf_node *leaf = __descend(key, nullptr);
+		size_type i = __search<false>(leaf->keys(), leaf->count, key);
+		return i < leaf->count && !comp(key, leaf->keys()[i]) ? const_iterator{ this, leaf, i } : const_iterator{ this, nullptr, 0 };
 	}
-	__gc_unordered_map(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	// gets the position of the first entry not less than key (if Upper, greater than key)
+	template<bool Upper>
+	const_iterator __bound(const Key &key) const
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
-	}
+		if (!root) return { this, nullptr, 0 };
 
-	~__gc_unordered_map()
-	{
-		wrapped().~wrapped_t();
+		leaf_node *leaf = __descend(key, nullptr);
+		size_type i = __search<Upper>(leaf->keys(), leaf->count, key);
+		if (i == leaf->count) return { this, leaf->next, 0 }; // everything in the next leaf is at least our right separator, which is greater than key
+		return { this, leaf, i };
 	}
 
-public: // -- assign -- //
+	static iterator __mutable(const_iterator it) noexcept { return { it.tree, it.leaf, it.slot }; }
 
-	__gc_unordered_map &operator=(const __gc_unordered_map &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
-	}
-	__gc_unordered_map &operator=(const wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
-	}
+protected: // -- insert helpers -- //
 
-	__gc_unordered_map &operator=(__gc_unordered_map &&other)
+	// inserts an entry for key if it is not already present - returns its position and true iff the insertion took place.
+	// construct(leaf, i) must construct an entry for key at slot i of leaf.
+	template<typename Construct>
+	std::pair<iterator, bool> __insert(const Key &key, Construct construct)
 	{
-		if (this != &other)
+		if (!root)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			std::unique_ptr<leaf_node> leaf(new leaf_node);
+			construct(leaf.get(), 0);
+			leaf->count = 1;
+
+			root = head = tail = leaf.release();
+			_size = 1;
+			return { { this, head, 0 }, true };
 		}
-		return *this;
-	}
-	__gc_unordered_map &operator=(wrapped_t &&other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
+
+		path_entry path[max_height];
+		leaf_node *leaf = __descend(key, path);
+		size_type i = __search<false>(leaf->keys(), leaf->count, key);
+		if (i < leaf->count && !comp(key, leaf->keys()[i])) return { { this, leaf, i }, false };
+
+		if (leaf->count == leaf_slots)
+		{
+			// a full leaf is split, which in turn splits each full inner node above it.
+			// allocate all the new nodes and copy the new separator up front so that an allocation failure (or a throwing key copy) leaves the tree untouched.
+			size_type splits = 0;
+			while (splits < height && path[height - 1 - splits].node->count == max_keys) ++splits;
+
+			std::unique_ptr<inner_node> spares[max_height + 1];
+			for (size_type s = 0; s < splits + (splits == height ? 1 : 0); ++s) spares[s].reset(new inner_node);
+			std::unique_ptr<leaf_node> right_owner(new leaf_node);
+			Key separator(leaf->keys()[min_leaf]); // the first key of the new leaf
+
+			// move the upper half into the new leaf (on its right)
+			leaf_node *right = right_owner.release();
+			for (size_type s = min_leaf; s < leaf_slots; ++s) __relocate(leaf, s, right, s - min_leaf);
+			right->count = leaf_slots - min_leaf;
+			leaf->count = min_leaf;
+
+			right->prev = leaf;
+			right->next = leaf->next;
+			(leaf->next ? leaf->next->prev : tail) = right;
+			leaf->next = right;
+
+			__insert_separator(path, std::move(separator), right, spares);
+
+			// the new entry never becomes the first in the right leaf (that would invalidate its separator)
+			if (i > min_leaf) { leaf = right; i -= min_leaf; }
+		}
+
+		// shift the entries after i over to make room
+		for (size_type s = leaf->count; s > i; --s) __relocate(leaf, s - 1, leaf, s);
+		try { construct(leaf, i); }
+		catch (...) { for (size_type s = i; s < leaf->count; ++s) __relocate(leaf, s + 1, leaf, s); throw; }
+		++leaf->count;
+
+		++_size;
+		return { { this, leaf, i }, true };
 	}
 
-	__gc_unordered_map &operator=(std::initializer_list<value_type> ilist)
+	// inserts separator (and child to its right) into the inner node at the bottom of path, splitting full nodes on the way up.
+	// spares must hold a new node for each split (including a new root).
+	void __insert_separator(path_entry *path, Key separator, node_base *child, std::unique_ptr<inner_node> *spares)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
-	}
+		for (size_type depth = height; depth-- > 0; )
+		{
+			inner_node *inner = path[depth].node;
+			size_type i = path[depth].index;
 
-public: // -- misc -- //
+			if (inner->count < max_keys) { __inner_insert(inner, i, std::move(separator), child); return; }
 
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+			// split around the middle separator, which moves up to the parent
+			inner_node *right = (spares++)->release();
+			const size_type mid = max_keys / 2;
+			Key *separators = inner->separators();
 
-public: // -- iterators -- //
+			Key up(std::move(separators[mid]));
+			separators[mid].~Key();
+			for (size_type s = mid + 1; s < max_keys; ++s)
+			{
+				::new (right->separators() + (s - mid - 1)) Key(std::move(separators[s]));
+				separators[s].~Key();
+			}
+			std::copy(inner->children + mid + 1, inner->children + max_keys + 1, right->children);
+			right->count = max_keys - mid - 1;
+			inner->count = mid;
 
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+			if (i <= mid) __inner_insert(inner, i, std::move(separator), child);
+			else __inner_insert(right, i - mid - 1, std::move(separator), child);
 
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
+			separator = std::move(up);
+			child = right;
+		}
 
-public: // -- size / cap -- //
+		// the root was split - grow a new root above it
+		inner_node *new_root = spares->release();
+		::new (new_root->separators()) Key(std::move(separator));
+		new_root->children[0] = root;
+		new_root->children[1] = child;
+		new_root->count = 1;
 
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
+		root = new_root;
+		++height;
+	}
+	// inserts separator at index i of a non-full inner node, with child immediately to its right
+	static void __inner_insert(inner_node *inner, size_type i, Key &&separator, node_base *child)
+	{
+		__shift_right(inner->separators(), i, inner->count);
+		::new (inner->separators() + i) Key(std::move(separator));
 
-	size_type max_size() const noexcept { return wrapped().max_size(); }
+		std::copy_backward(inner->children + i + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+		inner->children[i + 1] = child;
 
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
+		++inner->count;
 	}
 
-public: // -- insert / erase -- //
+protected: // -- erase helpers -- //
 
-	std::pair<iterator, bool> insert(const value_type &value)
+	// erases the entry for key - returns true iff there was one
+	bool __erase(const Key &key)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
+		if (!root) return false;
+
+		path_entry path[max_height];
+		leaf_node *leaf = __descend(key, path);
+		size_type i = __search<false>(leaf->keys(), leaf->count, key);
+		if (i == leaf->count || comp(key, leaf->keys()[i])) return false;
+
+		__destroy(leaf, i);
+		for (size_type s = i + 1; s < leaf->count; ++s) __relocate(leaf, s, leaf, s - 1);
+		--leaf->count;
+		--_size;
+
+		if (height == 0)
+		{
+			// the root leaf can hold any number of entries - but an empty tree has no nodes
+			if (leaf->count == 0) { delete leaf; root = head = tail = nullptr; }
+		}
+		else if (leaf->count < min_leaf) __fix_leaf(path, leaf);
+
+		return true;
 	}
 
-	template<typename P>
-	std::pair<iterator, bool> insert(P &&value)
+	// fixes an underfull (non-root) leaf by borrowing an entry from a sibling or merging with one
+	void __fix_leaf(path_entry *path, leaf_node *leaf)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::forward<P>(value));
+		inner_node *parent = path[height - 1].node;
+		size_type i = path[height - 1].index;
+
+		leaf_node *left = i > 0 ? static_cast<leaf_node*>(parent->children[i - 1]) : nullptr;
+		leaf_node *right = i < parent->count ? static_cast<leaf_node*>(parent->children[i + 1]) : nullptr;
+
+		if (left && left->count > min_leaf)
+		{
+			for (size_type s = leaf->count; s > 0; --s) __relocate(leaf, s - 1, leaf, s);
+			__relocate(left, --left->count, leaf, 0);
+			++leaf->count;
+
+			parent->separators()[i - 1] = leaf->keys()[0];
+		}
+		else if (right && right->count > min_leaf)
+		{
+			__relocate(right, 0, leaf, leaf->count++);
+			for (size_type s = 1; s < right->count; ++s) __relocate(right, s, right, s - 1);
+			--right->count;
+
+			parent->separators()[i] = right->keys()[0];
+		}
+		else
+		{
+			// merge the right leaf of the pair into the left one
+			leaf_node *a = left ? left : leaf;
+			leaf_node *b = left ? leaf : right;
+			size_type sep = left ? i - 1 : i;
+
+			for (size_type s = 0; s < b->count; ++s) __relocate(b, s, a, a->count + s);
+			a->count += b->count;
+
+			a->next = b->next;
+			(b->next ? b->next->prev : tail) = a;
+			delete b;
+
+			__inner_remove(parent, sep);
+			__fix_inner(path, height - 1);
+		}
 	}
 
-	iterator insert(const_iterator hint, const value_type &value)
+	// fixes the inner node at the given depth of path (if it's underfull) by borrowing a separator from a sibling or merging with one.
+	// merging removes a separator from the parent, which is then fixed in turn.
+	void __fix_inner(path_entry *path, size_type depth)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
-	}
+		for (; ; --depth)
+		{
+			inner_node *inner = path[depth].node;
+
+			if (depth == 0)
+			{
+				// the root only needs a single child - if that's all it has left, the child becomes the root
+				if (inner->count == 0)
+				{
+					root = inner->children[0];
+					delete inner;
+					--height;
+				}
+				return;
+			}
+			if (inner->count >= min_keys) return;
+
+			inner_node *parent = path[depth - 1].node;
+			size_type i = path[depth - 1].index;
+
+			inner_node *left = i > 0 ? static_cast<inner_node*>(parent->children[i - 1]) : nullptr;
+			inner_node *right = i < parent->count ? static_cast<inner_node*>(parent->children[i + 1]) : nullptr;
+
+			if (left && left->count > min_keys)
+			{
+				// rotate right - the parent's separator comes down to our front and the left sibling's last one goes up
+				__shift_right(inner->separators(), 0, inner->count);
+				::new (inner->separators()) Key(std::move(parent->separators()[i - 1]));
+				std::copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+				inner->children[0] = left->children[left->count];
+				++inner->count;
+
+				parent->separators()[i - 1] = std::move(left->separators()[left->count - 1]);
+				left->separators()[--left->count].~Key();
+				return;
+			}
+			if (right && right->count > min_keys)
+			{
+				// rotate left - the parent's separator comes down to our back and the right sibling's first one goes up
+				::new (inner->separators() + inner->count) Key(std::move(parent->separators()[i]));
+				inner->children[inner->count + 1] = right->children[0];
+				++inner->count;
+
+				parent->separators()[i] = std::move(right->separators()[0]);
+				right->separators()[0].~Key();
+				__shift_left(right->separators(), 1, right->count);
+				std::copy(right->children + 1, right->children + right->count + 1, right->children);
+				--right->count;
+				return;
+			}
+
+			// merge the right node of the pair into the left one (with the parent's separator between them)
+			inner_node *a = left ? left : inner;
+			inner_node *b = left ? inner : right;
+			size_type sep = left ? i - 1 : i;
+
+			::new (a->separators() + a->count) Key(std::move(parent->separators()[sep]));
+			for (size_type s = 0; s < b->count; ++s)
+			{
+				::new (a->separators() + a->count + 1 + s) Key(std::move(b->separators()[s]));
+				b->separators()[s].~Key();
+			}
+			std::copy(b->children, b->children + b->count + 1, a->children + a->count + 1);
+			a->count += b->count + 1;
+			delete b;
 
-	template<typename P>
-	iterator insert(const_iterator hint, P &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::forward<P>(value));
+			__inner_remove(parent, sep);
+		}
 	}
 
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
+	// removes separator i (and the child to its right) from an inner node
+	static void __inner_remove(inner_node *inner, size_type i)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
+		inner->separators()[i].~Key();
+		__shift_left(inner->separators(), i + 1, inner->count);
+		std::copy(inner->children + i + 2, inner->children + inner->count + 1, inner->children + i + 1);
+		--inner->count;
 	}
 
-	void insert(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
-	}
+protected: // -- bulk helpers -- //
 
-	std::pair<iterator, bool> insert(value_type &&value)
+	// destroys the subtree rooted at node
+	static void __free(node_base *node) noexcept
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
+		if (node->is_leaf)
+		{
+			leaf_node *leaf = static_cast<leaf_node*>(node);
+			for (size_type i = 0; i < leaf->count; ++i) __destroy(leaf, i);
+			delete leaf;
+		}
+		else
+		{
+			inner_node *inner = static_cast<inner_node*>(node);
+			for (size_type i = 0; i <= inner->count; ++i) __free(inner->children[i]);
+			for (size_type i = 0; i < inner->count; ++i) inner->separators()[i].~Key();
+			delete inner;
+		}
 	}
-	iterator insert(const_iterator hint, value_type &&value)
+	// destroys all the entries and nodes
+	void __clear() noexcept
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
-	}
+		if (root) __free(root);
 
-	insert_return_type insert(node_type &&nh)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		root = head = tail = nullptr;
+		height = 0;
+		_size = 0;
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+
+	// builds the tree (which must be empty) bottom-up from count entries in ascending key order (with no duplicates).
+	// construct(leaf, i) must construct the next entry at slot i of leaf.
+	// this is O(n) and leaves every node about as full as possible (rather than about half full after a split).
+	template<typename Construct>
+	void __build(size_type count, Construct construct)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		if (count == 0) return;
+
+		const size_type leaf_count = (count + leaf_slots - 1) / leaf_slots;
+
+		std::vector<leaf_node*> leaves;
+		std::vector<inner_node*> inners; // each inner node has at least 2 children, so there are fewer of these than leaves
+		leaves.reserve(leaf_count);
+		inners.reserve(leaf_count);
+
+		try
+		{
+			// spread the entries evenly, so that every leaf has at least the minimum
+			for (size_type l = 0; l < leaf_count; ++l)
+			{
+				leaf_node *leaf = new leaf_node;
+				leaves.push_back(leaf);
+
+				const size_type fill = count / leaf_count + (l < count % leaf_count ? 1 : 0);
+				for (; leaf->count < fill; ++leaf->count) construct(leaf, leaf->count);
+			}
+
+			// build each level over the one below it until there's only one node
+			std::vector<node_base*> level(leaves.begin(), leaves.end());
+			std::vector<const Key*> least; // the least key in each node of level
+			for (leaf_node *leaf : leaves) least.push_back(leaf->keys());
+
+			while (level.size() > 1)
+			{
+				const size_type group_count = (level.size() + inner_slots - 1) / inner_slots;
+				std::vector<node_base*> up;
+				std::vector<const Key*> up_least;
+
+				for (size_type g = 0, c = 0; g < group_count; ++g)
+				{
+					inner_node *inner = new inner_node;
+					inners.push_back(inner);
+					up.push_back(inner);
+					up_least.push_back(least[c]);
+
+					const size_type fill = level.size() / group_count + (g < level.size() % group_count ? 1 : 0);
+					inner->children[0] = level[c];
+					for (size_type k = 1; k < fill; ++k)
+					{
+						::new (inner->separators() + inner->count) Key(*least[c + k]);
+						inner->children[k] = level[c + k];
+						++inner->count;
+					}
+					c += fill;
+				}
+
+				level.swap(up);
+				least.swap(up_least);
+			}
+
+			root = level.front();
+		}
+		catch (...)
+		{
+			for (leaf_node *leaf : leaves)
+			{
+				for (size_type i = 0; i < leaf->count; ++i) __destroy(leaf, i);
+				delete leaf;
+			}
+			for (inner_node *inner : inners)
+			{
+				for (size_type i = 0; i < inner->count; ++i) inner->separators()[i].~Key();
+				delete inner;
+			}
+			root = nullptr;
+			throw;
+		}
+
+		for (size_type l = 1; l < leaf_count; ++l)
+		{
+			leaves[l - 1]->next = leaves[l];
+			leaves[l]->prev = leaves[l - 1];
+		}
+		head = leaves.front();
+		tail = leaves.back();
+		_size = count;
+
+		height = 0;
+		for (node_base *node = root; !node->is_leaf; node = static_cast<inner_node*>(node)->children[0]) ++height;
 	}
 
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj)
+	// builds the tree (which must be empty) as a copy of other's entries
+	void __build_copy(const __gc_btree &other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(k, std::forward<M>(obj));
+		const leaf_node *src = other.head;
+		size_type i = 0;
+
+		__build(other._size, [&](leaf_node *leaf, size_type slot)
+		{
+			__copy(src, i, leaf, slot);
+			if (++i == src->count) { src = src->next; i = 0; }
+		});
 	}
-	template<typename M>
-	std::pair<iterator, bool> insert_or_assign(key_type &&k, M &&obj)
+
+	// builds the tree (which must be empty) from a batch of entries in any order - for equivalent keys, only the first is kept.
+	// get_key(entry) gets an entry's key, and construct(leaf, i, entry) constructs it at slot i of leaf (it may move from entry).
+	template<typename Batch, typename GetKey, typename Construct>
+	void __build_batch(Batch &batch, GetKey get_key, Construct construct)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(std::move(k), std::forward<M>(obj));
+		std::stable_sort(batch.begin(), batch.end(), [&](const auto &a, const auto &b) { return comp(get_key(a), get_key(b)); });
+		batch.erase(std::unique(batch.begin(), batch.end(), [&](const auto &a, const auto &b) { return !comp(get_key(a), get_key(b)); }), batch.end());
+
+		auto it = batch.begin();
+		__build(batch.size(), [&](leaf_node *leaf, size_type slot) { construct(leaf, slot, *it++); });
 	}
 
-	template<typename M>
-	iterator insert_or_assign(const_iterator hint, const key_type &k, M &&obj)
+	// routes all the keys and values - the mutex must be held
+	template<typename F>
+	void __route(F func) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(hint, k, std::forward<M>(obj));
+		// each leaf's keys and values are contiguous, so this is a linear scan per leaf (keys are usually trivial, in which case they're skipped entirely)
+		for (const leaf_node *leaf = head; leaf; leaf = leaf->next)
+		{
+			if constexpr (has_values) GC::route_range(leaf->values.data(), leaf->values.data() + leaf->count, func);
+			GC::route_range(leaf->keys(), leaf->keys() + leaf->count, func);
+		}
+
+		// separators are copies of keys, so they also need routing if keys do
+		if constexpr (!GC::has_trivial_router<Key>::value) if (root) __route_separators(root, func);
 	}
-	template<typename M>
-	iterator insert_or_assign(const_iterator hint, key_type &&k, M &&obj)
+	template<typename F>
+	static void __route_separators(const node_base *node, F &func)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert_or_assign(hint, std::move(k), std::forward<M>(obj));
+		if (node->is_leaf) return;
+
+		const inner_node *inner = static_cast<const inner_node*>(node);
+		GC::route_range(inner->separators(), inner->separators() + inner->count, func);
+		for (size_type i = 0; i <= inner->count; ++i) __route_separators(inner->children[i], func);
 	}
 
-	template<typename ...Args>
-	std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
+protected: // -- ctor / dtor / asgn -- //
+
+	__gc_btree() = default;
+	explicit __gc_btree(const Compare &_comp) : comp(_comp) {}
+
+	__gc_btree(const __gc_btree &other) : comp(other.comp)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(k, std::forward<Args>(args)...);
+		GC::router_lock_t<Lockable> lock(other.mutex);
+		__build_copy(other);
 	}
-	template<typename ...Args>
-	std::pair<iterator, bool> try_emplace(key_type &&k, Args &&...args)
+	__gc_btree(__gc_btree &&other) : comp(other.comp)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(std::move(k), std::forward<Args>(args)...);
+		std::lock_guard lock(other.mutex);
+		__swap_nodes(other);
 	}
 
-	template<typename ...Args>
-	iterator try_emplace(const_iterator hint, const key_type &k, Args &&...args)
+	~__gc_btree() { __clear(); }
+
+	__gc_btree &operator=(const __gc_btree &other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(hint, k, std::forward<Args>(args)...);
+		if (this != &other)
+		{
+			// copy outside the lock, then swap the copy in (the old nodes are destroyed with the copy)
+			__gc_btree temp(other);
+
+			std::lock_guard lock(this->mutex);
+			__swap_nodes(temp);
+			comp = other.comp;
+		}
+		return *this;
 	}
-	template<typename ...Args>
-	iterator try_emplace(const_iterator hint, key_type &&k, Args &&...args)
+	__gc_btree &operator=(__gc_btree &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().try_emplace(hint, std::move(k), std::forward<Args>(args)...);
+		if (this != &other) __swap(other);
+		return *this;
 	}
 
-	template<typename ...Args>
-	std::pair<iterator, bool> emplace(Args &&...args)
+	void __swap_nodes(__gc_btree &other) noexcept
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		std::swap(root, other.root);
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+		std::swap(height, other.height);
+		std::swap(_size, other._size);
 	}
-	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
+	void __swap(__gc_btree &other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+		if (this != &other)
+		{
+			std::scoped_lock locks(this->mutex, other.mutex);
+			__swap_nodes(other);
+			std::swap(comp, other.comp);
+		}
 	}
 
-	iterator erase(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
-	}
-	iterator erase(const_iterator first, const_iterator last)
+public: // -- iterators -- //
+
+	iterator begin() noexcept { return { this, head, 0 }; }
+	iterator end() noexcept { return { this, nullptr, 0 }; }
+
+	const_iterator begin() const noexcept { return { this, head, 0 }; }
+	const_iterator end() const noexcept { return { this, nullptr, 0 }; }
+
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+public: // -- lookup -- //
+
+	bool contains(const Key &key) const { return __find(key) != end(); }
+	size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+	// gets an iterator to the first entry whose key is not less than key
+	iterator lower_bound(const Key &key) { return __mutable(__bound<false>(key)); }
+	const_iterator lower_bound(const Key &key) const { return __bound<false>(key); }
+
+	// gets an iterator to the first entry whose key is greater than key
+	iterator upper_bound(const Key &key) { return __mutable(__bound<true>(key)); }
+	const_iterator upper_bound(const Key &key) const { return __bound<true>(key); }
+
+public: // -- erase -- //
+
+	// removes the entry for key - returns the number of entries removed (0 or 1)
+	size_type erase(const Key &key)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		return __erase(key) ? 1 : 0;
 	}
 
-	size_type erase(const key_type &k)
+	void clear()
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().erase(k);
+		__clear();
 	}
 
-public: // -- swap -- //
+public: // -- size -- //
 
-	void swap(__gc_unordered_map &other)
+	bool empty() const noexcept { return _size == 0; }
+	size_type size() const noexcept { return _size; }
+
+	key_compare key_comp() const { return comp; }
+};
+
+template<typename Key, typename T, typename Compare, typename Lockable>
+class __gc_btree_map : public __gc_btree<Key, T, Compare, Lockable>
+{
+private: // -- types -- //
+
+	typedef __gc_btree<Key, T, Compare, Lockable> base;
+	typedef typename base::leaf_node leaf_node;
+
+public: // -- typedefs -- //
+
+	typedef T mapped_type;
+	typedef std::pair<const Key, T> value_type;
+
+	typedef typename base::size_type size_type;
+
+	typedef typename base::iterator iterator;
+	typedef typename base::const_iterator const_iterator;
+
+private: // -- data -- //
+
+	friend struct GC::router<__gc_btree_map>;
+
+private: // -- helpers -- //
+
+	// inserts each pair-like value in [b, e) whose key is not already present (as std::map::insert) - the mutex must be held.
+	// loading an empty map sorts the batch and builds the tree bottom-up in O(n log n), rather than inserting one at a time.
+	template<typename InputIt>
+	void __insert_bulk(InputIt b, InputIt e)
 	{
-		if (this != &other)
+		if (!this->empty())
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			for (; b != e; ++b) this->__insert(b->first, [&](leaf_node *leaf, std::size_t i) { base::__construct(leaf, i, b->first, b->second); });
+			return;
 		}
-	}
-	void swap(wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
-	}
 
-	friend void swap(__gc_unordered_map &a, __gc_unordered_map &b) { a.swap(b); }
-	friend void swap(__gc_unordered_map &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_unordered_map &b) { b.swap(a); }
+		std::vector<std::pair<Key, T>> batch;
+		for (; b != e; ++b) batch.emplace_back(b->first, b->second);
 
-public: // -- extract -- //
+		this->__build_batch(batch, [](const auto &entry) -> const Key& { return entry.first; },
+			[](leaf_node *leaf, std::size_t i, auto &entry) { base::__construct(leaf, i, std::move(entry.first), std::move(entry.second)); });
+	}
 
-	node_type extract(const_iterator pos)
+public: // -- transactional access -- //
+
+	// invokes f with a reference to this map under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// f's calls on the map lock it again, so this requires a recursive lockable (as the default lockable is).
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
 	{
 		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
+		return std::forward<F>(f)(*this);
 	}
-	node_type extract(const key_type &key)
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
 
-	// !! ADD MERGE FUNCTIONS (C++17)
-
-public: // -- element access -- //
+public: // -- ctor / dtor / asgn -- //
 
-	T &at(const Key &key) { return wrapped().at(key); }
-	const T &at(const Key &key) const { return wrapped().at(key); }
+	__gc_btree_map() = default;
+	explicit __gc_btree_map(const Compare &_comp) : base(_comp) {}
 
-	T &operator[](const Key &key)
+	template<typename InputIt>
+	__gc_btree_map(InputIt b, InputIt e, const Compare &_comp = Compare()) : base(_comp)
 	{
-		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
-		return wrapped()[key];
+		__insert_bulk(b, e);
 	}
-	T &operator[](Key &&key)
+
+	__gc_btree_map(std::initializer_list<std::pair<Key, T>> init, const Compare &_comp = Compare()) : base(_comp)
 	{
-		std::lock_guard lock(this->mutex); // operator[] performs an insertion if key doesn't exist
-		return wrapped()[std::move(key)];
+		__insert_bulk(init.begin(), init.end());
 	}
 
-public: // -- lookup -- //
-
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
-
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
-
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
+	__gc_btree_map(const __gc_btree_map&) = default;
+	__gc_btree_map(__gc_btree_map&&) = default;
 
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
+	__gc_btree_map &operator=(const __gc_btree_map&) = default;
+	__gc_btree_map &operator=(__gc_btree_map&&) = default;
 
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+public: // -- obj access -- //
 
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+	// gets a pointer to the value associated with key, or null if not present.
+	// the pointer is invalidated by any insertion or erasure.
+	T *find(const Key &key) { const_iterator it = this->__find(key); return it != this->end() ? &(*base::__mutable(it)).second : nullptr; }
+	const T *find(const Key &key) const { const_iterator it = this->__find(key); return it != this->end() ? &(*it).second : nullptr; }
 
-public: // -- bucket interface -- //
+	T &at(const Key &key) { T *val = find(key); if (!val) throw std::out_of_range("btree_map key not found"); return *val; }
+	const T &at(const Key &key) const { const T *val = find(key); if (!val) throw std::out_of_range("btree_map key not found"); return *val; }
 
-	local_iterator begin(size_type n) { return wrapped().begin(n); }
-	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
-	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
+	// gets the value associated with key - if not present, a default value is inserted first
+	T &operator[](const Key &key) { return *try_emplace(key).first; }
 
-	local_iterator end(size_type n) { return wrapped().end(n); }
-	const_local_iterator end(size_type n) const { return wrapped().end(n); }
-	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
+	// invokes f(key, value) for each entry in key order
+	template<typename F>
+	void for_each(F f)
+	{
+		for (auto entry : *this) f(entry.first, entry.second);
+	}
+	template<typename F>
+	void for_each(F f) const
+	{
+		for (auto entry : *this) f(entry.first, entry.second);
+	}
 
-	size_type bucket_count() const { return wrapped().bucket_count(); }
-	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
+	// invokes f(key, value) for each entry whose key is in [first, last), in key order
+	template<typename F>
+	void for_each_in_range(const Key &first, const Key &last, F f)
+	{
+		for (iterator it = this->lower_bound(first); it != this->end() && this->comp(it.key(), last); ++it) { auto entry = *it; f(entry.first, entry.second); }
+	}
+	template<typename F>
+	void for_each_in_range(const Key &first, const Key &last, F f) const
+	{
+		for (const_iterator it = this->lower_bound(first); it != this->end() && this->comp(it.key(), last); ++it) { auto entry = *it; f(entry.first, entry.second); }
+	}
 
-	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
-	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
+public: // -- insert -- //
 
-public: // -- hash policy -- //
+	// constructs a value from args and inserts it under key if key is not already present.
+	// returns a pointer to the value associated with key and true if an insertion took place.
+	template<typename ...Args>
+	std::pair<T*, bool> try_emplace(const Key &key, Args &&...args)
+	{
+		std::lock_guard lock(this->mutex);
+		auto res = this->__insert(key, [&](leaf_node *leaf, std::size_t i) { base::__construct(leaf, i, key, std::forward<Args>(args)...); });
+		return { &(*res.first).second, res.second };
+	}
 
-	float load_factor() const { return wrapped().load_factor(); }
+	std::pair<T*, bool> insert(const Key &key, const T &value) { return try_emplace(key, value); }
+	std::pair<T*, bool> insert(const Key &key, T &&value) { return try_emplace(key, std::move(value)); }
 
-	float max_load_factor() const { return wrapped().max_load_factor(); }
-	void max_load_factor(float ml)
+	template<typename V>
+	std::pair<T*, bool> insert_or_assign(const Key &key, V &&value)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().max_load_factor(ml);
+		bool assign = true;
+		auto res = this->__insert(key, [&](leaf_node *leaf, std::size_t i) { assign = false; base::__construct(leaf, i, key, std::forward<V>(value)); });
+		if (assign) (*res.first).second = std::forward<V>(value);
+		return { &(*res.first).second, res.second };
 	}
 
-	void rehash(size_type count)
+	// inserts each key/value pair in [b, e) whose key is not already present (as std::map::insert)
+	template<typename InputIt>
+	void insert(InputIt b, InputIt e)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().rehash(count);
+		__insert_bulk(b, e);
 	}
-
-	void reserve(size_type count)
+	void insert(std::initializer_list<std::pair<Key, T>> ilist)
 	{
 		std::lock_guard lock(this->mutex);
-		wrapped().reserve(count);
+		__insert_bulk(ilist.begin(), ilist.end());
 	}
 
-public: // -- observers -- //
+public: // -- swap -- //
 
-	hasher hash_function() const { return wrapped().hash_function(); }
-	key_equal key_eq() const { return wrapped().key_eq(); }
+	void swap(__gc_btree_map &other) { this->__swap(other); }
+	friend void swap(__gc_btree_map &a, __gc_btree_map &b) { a.swap(b); }
 
 public: // -- cmp -- //
 
-	friend bool operator==(const __gc_unordered_map &a, const __gc_unordered_map &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_unordered_map &a, const __gc_unordered_map &b) { return a.wrapped() != b.wrapped(); }
+	friend bool operator==(const __gc_btree_map &a, const __gc_btree_map &b) { return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin()); }
+	friend bool operator!=(const __gc_btree_map &a, const __gc_btree_map &b) { return !(a == b); }
 };
-template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-struct GC::router<__gc_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable>>
+template<typename Key, typename T, typename Compare, typename Lockable>
+struct GC::router<__gc_btree_map<Key, T, Compare, Lockable>>
 {
 	// a container's router is trivial if its contents are trivial
 	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
 
 	template<typename F>
-	static void route(const __gc_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable> &map, F func)
+	static void route(const __gc_btree_map<Key, T, Compare, Lockable> &map, F func)
 	{
-		std::lock_guard lock(map.mutex);
-		GC::route(map.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(map.mutex);
+		map.__route(func);
 	}
 };
 
-template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-class __gc_unordered_multimap
+template<typename Key, typename Compare, typename Lockable>
+class __gc_btree_set : public __gc_btree<Key, void, Compare, Lockable>
 {
-private: // -- data -- //
+private: // -- types -- //
 
-	typedef std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> wrapped_t; // the wrapped type
+	typedef __gc_btree<Key, void, Compare, Lockable> base;
+	typedef typename base::leaf_node leaf_node;
 
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+public: // -- typedefs -- //
 
-	mutable Lockable mutex; // router synchronizer
+	typedef Key value_type;
 
-	friend struct GC::router<__gc_unordered_multimap>;
+	typedef typename base::size_type size_type;
 
-private: // -- data accessors -- //
+	typedef typename base::iterator iterator;
+	typedef typename base::const_iterator const_iterator;
 
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+private: // -- data -- //
 
-public: // -- wrapped obj access -- //
+	friend struct GC::router<__gc_btree_set>;
 
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
+private: // -- helpers -- //
 
-public: // -- typedefs -- //
+	// inserts each key in [b, e) that is not already present - the mutex must be held.
+	// loading an empty set sorts the batch and builds the tree bottom-up in O(n log n), rather than inserting one at a time.
+	template<typename InputIt>
+	void __insert_bulk(InputIt b, InputIt e)
+	{
+		if (!this->empty())
+		{
+			for (; b != e; ++b) this->__insert(*b, [&](leaf_node *leaf, std::size_t i) { base::__construct(leaf, i, *b); });
+			return;
+		}
 
-	typedef typename wrapped_t::key_type key_type;
-	typedef typename wrapped_t::mapped_type mapped_type;
+		std::vector<Key> batch(b, e);
+		this->__build_batch(batch, [](const Key &key) -> const Key& { return key; },
+			[](leaf_node *leaf, std::size_t i, Key &key) { base::__construct(leaf, i, std::move(key)); });
+	}
 
-	typedef typename wrapped_t::value_type value_type;
+public: // -- transactional access -- //
 
-	typedef typename wrapped_t::size_type size_type;
-	typedef typename wrapped_t::difference_type difference_type;
+	// invokes f with a reference to this set under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. find then insert) atomic with respect to other mutators and the router.
+	// f's calls on the set lock it again, so this requires a recursive lockable (as the default lockable is).
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
+	{
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(*this);
+	}
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
+	{
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(*this);
+	}
 
-	typedef typename wrapped_t::hasher hasher;
-	typedef typename wrapped_t::key_equal key_equal;
+public: // -- ctor / dtor / asgn -- //
 
-	typedef typename wrapped_t::allocator_type allocator_type;
+	__gc_btree_set() = default;
+	explicit __gc_btree_set(const Compare &_comp) : base(_comp) {}
 
-	typedef typename wrapped_t::reference reference;
-	typedef typename wrapped_t::const_reference const_reference;
+	template<typename InputIt>
+	__gc_btree_set(InputIt b, InputIt e, const Compare &_comp = Compare()) : base(_comp)
+	{
+		__insert_bulk(b, e);
+	}
 
-	typedef typename wrapped_t::pointer pointer;
-	typedef typename wrapped_t::const_pointer const_pointer;
+	__gc_btree_set(std::initializer_list<Key> init, const Compare &_comp = Compare()) : base(_comp)
+	{
+		__insert_bulk(init.begin(), init.end());
+	}
 
-	typedef typename wrapped_t::iterator iterator;
-	typedef typename wrapped_t::const_iterator const_iterator;
+	__gc_btree_set(const __gc_btree_set&) = default;
+	__gc_btree_set(__gc_btree_set&&) = default;
 
-	typedef typename wrapped_t::local_iterator local_iterator;
-	typedef typename wrapped_t::const_local_iterator const_local_iterator;
+	__gc_btree_set &operator=(const __gc_btree_set&) = default;
+	__gc_btree_set &operator=(__gc_btree_set&&) = default;
 
-	typedef typename wrapped_t::node_type node_type;
+public: // -- obj access -- //
 
-public: // -- ctor / dtor -- //
+	// gets an iterator to key (or end if not present)
+	const_iterator find(const Key &key) const { return this->__find(key); }
 
-	__gc_unordered_multimap()
+	// invokes f(key) for each key in order
+	template<typename F>
+	void for_each(F f) const
 	{
-		new (buffer) wrapped_t();
+		for (const Key &key : *this) f(key);
 	}
-	explicit __gc_unordered_multimap(size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+
+	// invokes f(key) for each key in [first, last), in order
+	template<typename F>
+	void for_each_in_range(const Key &first, const Key &last, F f) const
 	{
-		new (buffer) wrapped_t(bucket_count, hash, equal, alloc);
+		for (const_iterator it = this->lower_bound(first); it != this->end() && this->comp(*it, last); ++it) f(*it);
 	}
 
-	__gc_unordered_multimap(size_type bucket_count, const Allocator &alloc)
+public: // -- insert -- //
+
+	// inserts key if it is not already present - returns true iff the insertion took place
+	bool insert(const Key &key)
 	{
-		new (buffer) wrapped_t(bucket_count, alloc);
+		std::lock_guard lock(this->mutex);
+		return this->__insert(key, [&](leaf_node *leaf, std::size_t i) { base::__construct(leaf, i, key); }).second;
 	}
-	__gc_unordered_multimap(size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	bool insert(Key &&key)
 	{
-		new (buffer) wrapped_t(bucket_count, hash, alloc);
+		std::lock_guard lock(this->mutex);
+		return this->__insert(key, [&](leaf_node *leaf, std::size_t i) { base::__construct(leaf, i, std::move(key)); }).second;
 	}
 
-	explicit __gc_unordered_multimap(const Allocator &alloc)
+	// inserts each key in [b, e) that is not already present
+	template<typename InputIt>
+	void insert(InputIt b, InputIt e)
 	{
-		new (buffer) wrapped_t(alloc);
+		std::lock_guard lock(this->mutex);
+		__insert_bulk(b, e);
+	}
+	void insert(std::initializer_list<Key> ilist)
+	{
+		std::lock_guard lock(this->mutex);
+		__insert_bulk(ilist.begin(), ilist.end());
 	}
 
-	template<typename InputIt>
-	__gc_unordered_multimap(InputIt first, InputIt last)
+public: // -- swap -- //
+
+	void swap(__gc_btree_set &other) { this->__swap(other); }
+	friend void swap(__gc_btree_set &a, __gc_btree_set &b) { a.swap(b); }
+
+public: // -- cmp -- //
+
+	friend bool operator==(const __gc_btree_set &a, const __gc_btree_set &b) { return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin()); }
+	friend bool operator!=(const __gc_btree_set &a, const __gc_btree_set &b) { return !(a == b); }
+};
+template<typename Key, typename Compare, typename Lockable>
+struct GC::router<__gc_btree_set<Key, Compare, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<Key>::value;
+
+	template<typename F>
+	static void route(const __gc_btree_set<Key, Compare, Lockable> &set, F func)
 	{
-		new (buffer) wrapped_t(first, last);
+		GC::router_lock_t<Lockable> lock(set.mutex);
+		set.__route(func);
 	}
-	template<typename InputIt>
-	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+};
+
+template<typename T, typename Lockable>
+class __gc_ring_buffer
+{
+	static_assert(std::is_default_constructible<T>::value, "ring_buffer element type must be default constructible");
+
+public: // -- typedefs -- //
+
+	typedef T value_type;
+
+	typedef std::size_t size_type;
+
+	typedef T &reference;
+	typedef const T &const_reference;
+
+	// true iff the buffer is synchronized (i.e. Lockable is not GC::null_lockable).
+	// an unsynchronized buffer must only be used by one thread, and then only the collector may access it concurrently.
+	// this is only safe if assigning a T is safe to do while it's being routed (e.g. GC::ptr, GC::atomic_ptr, or non-gc types).
+	static constexpr bool synchronized = !std::is_same<Lockable, GC::null_lockable>::value;
+
+private: // -- data -- //
+
+	std::unique_ptr<T[]> slots; // the slots - all of them are constructed for the buffer's entire lifetime
+	size_type cap;              // the number of slots
+	size_type first;            // the index of the oldest element
+	size_type count;            // the number of (live) elements
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_ring_buffer>;
+
+private: // -- helpers -- //
+
+	// gets the slot holding the i-th oldest element
+	T &slot(size_type i) noexcept { size_type j = first + i; return slots[j < cap ? j : j - cap]; }
+	const T &slot(size_type i) const noexcept { size_type j = first + i; return slots[j < cap ? j : j - cap]; }
+
+	// empties a slot that is leaving the live range.
+	// a synchronized router only routes live slots, so the slot's handles must be destroyed rather than repointed.
+	// this way the disjunction keeps their old targets alive for an in-progress collection (see schedule_handle_destroy).
+	// an unsynchronized router routes every slot (it can't know the live range), so a plain reset suffices there.
+	void __vacate(T &s) noexcept
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, equal, alloc);
+		if constexpr (synchronized)
+		{
+			s.~T();
+			::new (std::addressof(s)) T();
+		}
+		else s = T();
 	}
 
-	template<typename InputIt>
-	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Allocator &alloc)
+	template<typename U>
+	void __push_back(U &&value)
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, alloc);
+		if (cap == 0) return;
+
+		if (count < cap)
+		{
+			slot(count) = std::forward<U>(value);
+			++count;
+		}
+		else
+		{
+			// overwrite the oldest element in place - it stays live (as the newest element), so this is just an assignment
+			slot(0) = std::forward<U>(value);
+			if (++first == cap) first = 0;
+		}
 	}
 
-	template<typename InputIt>
-	__gc_unordered_multimap(InputIt first, InputIt last, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	void __clear() noexcept
 	{
-		new (buffer) wrapped_t(first, last, bucket_count, hash, alloc);
+		for (; count > 0; --count) __vacate(slot(count - 1));
+		first = 0;
 	}
 
-	__gc_unordered_multimap(const __gc_unordered_multimap &other)
+public: // -- ctor / dtor -- //
+
+	// creates an empty buffer that holds up to capacity elements - all the storage is allocated (and constructed) up front.
+	// throws std::invalid_argument if capacity is zero.
+	explicit __gc_ring_buffer(size_type capacity) : slots(capacity > 0 ? new T[capacity]() : throw std::invalid_argument("ring_buffer capacity must be nonzero")), cap(capacity), first(0), count(0) {}
+
+	__gc_ring_buffer(const __gc_ring_buffer &other) : slots(other.cap > 0 ? new T[other.cap]() : nullptr), cap(other.cap), first(0), count(0)
 	{
-		new (buffer) wrapped_t(other.wrapped());
+		GC::router_lock_t<Lockable> lock(other.mutex);
+		for (size_type i = 0; i < other.count; ++i) __push_back(other.slot(i));
 	}
-	__gc_unordered_multimap(const wrapped_t &other)
+	// a moved-from buffer has zero capacity (pushing to it does nothing)
+	__gc_ring_buffer(__gc_ring_buffer &&other) : cap(0), first(0), count(0)
 	{
-		new (buffer) wrapped_t(other);
+		std::lock_guard lock(other.mutex);
+		slots.swap(other.slots);
+		std::swap(cap, other.cap);
+		std::swap(first, other.first);
+		std::swap(count, other.count);
 	}
 
-	__gc_unordered_multimap(const __gc_unordered_multimap &other, const Allocator &alloc)
+public: // -- asgn -- //
+
+	// these replace the slots wholesale, so an unsynchronized buffer must not be assigned while it could be routed
+
+	__gc_ring_buffer &operator=(const __gc_ring_buffer &other)
 	{
-		new (buffer) wrapped_t(other.wrapped(), alloc);
+		if (this != &other)
+		{
+			__gc_ring_buffer cpy(other);
+			swap(cpy);
+		}
+		return *this;
 	}
-	__gc_unordered_multimap(const wrapped_t &other, const Allocator &alloc)
+	__gc_ring_buffer &operator=(__gc_ring_buffer &&other)
 	{
-		new (buffer) wrapped_t(other, alloc);
+		if (this != &other)
+		{
+			__gc_ring_buffer tmp(std::move(other));
+			swap(tmp);
+		}
+		return *this;
 	}
 
-	__gc_unordered_multimap(__gc_unordered_multimap &&other)
+public: // -- transactional access -- //
+
+	// invokes f with a reference to this buffer under a single lock and returns whatever f returns.
+	// this makes compound operations (e.g. check full then pop) atomic with respect to other mutators and the router.
+	// f's calls on the buffer lock it again, so this requires a recursive lockable (as the default lockable is).
+	template<typename F>
+	decltype(auto) with_lock(F &&f)
 	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		std::lock_guard lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
-	__gc_unordered_multimap(wrapped_t &&other)
+	template<typename F>
+	decltype(auto) with_lock(F &&f) const
 	{
-		new (buffer) wrapped_t(std::move(other));
+		GC::router_lock_t<Lockable> lock(this->mutex);
+		return std::forward<F>(f)(*this);
 	}
 
-	__gc_unordered_multimap(__gc_unordered_multimap &&other, const Allocator &alloc)
+public: // -- obj access -- //
+
+	// gets the i-th oldest element (0 is the oldest)
+	T &operator[](size_type i) { return slot(i); }
+	const T &operator[](size_type i) const { return slot(i); }
+
+	T &at(size_type i) { if (i >= count) throw std::out_of_range("ring_buffer index out of range"); return slot(i); }
+	const T &at(size_type i) const { if (i >= count) throw std::out_of_range("ring_buffer index out of range"); return slot(i); }
+
+	T &front() { return slot(0); }
+	const T &front() const { return slot(0); }
+
+	T &back() { return slot(count - 1); }
+	const T &back() const { return slot(count - 1); }
+
+public: // -- size / cap -- //
+
+	size_type size() const noexcept { return count; }
+	size_type capacity() const noexcept { return cap; }
+
+	bool empty() const noexcept { return count == 0; }
+	bool full() const noexcept { return count == cap; }
+
+public: // -- push / pop -- //
+
+	// appends value as the newest element - if the buffer is full, the oldest element is overwritten (assigned) in place.
+	// this never allocates (aside from whatever assigning a T does).
+	void push_back(const T &value)
 	{
-		std::lock_guard lock(other.mutex);
-		new (buffer) wrapped_t(std::move(other.wrapped()), alloc);
+		std::lock_guard lock(this->mutex);
+		__push_back(value);
 	}
-	__gc_unordered_multimap(wrapped_t &&other, const Allocator &alloc)
+	void push_back(T &&value)
 	{
-		new (buffer) wrapped_t(std::move(other), alloc);
+		std::lock_guard lock(this->mutex);
+		__push_back(std::move(value));
 	}
 
-	__gc_unordered_multimap(std::initializer_list<value_type> init)
+	// removes and returns the oldest element - the buffer must not be empty
+	T pop_front()
 	{
-		new (buffer) wrapped_t(init);
+		std::lock_guard lock(this->mutex);
+		T &s = slot(0);
+		T res = std::move(s);
+		__vacate(s);
+		if (++first == cap) first = 0;
+		--count;
+		return res;
 	}
-	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash = Hash(), const key_equal &equal = key_equal(), const Allocator &alloc = Allocator())
+
+	// removes all the elements (the slots are kept)
+	void clear()
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, equal, alloc);
+		std::lock_guard lock(this->mutex);
+		__clear();
 	}
 
-	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Allocator &alloc)
+public: // -- swap -- //
+
+	void swap(__gc_ring_buffer &other)
 	{
-		new (buffer) wrapped_t(init, bucket_count, alloc);
+		if (this == &other) return;
+
+		std::scoped_lock locks(this->mutex, other.mutex);
+		slots.swap(other.slots);
+		std::swap(cap, other.cap);
+		std::swap(first, other.first);
+		std::swap(count, other.count);
 	}
-	__gc_unordered_multimap(std::initializer_list<value_type> init, size_type bucket_count, const Hash &hash, const Allocator &alloc)
+	friend void swap(__gc_ring_buffer &a, __gc_ring_buffer &b) { a.swap(b); }
+};
+template<typename T, typename Lockable>
+struct GC::router<__gc_ring_buffer<T, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	template<typename F>
+	static void route(const __gc_ring_buffer<T, Lockable> &buf, F func)
 	{
-		new (buffer) wrapped_t(init, bucket_count, hash, alloc);
+		if constexpr (__gc_ring_buffer<T, Lockable>::synchronized)
+		{
+			// the live elements are (at most) two contiguous runs of slots
+			GC::router_lock_t<Lockable> lock(buf.mutex);
+			const T *slots = buf.slots.get();
+			std::size_t end = buf.first + buf.count;
+			GC::route_range(slots + buf.first, slots + std::min(end, buf.cap), func);
+			if (end > buf.cap) GC::route_range(slots, slots + (end - buf.cap), func);
+		}
+		// without a lock the live range could be changing under us, so route every slot (they're always constructed)
+		else GC::route_range(buf.slots.get(), buf.slots.get() + buf.cap, func);
+	}
+};
+
+template<typename V, typename Lockable>
+class __gc_csr_graph
+{
+public: // -- typedefs -- //
+
+	typedef V vertex_type;
+
+	typedef std::size_t size_type;
+
+	// an edge (source vertex index, target vertex index) for bulk construction
+	typedef std::pair<size_type, size_type> edge_type;
+
+	// the (contiguous) target vertex indices of a vertex's outgoing edges
+	class neighbor_range
+	{
+	private: // -- data -- //
+
+		const size_type *first, *last;
+
+		friend class __gc_csr_graph;
+
+		neighbor_range(const size_type *_first, const size_type *_last) noexcept : first(_first), last(_last) {}
+
+	public: // -- interface -- //
+
+		const size_type *begin() const noexcept { return first; }
+		const size_type *end() const noexcept { return last; }
+
+		size_type size() const noexcept { return (size_type)(last - first); }
+		bool empty() const noexcept { return first == last; }
+
+		size_type operator[](size_type i) const noexcept { return first[i]; }
+	};
+
+private: // -- data -- //
+
+	std::vector<V> _vertices;       // the vertex payloads
+	std::vector<size_type> offsets; // the edges of vertex i are targets[offsets[i], offsets[i + 1]) - empty iff there are no vertices
+	std::vector<size_type> targets; // the edge target vertex indices, grouped by source vertex
+
+	mutable Lockable mutex; // router synchronizer
+
+	friend struct GC::router<__gc_csr_graph>;
+
+private: // -- helpers -- //
+
+	// builds the edge arrays for vertex_count vertices from the edges in [begin, end) (counting sort by source, stable).
+	// throws std::out_of_range if an edge refers to a vertex that doesn't exist.
+	template<typename EdgeIt>
+	static void __build_edges(size_type vertex_count, EdgeIt begin, EdgeIt end, std::vector<size_type> &offsets, std::vector<size_type> &targets)
+	{
+		offsets.assign(vertex_count > 0 ? vertex_count + 1 : 0, 0);
+		targets.clear();
+
+		std::vector<edge_type> edges(begin, end);
+		for (const edge_type &e : edges)
+		{
+			if (e.first >= vertex_count || e.second >= vertex_count) throw std::out_of_range("csr_graph edge refers to a nonexistent vertex");
+			++offsets[e.first + 1];
+		}
+		for (size_type i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+
+		targets.resize(edges.size());
+		std::vector<size_type> pos(offsets.begin(), offsets.end() - (offsets.empty() ? 0 : 1));
+		for (const edge_type &e : edges) targets[pos[e.first]++] = e.second;
 	}
 
-	~__gc_unordered_multimap()
+public: // -- ctor / dtor -- //
+
+	// creates an empty graph
+	__gc_csr_graph() = default;
+
+	// creates a graph with the given vertex payloads and the edges in [begin, end) (source/target vertex index pairs).
+	// throws std::out_of_range if an edge refers to a vertex that doesn't exist.
+	template<typename EdgeIt>
+	__gc_csr_graph(std::vector<V> vertices, EdgeIt begin, EdgeIt end) : _vertices(std::move(vertices))
 	{
-		wrapped().~wrapped_t();
+		__build_edges(_vertices.size(), begin, end, offsets, targets);
 	}
+	__gc_csr_graph(std::vector<V> vertices, std::initializer_list<edge_type> edges) : __gc_csr_graph(std::move(vertices), edges.begin(), edges.end()) {}
 
-public: // -- assign -- //
-
-	__gc_unordered_multimap &operator=(const __gc_unordered_multimap &other)
+	__gc_csr_graph(const __gc_csr_graph &other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
+		GC::router_lock_t<Lockable> lock(other.mutex);
+		_vertices = other._vertices;
+		offsets = other.offsets;
+		targets = other.targets;
 	}
-	__gc_unordered_multimap &operator=(const wrapped_t &other)
+	__gc_csr_graph(__gc_csr_graph &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
+		std::lock_guard lock(other.mutex);
+		_vertices.swap(other._vertices);
+		offsets.swap(other.offsets);
+		targets.swap(other.targets);
 	}
 
-	__gc_unordered_multimap &operator=(__gc_unordered_multimap &&other)
+public: // -- asgn -- //
+
+	__gc_csr_graph &operator=(const __gc_csr_graph &other)
 	{
 		if (this != &other)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			__gc_csr_graph cpy(other);
+			swap(cpy);
 		}
 		return *this;
 	}
-	__gc_unordered_multimap &operator=(wrapped_t &&other)
+	__gc_csr_graph &operator=(__gc_csr_graph &&other)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
+		if (this != &other)
+		{
+			__gc_csr_graph tmp(std::move(other));
+			swap(tmp);
+		}
 		return *this;
 	}
 
-	__gc_unordered_multimap &operator=(std::initializer_list<value_type> ilist)
+public: // -- bulk rebuild -- //
+
+	// replaces the entire graph with the given vertex payloads and the edges in [begin, end).
+	// the new arrays are built before locking, so the router (and other mutators) are only blocked for the final swap.
+	// throws std::out_of_range if an edge refers to a vertex that doesn't exist (in which case the graph is not modified).
+	template<typename EdgeIt>
+	void rebuild(std::vector<V> vertices, EdgeIt begin, EdgeIt end)
+	{
+		__gc_csr_graph tmp(std::move(vertices), begin, end);
+		swap(tmp);
+	}
+	void rebuild(std::vector<V> vertices, std::initializer_list<edge_type> edges) { rebuild(std::move(vertices), edges.begin(), edges.end()); }
+
+	// replaces all the edges (keeping the vertices) with those in [begin, end).
+	// throws std::out_of_range if an edge refers to a vertex that doesn't exist (in which case the graph is not modified).
+	template<typename EdgeIt>
+	void rebuild_edges(EdgeIt begin, EdgeIt end)
 	{
+		std::vector<size_type> new_offsets, new_targets;
+		__build_edges(vertex_count(), begin, end, new_offsets, new_targets);
+
+		// edges are never routed, so these don't strictly need the lock, but this keeps rebuilds atomic with respect to other mutators
 		std::lock_guard lock(this->mutex);
-		wrapped() = ilist;
-		return *this;
+		offsets.swap(new_offsets);
+		targets.swap(new_targets);
 	}
+	void rebuild_edges(std::initializer_list<edge_type> edges) { rebuild_edges(edges.begin(), edges.end()); }
 
-public: // -- misc -- //
+	// removes all vertices and edges
+	void clear()
+	{
+		__gc_csr_graph tmp;
+		swap(tmp);
+	}
 
-	allocator_type get_allocator() const { return wrapped().get_allocator(); }
+public: // -- obj access -- //
 
-public: // -- iterators -- //
+	// gets the payload of vertex i
+	V &operator[](size_type i) { return _vertices[i]; }
+	const V &operator[](size_type i) const { return _vertices[i]; }
 
-	iterator begin() noexcept { return wrapped().begin(); }
-	const_iterator begin() const noexcept { return wrapped().begin(); }
-	const_iterator cbegin() const noexcept { return wrapped().cbegin(); }
+	V &vertex(size_type i) { if (i >= _vertices.size()) throw std::out_of_range("csr_graph vertex index out of range"); return _vertices[i]; }
+	const V &vertex(size_type i) const { if (i >= _vertices.size()) throw std::out_of_range("csr_graph vertex index out of range"); return _vertices[i]; }
 
-	iterator end() noexcept { return wrapped().end(); }
-	const_iterator end() const noexcept { return wrapped().end(); }
-	const_iterator cend() const noexcept { return wrapped().cend(); }
+	// gets the vertex payloads (contiguous, in index order)
+	V *data() noexcept { return _vertices.data(); }
+	const V *data() const noexcept { return _vertices.data(); }
 
-public: // -- size / cap -- //
+	// gets the target vertex indices of vertex i's outgoing edges
+	neighbor_range neighbors(size_type i) const noexcept { return { targets.data() + offsets[i], targets.data() + offsets[i + 1] }; }
+	size_type degree(size_type i) const noexcept { return offsets[i + 1] - offsets[i]; }
 
-	bool empty() const noexcept { return wrapped().empty(); }
-	size_type size() const noexcept { return wrapped().size(); }
+public: // -- size -- //
 
-	size_type max_size() const noexcept { return wrapped().max_size(); }
+	size_type vertex_count() const noexcept { return _vertices.size(); }
+	size_type edge_count() const noexcept { return targets.size(); }
 
-	void clear() noexcept
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().clear();
-	}
+	bool empty() const noexcept { return _vertices.empty(); }
 
-public: // -- insert / erase -- //
+public: // -- iteration -- //
 
-	iterator insert(const value_type &value)
+	// calls f(i, vertex(i), neighbors(i)) for each vertex i in [first, last).
+	// this doesn't lock, so disjoint index ranges can be processed by separate threads (e.g. see parallel_for_each_vertex).
+	// the graph must not be rebuilt during iteration.
+	template<typename F>
+	void for_each_vertex(size_type first, size_type last, F &&f)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(value);
+		for (size_type i = first; i < last; ++i) f(i, _vertices[i], neighbors(i));
 	}
-
-	template<typename P>
-	iterator insert(P &&value)
+	template<typename F>
+	void for_each_vertex(size_type first, size_type last, F &&f) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::forward<P>(value));
+		for (size_type i = first; i < last; ++i) f(i, _vertices[i], neighbors(i));
 	}
+	template<typename F>
+	void for_each_vertex(F &&f) { for_each_vertex(0, vertex_count(), std::forward<F>(f)); }
+	template<typename F>
+	void for_each_vertex(F &&f) const { for_each_vertex(0, vertex_count(), std::forward<F>(f)); }
 
-	iterator insert(const_iterator hint, const value_type &value)
+	// as for_each_vertex(), but splits the vertices into contiguous chunks that are processed in parallel (by threads in the calling thread's disjunction).
+	// f is called concurrently (on different vertices) and must be safe to do so. if a call to f throws, the first such exception is rethrown after all threads finish.
+	// the graph must not be rebuilt during iteration.
+	template<typename F>
+	void parallel_for_each_vertex(F &&f, size_type thread_count = GC::thread::hardware_concurrency())
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, value);
-	}
+		size_type n = vertex_count();
+		thread_count = std::max<size_type>(1, std::min(thread_count, n));
 
-	template<typename P>
-	iterator insert(const_iterator hint, P &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::forward<P>(value));
-	}
+		std::exception_ptr error;
+		std::mutex error_mutex;
+		auto run = [&](size_type first, size_type last)
+		{
+			try { for_each_vertex(first, last, f); }
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(error_mutex);
+				if (!error) error = std::current_exception();
+			}
+		};
 
-	template<typename InputIt>
-	void insert(InputIt first, InputIt last)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(first, last);
-	}
+		std::vector<GC::thread> threads;
+		threads.reserve(thread_count - 1);
+		for (size_type t = 1; t < thread_count; ++t) threads.emplace_back(GC::inherit_disjunction, run, n * t / thread_count, n * (t + 1) / thread_count);
+		run(0, n / thread_count);
+		for (auto &t : threads) t.join();
 
-	void insert(std::initializer_list<value_type> ilist)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().insert(ilist);
+		if (error) std::rethrow_exception(error);
 	}
 
-	iterator insert(value_type &&value)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(value));
-	}
-	iterator insert(const_iterator hint, value_type &&value)
+public: // -- swap -- //
+
+	void swap(__gc_csr_graph &other)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(value));
+		if (this == &other) return;
+
+		std::scoped_lock locks(this->mutex, other.mutex);
+		_vertices.swap(other._vertices);
+		offsets.swap(other.offsets);
+		targets.swap(other.targets);
 	}
+	friend void swap(__gc_csr_graph &a, __gc_csr_graph &b) { a.swap(b); }
+};
+template<typename V, typename Lockable>
+struct GC::router<__gc_csr_graph<V, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::has_trivial_router<V>::value;
 
-	iterator insert(node_type &&nh)
+	template<typename F>
+	static void route(const __gc_csr_graph<V, Lockable> &graph, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(std::move(nh));
+		// the edges are plain indices, so only the (contiguous) vertex payloads need routing
+		GC::router_lock_t<Lockable> lock(graph.mutex);
+		GC::route_range(graph._vertices.begin(), graph._vertices.end(), func);
 	}
-	iterator insert(const_iterator hint, node_type &&nh)
+};
+
+// --------------------------- //
+
+// -- frozen container impl -- //
+
+// --------------------------- //
+
+template<typename T>
+struct __gc_frozen_block
+{
+	const T value;
+
+	template<typename ...Args>
+	explicit __gc_frozen_block(Args &&...args) : value(std::forward<Args>(args)...) {}
+};
+template<typename T>
+struct GC::router<__gc_frozen_block<T>>
+{
+	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+
+	// the contents are never modified after construction, so they need no lock.
+	// they're unrooted by GC::make at construction and never gain new arcs, so there's nothing to do for mutable routing.
+	static void route(const __gc_frozen_block<T> &block, GC::router_fn func) { GC::route(block.value, func); }
+	static void route(const __gc_frozen_block<T> &block, GC::mutable_router_fn) {}
+};
+
+template<typename T>
+class __gc_frozen
+{
+private: // -- data -- //
+
+	GC::ptr<__gc_frozen_block<T>> block; // the (immutable) contents
+
+	friend struct GC::router<__gc_frozen>;
+
+public: // -- typedefs -- //
+
+	typedef T value_type;
+
+public: // -- ctor / dtor / asgn -- //
+
+	// creates a frozen T constructed from args (e.g. a frozen empty container if there are no args)
+	template<typename ...Args>
+	explicit __gc_frozen(std::in_place_t, Args &&...args) : block(GC::make<__gc_frozen_block<T>>(std::forward<Args>(args)...)) {}
+
+	__gc_frozen() : __gc_frozen(std::in_place) {}
+
+	// freezes value - the value is moved (or copied) into immutable storage
+	explicit __gc_frozen(const T &value) : __gc_frozen(std::in_place, value) {}
+	explicit __gc_frozen(T &&value) : __gc_frozen(std::in_place, std::move(value)) {}
+
+	// copies share the same (immutable) contents
+	__gc_frozen(const __gc_frozen&) = default;
+	__gc_frozen &operator=(const __gc_frozen&) = default;
+
+	// moving is equivalent to copying - a frozen object is never empty
+	__gc_frozen(__gc_frozen &&other) : block(other.block) {}
+	__gc_frozen &operator=(__gc_frozen &&other) { block = other.block; return *this; }
+
+public: // -- obj access -- //
+
+	// gets the frozen value - no lock is needed to read it (from any thread)
+	const T &get() const noexcept
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().insert(hint, std::move(nh));
+		auto &b = *block;
+		return b.value;
 	}
 
+	const T &operator*() const noexcept { return get(); }
+	const T *operator->() const noexcept { return &get(); }
+
+	operator const T&() const noexcept { return get(); }
+
+public: // -- cmp -- //
+
+	// checks if a and b share the same contents (cheaper than comparing the values)
+	friend bool same_contents(const __gc_frozen &a, const __gc_frozen &b) { return a.block == b.block; }
+
+	friend bool operator==(const __gc_frozen &a, const __gc_frozen &b) { return a.block == b.block || a.get() == b.get(); }
+	friend bool operator!=(const __gc_frozen &a, const __gc_frozen &b) { return !(a == b); }
+};
+template<typename T>
+struct GC::router<__gc_frozen<T>>
+{
+	// the block pointer itself is an ordinary arc (e.g. frozen objects in a mutable container are unrooted as usual)
+	template<typename F>
+	static void route(const __gc_frozen<T> &frozen, F func) { GC::route(frozen.block, func); }
+};
+
+// ------------------- //
+
+// -- callable impl -- //
+
+// ------------------- //
+
+template<typename Fn, typename ...Captures>
+class __gc_closure
+{
+private: // -- data -- //
+
+	Fn fn;                            // the function to call
+	std::tuple<Captures...> captures; // the (routed) captured values
+
+	friend struct GC::router<__gc_closure>;
+
+public: // -- ctor / dtor / asgn -- //
+
+	template<typename _Fn, typename ...Args>
+	explicit __gc_closure(std::in_place_t, _Fn &&_fn, Args &&...args) : fn(std::forward<_Fn>(_fn)), captures(std::forward<Args>(args)...) {}
+
+public: // -- invocation -- //
+
+	// calls fn(captures..., args...) - the captures are passed as lvalues (and can thus be modified, e.g. repointed)
 	template<typename ...Args>
-	iterator emplace(Args &&...args)
+	decltype(auto) operator()(Args &&...args)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		return std::apply([&](auto &...c) -> decltype(auto) { return std::invoke(fn, c..., std::forward<Args>(args)...); }, captures);
 	}
 	template<typename ...Args>
-	iterator emplace_hint(const_iterator hint, Args &&...args)
+	decltype(auto) operator()(Args &&...args) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace_hint(hint, std::forward<Args>(args)...);
+		return std::apply([&](auto &...c) -> decltype(auto) { return std::invoke(fn, c..., std::forward<Args>(args)...); }, captures);
 	}
+};
+template<typename Fn, typename ...Captures>
+struct GC::router<__gc_closure<Fn, Captures...>>
+{
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Fn, Captures...>::value;
 
-	iterator erase(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(pos);
-	}
-	iterator erase(const_iterator first, const_iterator last)
+	template<typename F>
+	static void route(const __gc_closure<Fn, Captures...> &closure, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(first, last);
+		GC::route(closure.fn, func);
+		GC::route(closure.captures, func);
 	}
+};
 
-	size_type erase(const key_type &k)
+template<typename R, typename ...Args, typename Lockable>
+class __gc_function<R(Args...), Lockable>
+{
+public: // -- typedefs -- //
+
+	typedef R result_type;
+
+	// the size of the inline buffer - callables that fit are stored inline rather than on the heap.
+	// this is enough for e.g. a closure over two gc pointers.
+	// moving an inline callable moves (i.e. for gc pointers, copies) it, so moves can throw GC::disjunction_error if used outside the callable's disjunction.
+	static constexpr std::size_t inline_size = 2 * sizeof(GC::ptr<void>) + sizeof(void*);
+
+private: // -- ops -- //
+
+	// the type-erased operations for a stored callable
+	struct ops_t
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().erase(k);
-	}
+		R(*invoke)(void *obj, Args &&...args);
 
-public: // -- swap -- //
+		void *(*clone)(const void *obj, void *buffer);    // copies obj into buffer (if inline) or the heap and returns the copy
+		void *(*relocate)(void *obj, void *buffer);       // moves obj into buffer (if inline) or returns it as-is (if heap) - obj is consumed
+		void (*destroy)(void *obj);                       // destroys (and deallocates if heap) obj
 
-	void swap(__gc_unordered_multimap &other)
+		void (*route)(const void *obj, GC::router_fn func);
+		void (*mutable_route)(const void *obj, GC::mutable_router_fn func);
+	};
+
+	template<typename F>
+	struct ops_for
 	{
-		if (this != &other)
+		static constexpr bool is_inline = sizeof(F) <= inline_size && alignof(F) <= alignof(std::max_align_t);
+
+		static R invoke(void *obj, Args &&...args)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			if constexpr (std::is_void<R>::value) std::invoke(*static_cast<F*>(obj), std::forward<Args>(args)...);
+			else return std::invoke(*static_cast<F*>(obj), std::forward<Args>(args)...);
 		}
-	}
-	void swap(wrapped_t &other)
-	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
-	}
 
-	friend void swap(__gc_unordered_multimap &a, __gc_unordered_multimap &b) { a.swap(b); }
-	friend void swap(__gc_unordered_multimap &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_unordered_multimap &b) { b.swap(a); }
+		static void *clone(const void *obj, void *buffer)
+		{
+			if constexpr (is_inline) return ::new (buffer) F(*static_cast<const F*>(obj));
+			else return new F(*static_cast<const F*>(obj));
+		}
+		static void *relocate(void *obj, void *buffer)
+		{
+			if constexpr (is_inline)
+			{
+				F *f = static_cast<F*>(obj);
+				void *res = ::new (buffer) F(std::move(*f));
+				f->~F();
+				return res;
+			}
+			else return obj;
+		}
+		static void destroy(void *obj)
+		{
+			if constexpr (is_inline) static_cast<F*>(obj)->~F();
+			else delete static_cast<F*>(obj);
+		}
 
-public: // -- extract -- //
+		static void route(const void *obj, GC::router_fn func) { GC::route(*static_cast<const F*>(obj), func); }
+		static void mutable_route(const void *obj, GC::mutable_router_fn func) { GC::route(*static_cast<const F*>(obj), func); }
 
-	node_type extract(const_iterator pos)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(pos);
-	}
-	node_type extract(const key_type &key)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().extract(key);
-	}
+		static constexpr ops_t value = { invoke, clone, relocate, destroy, route, mutable_route };
+	};
 
-	// !! ADD MERGE FUNCTIONS (C++17)
+private: // -- data -- //
 
-public: // -- lookup -- //
+	alignas(std::max_align_t) unsigned char buffer[inline_size]; // inline storage for small callables
 
-	size_type count(const Key &key) const { return wrapped().count(key); }
-	template<typename K>
-	size_type count(const K &key) const { return wrapped().count(key); }
+	const ops_t *ops; // the operations for the stored callable (null if empty)
+	void *obj;        // the stored callable - either in buffer or on the heap (null if empty)
 
-	iterator find(const Key &key) { return wrapped().find(key); }
-	const_iterator find(const Key &key) const { return wrapped().find(key); }
+	mutable Lockable mutex; // router synchronizer
 
-	template<typename K>
-	iterator find(const K &key) { return wrapped().find(key); }
-	template<typename K>
-	const_iterator find(const K &key) const { return wrapped().find(key); }
+	friend struct GC::router<__gc_function>;
+
+private: // -- helpers -- //
+
+	// takes other's callable - this must be empty. other is left empty.
+	void __steal(__gc_function &other)
+	{
+		if (other.ops) obj = other.ops->relocate(other.obj, buffer);
+		ops = other.ops;
+		other.ops = nullptr;
+		other.obj = nullptr;
+	}
+
+	void __route(GC::router_fn func) const { if (ops) ops->route(obj, func); }
+	void __route(GC::mutable_router_fn func) const { if (ops) ops->mutable_route(obj, func); }
 
-	bool contains(const Key &key) const { return wrapped().contains(key); }
-	template<typename K>
-	bool contains(const K &key) const { return wrapped().contains(key); }
+public: // -- ctor / dtor -- //
 
-	std::pair<iterator, iterator> equal_range(const Key &key) { return wrapped().equal_range(key); }
-	std::pair<const_iterator, const_iterator> equal_range(const Key &key) const { return wrapped().equal_range(key); }
+	// creates an empty function
+	__gc_function() noexcept : ops(nullptr), obj(nullptr) {}
+	__gc_function(std::nullptr_t) noexcept : __gc_function() {}
 
-	template<typename K>
-	std::pair<iterator, iterator> equal_range(const K &key) { return wrapped().equal_range(key); }
-	template<typename K>
-	std::pair<const_iterator, const_iterator> equal_range(const K &key) const { return wrapped().equal_range(key); }
+	// creates a function that stores a copy of f (empty if f is a null function pointer)
+	template<typename F, std::enable_if_t<!std::is_same<std::decay_t<F>, __gc_function>::value && std::is_invocable_r<R, std::decay_t<F>&, Args...>::value, int> = 0>
+	__gc_function(F &&f) : __gc_function()
+	{
+		typedef std::decay_t<F> fn_t;
 
-public: // -- bucket interface -- //
+		if constexpr (std::is_pointer<fn_t>::value || std::is_member_pointer<fn_t>::value)
+		{
+			if (!f) return;
+		}
 
-	local_iterator begin(size_type n) { return wrapped().begin(n); }
-	const_local_iterator begin(size_type n) const { return wrapped().begin(n); }
-	const_local_iterator cbegin(size_type n) const { return wrapped().cbegin(n); }
+		if constexpr (ops_for<fn_t>::is_inline) obj = ::new (buffer) fn_t(std::forward<F>(f));
+		else obj = new fn_t(std::forward<F>(f));
+		ops = &ops_for<fn_t>::value;
+	}
 
-	local_iterator end(size_type n) { return wrapped().end(n); }
-	const_local_iterator end(size_type n) const { return wrapped().end(n); }
-	const_local_iterator cend(size_type n) const { return wrapped().cend(n); }
+	__gc_function(const __gc_function &other) : __gc_function()
+	{
+		std::lock_guard lock(other.mutex);
+		if (other.ops)
+		{
+			obj = other.ops->clone(other.obj, buffer);
+			ops = other.ops;
+		}
+	}
+	__gc_function(__gc_function &&other) : __gc_function()
+	{
+		std::lock_guard lock(other.mutex);
+		__steal(other);
+	}
 
-	size_type bucket_count() const { return wrapped().bucket_count(); }
-	size_type max_bucket_count() const { return wrapped().max_bucket_count(); }
+	~__gc_function()
+	{
+		if (ops) ops->destroy(obj);
+	}
 
-	size_type bucket_size(size_type n) const { return wrapped().bucket_size(n); }
-	size_type bucket(const Key &key) const { return wrapped().bucket(key); }
+public: // -- asgn -- //
 
-public: // -- hash policy -- //
+	// each of these swaps the old callable into a temporary, so it's destroyed after the lock is released
 
-	float load_factor() const { return wrapped().load_factor(); }
+	__gc_function &operator=(const __gc_function &other)
+	{
+		if (this != &other) __gc_function(other).swap(*this);
+		return *this;
+	}
+	__gc_function &operator=(__gc_function &&other)
+	{
+		if (this != &other) __gc_function(std::move(other)).swap(*this);
+		return *this;
+	}
 
-	float max_load_factor() const { return wrapped().max_load_factor(); }
-	void max_load_factor(float ml)
+	__gc_function &operator=(std::nullptr_t)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().max_load_factor(ml);
+		__gc_function().swap(*this);
+		return *this;
 	}
 
-	void rehash(size_type count)
+	template<typename F, std::enable_if_t<!std::is_same<std::decay_t<F>, __gc_function>::value && std::is_invocable_r<R, std::decay_t<F>&, Args...>::value, int> = 0>
+	__gc_function &operator=(F &&f)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().rehash(count);
+		__gc_function(std::forward<F>(f)).swap(*this);
+		return *this;
 	}
 
-	void reserve(size_type count)
+public: // -- invocation -- //
+
+	// calls the stored callable - throws std::bad_function_call if empty.
+	// this does not lock (like std::function, calling concurrently with reassignment is a data race).
+	R operator()(Args ...args) const
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reserve(count);
+		if (!ops) throw std::bad_function_call();
+		return ops->invoke(obj, std::forward<Args>(args)...);
 	}
 
-public: // -- observers -- //
+	explicit operator bool() const noexcept { return ops != nullptr; }
 
-	hasher hash_function() const { return wrapped().hash_function(); }
-	key_equal key_eq() const { return wrapped().key_eq(); }
+	friend bool operator==(const __gc_function &f, std::nullptr_t) noexcept { return !f; }
+	friend bool operator==(std::nullptr_t, const __gc_function &f) noexcept { return !f; }
+	friend bool operator!=(const __gc_function &f, std::nullptr_t) noexcept { return (bool)f; }
+	friend bool operator!=(std::nullptr_t, const __gc_function &f) noexcept { return (bool)f; }
 
-public: // -- cmp -- //
+public: // -- swap -- //
 
-	friend bool operator==(const __gc_unordered_multimap &a, const __gc_unordered_multimap &b) { return a.wrapped() == b.wrapped(); }
-	friend bool operator!=(const __gc_unordered_multimap &a, const __gc_unordered_multimap &b) { return a.wrapped() != b.wrapped(); }
+	void swap(__gc_function &other)
+	{
+		if (this == &other) return;
+
+		std::scoped_lock locks(this->mutex, other.mutex);
+		__gc_function tmp;
+		tmp.__steal(*this);
+		this->__steal(other);
+		other.__steal(tmp);
+	}
+	friend void swap(__gc_function &a, __gc_function &b) { a.swap(b); }
 };
-template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
-struct GC::router<__gc_unordered_multimap<Key, T, Hash, KeyEqual, Allocator, Lockable>>
+template<typename R, typename ...Args, typename Lockable>
+struct GC::router<__gc_function<R(Args...), Lockable>>
 {
-	// a container's router is trivial if its contents are trivial
-	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
-
 	template<typename F>
-	static void route(const __gc_unordered_multimap<Key, T, Hash, KeyEqual, Allocator, Lockable> &map, F func)
+	static void route(const __gc_function<R(Args...), Lockable> &fn, F func)
 	{
-		std::lock_guard lock(map.mutex);
-		GC::route(map.wrapped(), func);
+		GC::router_lock_t<Lockable> lock(fn.mutex);
+		fn.__route(func);
 	}
 };
 
-// -------------------------------------------------------------------------
-
-// checks if T is a valid type for value forwarding ctor/asgn for __gc_variant type objects.
-// the type checked should already be passed through std::decay.
-template<typename T>
-struct __gc_variant_valid_forward_type : std::true_type {};
+// ------------------------------- //
 
-template<typename Lockable, typename ...Types>
-struct __gc_variant_valid_forward_type<__gc_variant<Lockable, Types...>> : std::false_type {};
-template<typename ...Types>
-struct __gc_variant_valid_forward_type<std::variant<Types...>> : std::false_type {};
+// -- concurrent container impl -- //
 
-template<typename T>
-struct __gc_variant_valid_forward_type<std::in_place_type_t<T>> : std::false_type {};
-template<std::size_t I>
-struct __gc_variant_valid_forward_type<std::in_place_index_t<I>> : std::false_type {};
+// ------------------------------- //
 
-template<typename Lockable, typename ...Types>
-class __gc_variant
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+class __gc_concurrent_unordered_map
 {
-private: // -- data -- //
+public: // -- typedefs -- //
 
-	typedef std::variant<Types...> wrapped_t; // the wrapped type
+	// the type of map used for each segment
+	typedef std::unordered_map<Key, T, Hash, KeyEqual, Allocator> segment_map_t;
 
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+	typedef typename segment_map_t::key_type key_type;
+	typedef typename segment_map_t::mapped_type mapped_type;
 
-	mutable Lockable mutex; // router synchronizer
+	typedef typename segment_map_t::value_type value_type;
 
-	friend struct GC::router<__gc_variant>;
-	
-	friend struct std::hash<__gc_variant>;
+	typedef typename segment_map_t::size_type size_type;
 
-private: // -- data accessors -- //
+	typedef typename segment_map_t::hasher hasher;
+	typedef typename segment_map_t::key_equal key_equal;
 
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+	typedef typename segment_map_t::allocator_type allocator_type;
 
-public: // -- wrapped obj access -- //
+private: // -- data -- //
 
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
+	// an independently-locked portion of the map
+	struct segment
+	{
+		mutable Lockable mutex; // synchronizes all access to map (including the router)
+		segment_map_t map;
+	};
 
-public: // -- ctor / dtor -- //
-	
-	constexpr __gc_variant()
+	std::unique_ptr<segment[]> segments;
+	size_type segment_count;
+
+	hasher hash; // used for selecting segments
+
+	friend struct GC::router<__gc_concurrent_unordered_map>;
+
+private: // -- helpers -- //
+
+	// gets the segment responsible for the specified key
+	segment &segment_for(const key_type &key) const
 	{
-		new (buffer) wrapped_t();
+		// mix in the high bits so that the segment choice doesn't just mirror the low bits used by the segment's own buckets
+		std::size_t h = hash(key);
+		h ^= h >> (sizeof(std::size_t) * CHAR_BIT / 2);
+
+		return segments[h % segment_count];
 	}
 
-	constexpr __gc_variant(const __gc_variant &other)
+public: // -- ctor / dtor / asgn -- //
+
+	// creates an empty map with the specified number of segments (must be non-zero).
+	// more segments allows more operations to run in parallel at the expense of some memory.
+	explicit __gc_concurrent_unordered_map(size_type _segment_count = 16, const hasher &_hash = hasher(), const key_equal &equal = key_equal(), const allocator_type &alloc = allocator_type())
+		: segments(new segment[_segment_count]), segment_count(_segment_count), hash(_hash)
 	{
-		new (buffer) wrapped_t(other.wrapped());
+		assert(segment_count != 0);
+
+		for (size_type i = 0; i < segment_count; ++i) segments[i].map = segment_map_t(0, _hash, equal, alloc);
 	}
-	constexpr __gc_variant(const wrapped_t &other)
+
+	__gc_concurrent_unordered_map(const __gc_concurrent_unordered_map&) = delete;
+	__gc_concurrent_unordered_map &operator=(const __gc_concurrent_unordered_map&) = delete;
+
+public: // -- lookup -- //
+
+	// returns a copy of the value associated with key (or empty if there is no such value)
+	std::optional<mapped_type> get(const key_type &key) const
 	{
-		new (buffer) wrapped_t(other);
+		segment &seg = segment_for(key);
+		GC::router_lock_t<Lockable> lock(seg.mutex);
+
+		auto it = seg.map.find(key);
+		if (it == seg.map.end()) return std::nullopt;
+		return it->second;
 	}
 
-	constexpr __gc_variant(__gc_variant &&other)
+	// returns true iff there is a value associated with key
+	bool contains(const key_type &key) const
 	{
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		segment &seg = segment_for(key);
+		GC::router_lock_t<Lockable> lock(seg.mutex);
+
+		return seg.map.find(key) != seg.map.end();
 	}
-	constexpr __gc_variant(wrapped_t &&other)
+
+	// invokes f with a reference to the value associated with key under its segment's lock.
+	// returns true iff there was such a value (i.e. if f was invoked).
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	bool visit(const key_type &key, F &&f)
 	{
-		new (buffer) wrapped_t(std::move(other));
-	}
+		segment &seg = segment_for(key);
+		std::lock_guard lock(seg.mutex);
 
-	template<typename T, std::enable_if_t<__gc_variant_valid_forward_type<std::decay_t<T>>::value, int> = 0>
-	constexpr __gc_variant(T &&t)
+		auto it = seg.map.find(key);
+		if (it == seg.map.end()) return false;
+		std::forward<F>(f)(it->second);
+		return true;
+	}
+	template<typename F>
+	bool visit(const key_type &key, F &&f) const
 	{
-		new (buffer) wrapped_t(std::forward<T>(t));
+		segment &seg = segment_for(key);
+		GC::router_lock_t<Lockable> lock(seg.mutex);
+
+		auto it = seg.map.find(key);
+		if (it == seg.map.end()) return false;
+		std::forward<F>(f)(std::as_const(it->second));
+		return true;
 	}
 
-	template<typename T, typename ...Args>
-	constexpr explicit __gc_variant(std::in_place_type_t<T>, Args &&...args)
+public: // -- modifiers -- //
+
+	// inserts value if its key is not already present - returns true iff the insertion took place
+	bool insert(const value_type &value)
 	{
-		new (buffer) wrapped_t(std::in_place_type<T>, std::forward<Args>(args)...);
+		segment &seg = segment_for(value.first);
+		std::lock_guard lock(seg.mutex);
+
+		return seg.map.insert(value).second;
 	}
-	template<typename T, typename U, typename ...Args>
-	constexpr explicit __gc_variant(std::in_place_type_t<T>, std::initializer_list<U> il, Args &&...args)
+
+	// constructs a value from args in place if key is not already present - returns true iff the insertion took place
+	template<typename ...Args>
+	bool try_emplace(const key_type &key, Args &&...args)
 	{
-		new (buffer) wrapped_t(std::in_place_type<T>, il, std::forward<Args>(args)...);
+		segment &seg = segment_for(key);
+		std::lock_guard lock(seg.mutex);
+
+		return seg.map.try_emplace(key, std::forward<Args>(args)...).second;
 	}
 
-	template<std::size_t I, typename ...Args>
-	constexpr explicit __gc_variant(std::in_place_index_t<I>, Args &&...args)
+	// inserts value for key, or assigns it if key is already present - returns true iff an insertion took place
+	template<typename M>
+	bool insert_or_assign(const key_type &key, M &&obj)
 	{
-		new (buffer) wrapped_t(std::in_place_index<I>, std::forward<Args>(args)...);
+		segment &seg = segment_for(key);
+		std::lock_guard lock(seg.mutex);
+
+		return seg.map.insert_or_assign(key, std::forward<M>(obj)).second;
 	}
-	template<std::size_t I, typename U, typename ...Args>
-	constexpr explicit __gc_variant(std::in_place_index_t<I>, std::initializer_list<U> il, Args &&...args)
+
+	// removes the value associated with key - returns the number of values removed (0 or 1)
+	size_type erase(const key_type &key)
 	{
-		new (buffer) wrapped_t(std::in_place_index<I>, il, std::forward<Args>(args)...);
+		segment &seg = segment_for(key);
+		std::lock_guard lock(seg.mutex);
+
+		return seg.map.erase(key);
 	}
 
-	~__gc_variant()
+	// removes all values - each segment is cleared atomically, but not the map as a whole
+	void clear()
 	{
-		wrapped().~wrapped_t();
+		for (size_type i = 0; i < segment_count; ++i)
+		{
+			std::lock_guard lock(segments[i].mutex);
+			segments[i].map.clear();
+		}
 	}
 
-public: // -- assign -- //
+public: // -- transactional access -- //
 
-	__gc_variant &operator=(const __gc_variant &other)
+	// invokes f with a reference to the raw segment map responsible for key under a single lock and returns whatever f returns.
+	// this makes compound operations on key (e.g. find then insert) atomic.
+	// f must only access key's entry in the segment map (other keys may be in other segments).
+	// the reference passed to f must not be used after f returns.
+	template<typename F>
+	decltype(auto) with_lock(const key_type &key, F &&f)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
+		segment &seg = segment_for(key);
+		std::lock_guard lock(seg.mutex);
+
+		return std::forward<F>(f)(seg.map);
 	}
-	__gc_variant &operator=(const wrapped_t &other)
+
+	// invokes f with a reference to each value (as value_type&) - each segment is locked while it's being visited.
+	// values inserted/removed concurrently in segments that haven't been visited yet may or may not be visited.
+	template<typename F>
+	void for_each(F f)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
+		for (size_type i = 0; i < segment_count; ++i)
+		{
+			std::lock_guard lock(segments[i].mutex);
+			for (auto &entry : segments[i].map) f(entry);
+		}
 	}
-
-	__gc_variant &operator=(__gc_variant &&other)
+	template<typename F>
+	void for_each(F f) const
 	{
-		if (this != &other)
+		for (size_type i = 0; i < segment_count; ++i)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			GC::router_lock_t<Lockable> lock(segments[i].mutex);
+			for (const auto &entry : segments[i].map) f(entry);
 		}
-		return *this;
 	}
-	__gc_variant &operator=(wrapped_t &&other)
+
+public: // -- size -- //
+
+	// gets the number of values - this is only a snapshot if there are no concurrent mutators
+	size_type size() const
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
+		size_type res = 0;
+		for (size_type i = 0; i < segment_count; ++i)
+		{
+			GC::router_lock_t<Lockable> lock(segments[i].mutex);
+			res += segments[i].map.size();
+		}
+		return res;
 	}
+	bool empty() const { return size() == 0; }
+};
 
-	template<typename T, std::enable_if_t<!std::is_same<std::decay_t<T>, __gc_variant>::value, int> = 0>
-	__gc_variant &operator=(T &&t)
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator, typename Lockable>
+struct GC::router<__gc_concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable>>
+{
+	// a container's router is trivial if its contents are trivial
+	static constexpr bool is_trivial = GC::all_have_trivial_routers<Key, T>::value;
+
+	template<typename F>
+	static void route(const __gc_concurrent_unordered_map<Key, T, Hash, KeyEqual, Allocator, Lockable> &map, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::forward<T>(t);
-		return *this;
+		// only lock one segment at a time - mutators in other segments proceed unimpeded
+		for (std::size_t i = 0; i < map.segment_count; ++i)
+		{
+			GC::router_lock_t<Lockable> lock(map.segments[i].mutex);
+			GC::route(map.segments[i].map, func);
+		}
 	}
+};
 
-public: // -- observers -- //
+// only gc pointers are supported - their handles can be routed while being concurrently swapped (repoints are synchronized by the disjunction)
+template<typename T>
+class __gc_concurrent_queue
+{
+	static_assert(!std::is_same<T, T>::value, "concurrent_queue only supports GC::ptr elements");
+};
 
-	constexpr std::size_t index() const noexcept { return wrapped().index(); }
-	constexpr bool valueless_by_exception() const noexcept { return wrapped().valueless_by_exception(); }
+template<typename T>
+class __gc_concurrent_queue<GC::ptr<T>>
+{
+public: // -- typedefs -- //
 
-public: // -- modifiers -- //
+	typedef GC::ptr<T> value_type;
+	typedef std::size_t size_type;
 
-	template<typename T, typename ...Args>
-	decltype(auto) emplace(Args &&...args)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().template emplace<T>(std::forward<Args>(args)...);
-	}
-	template<typename T, typename U, typename ...Args>
-	decltype(auto) emplace(std::initializer_list<U> il, Args &&...args)
-	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().template emplace<T>(il, std::forward<Args>(args)...);
-	}
+private: // -- data -- //
 
-	template<std::size_t I, typename ...Args>
-	decltype(auto) emplace(Args &&...args)
+	// a slot in the ring buffer.
+	// seq == pos means the slot is free for the producer that claims pos.
+	// seq == pos + 1 means the slot holds the value for the consumer that claims pos.
+	struct cell
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().template emplace<I>(std::forward<Args>(args)...);
-	}
-	template<std::size_t I, typename U, typename ...Args>
-	decltype(auto) emplace(std::initializer_list<U> il, Args &&...args)
+		std::atomic<size_type> seq;
+		value_type value; // constructed once and only ever swapped - null while the slot is free
+	};
+
+	std::unique_ptr<cell[]> buffer;
+	size_type mask; // capacity - 1 (capacity is a power of 2)
+
+	// the producer/consumer positions get their own cache lines so they don't contend with one another
+	alignas(64) std::atomic<size_type> enqueue_pos;
+	alignas(64) std::atomic<size_type> dequeue_pos;
+
+	friend struct GC::router<__gc_concurrent_queue>;
+
+public: // -- ctor / dtor / asgn -- //
+
+	// creates an empty queue that can hold at least capacity values (rounded up to a power of 2)
+	explicit __gc_concurrent_queue(size_type capacity = 1024) : enqueue_pos(0), dequeue_pos(0)
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().template emplace<I>(il, std::forward<Args>(args)...);
+		size_type cap = 2;
+		while (cap < capacity) cap <<= 1;
+
+		buffer.reset(new cell[cap]);
+		mask = cap - 1;
+
+		for (size_type i = 0; i < cap; ++i) buffer[i].seq.store(i, std::memory_order_relaxed);
 	}
 
-	void swap(__gc_variant &other)
+	__gc_concurrent_queue(const __gc_concurrent_queue&) = delete;
+	__gc_concurrent_queue &operator=(const __gc_concurrent_queue&) = delete;
+
+private: // -- helpers -- //
+
+	// claims a slot for producing - returns null if the queue is full
+	cell *claim_enqueue(size_type &pos)
 	{
-		if (this != &other)
+		pos = enqueue_pos.load(std::memory_order_relaxed);
+		while (true)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			cell *c = &buffer[pos & mask];
+			std::intptr_t diff = (std::intptr_t)c->seq.load(std::memory_order_acquire) - (std::intptr_t)pos;
+
+			if (diff == 0) { if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return c; }
+			else if (diff < 0) return nullptr;
+			else pos = enqueue_pos.load(std::memory_order_relaxed);
 		}
 	}
-	void swap(wrapped_t &other)
+	// claims a slot for consuming - returns null if the queue is empty
+	cell *claim_dequeue(size_type &pos)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
-	}
+		pos = dequeue_pos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			cell *c = &buffer[pos & mask];
+			std::intptr_t diff = (std::intptr_t)c->seq.load(std::memory_order_acquire) - (std::intptr_t)(pos + 1);
 
-	friend void swap(__gc_variant &a, __gc_variant &b) { a.swap(b); }
-	friend void swap(__gc_variant &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_variant &b) { b.swap(a); }
+			if (diff == 0) { if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return c; }
+			else if (diff < 0) return nullptr;
+			else pos = dequeue_pos.load(std::memory_order_relaxed);
+		}
+	}
 
-public: // -- helpers -- //
+public: // -- push / pop -- //
 
-	// equivalent to std::get<I> for the wrapped object.
-	// safe to use, but because std::variant doesn't have this i suggest you use GC::get<I> instead for compatibility.
-	template<std::size_t I>
-	constexpr decltype(auto) get() & { return std::get<I>(wrapped()); }
-	template<std::size_t I>
-	constexpr decltype(auto) get() const& { return std::get<I>(wrapped()); }
-	template<std::size_t I>
-	constexpr decltype(auto) get() && { return std::get<I>(std::move(wrapped())); }
+	// attempts to push value onto the queue - returns false if the queue is full.
+	// on success, value is moved into the queue (swapped, so no ref count changes) and left null.
+	bool try_push(value_type &&value)
+	{
+		size_type pos;
+		cell *c = claim_enqueue(pos);
+		if (!c) return false;
 
-	// equivalent to std::get<T> for the wrapped object.
-	// safe to use, but because std::variant doesn't have this i suggest you use GC::get<T> instead for compatibility.
-	template<typename T>
-	constexpr decltype(auto) get() & { return std::get<T>(wrapped()); }
-	template<typename T>
-	constexpr decltype(auto) get() const& { return std::get<T>(wrapped()); }
-	template<typename T>
-	constexpr decltype(auto) get() && { return std::get<T>(std::move(wrapped())); }
+		c->value.swap(value);
+		c->seq.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+	// attempts to push a copy of value onto the queue - returns false if the queue is full
+	bool try_push(const value_type &value)
+	{
+		value_type cpy = value;
+		return try_push(std::move(cpy));
+	}
 
-	// equivalent to std::get_if<I> for the wrapped object (except that this can't be null).
-	// safe to use, but because std::variant doesn't have this i suggest you use GC::get_if<I> instead for compatibility.
-	template<std::size_t I>
-	constexpr decltype(auto) get_if() & { return std::get_if<I>(std::addressof(wrapped())); }
-	template<std::size_t I>
-	constexpr decltype(auto) get_if() const& { return std::get_if<I>(std::addressof(wrapped())); }
+	// attempts to pop a value from the queue into dest - returns false if the queue is empty (in which case dest is not modified).
+	// on success, the value is moved out of the queue (swapped, so no ref count changes) and dest's previous value is released.
+	bool try_pop(value_type &dest)
+	{
+		size_type pos;
+		cell *c = claim_dequeue(pos);
+		if (!c) return false;
 
-	// equivalent to std::get_if<T> for the wrapped object (except that this can't be null).
-	// safe to use, but because std::variant doesn't have this i suggest you use GC::get_if<T> instead for compatibility.
-	template<typename T>
-	constexpr decltype(auto) get_if() & { return std::get_if<T>(std::addressof(wrapped())); }
-	template<typename T>
-	constexpr decltype(auto) get_if() const& { return std::get_if<T>(std::addressof(wrapped())); }
+		dest.swap(c->value);
+		value_type old;
+		old.swap(c->value); // take dest's old value out of the slot before releasing the slot to producers
+		c->seq.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
 
-	// equivalent to std::holds_alternative<T> for the wrapped object
-	template<typename T>
-	constexpr bool holds_alternative() const noexcept { return std::holds_alternative<T>(wrapped()); }
+public: // -- size -- //
 
-public: // -- comparison -- //
+	// gets the maximum number of values the queue can hold
+	size_type capacity() const noexcept { return mask + 1; }
 
-	friend constexpr bool operator==(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() == b.wrapped(); }
-	friend constexpr bool operator!=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() != b.wrapped(); }
-	friend constexpr bool operator<(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() < b.wrapped(); }
-	friend constexpr bool operator<=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() <= b.wrapped(); }
-	friend constexpr bool operator>(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() > b.wrapped(); }
-	friend constexpr bool operator>=(const __gc_variant &a, const __gc_variant &b) { return a.wrapped() >= b.wrapped(); }
+	// gets the number of values in the queue - this is only a snapshot if there are no concurrent producers/consumers
+	size_type size_approx() const noexcept
+	{
+		size_type deq = dequeue_pos.load(std::memory_order_acquire);
+		size_type enq = enqueue_pos.load(std::memory_order_acquire);
+		return enq > deq ? enq - deq : 0;
+	}
+	bool empty_approx() const noexcept { return size_approx() == 0; }
 };
-template<typename Lockable, typename ...Types>
-struct GC::router<__gc_variant<Lockable, Types...>>
-{
-	// if all the variant options are trivial, the variant is always trivial
-	static constexpr bool is_trivial = GC::all_have_trivial_routers<Types...>::value;
 
+template<typename T>
+struct GC::router<__gc_concurrent_queue<GC::ptr<T>>>
+{
 	template<typename F>
-	static void route(const __gc_variant<Lockable, Types...> &var, F func)
+	static void route(const __gc_concurrent_queue<GC::ptr<T>> &queue, F func)
 	{
-		std::lock_guard lock(var.mutex);
-		GC::route(var.wrapped(), func);
+		// every slot holds a (constructed) gc ptr for the queue's entire lifetime - free slots are just null.
+		// swapping them in and out is a handle repoint, which the disjunction caches during a collection, so this needs no lock.
+		for (std::size_t i = 0; i <= queue.mask; ++i) GC::route(queue.buffer[i].value, func);
 	}
 };
 
-namespace std
-{
-	template<std::size_t I, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &var) { return var.template get<I>(); }
-	template<std::size_t I, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(const __gc_variant<Lockable, Types...> &var) { return var.template get<I>(); }
-	template<std::size_t I, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &&var) { return std::move(var).template get<I>(); }
+// ------------------------------- //
 
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &var) { return var.template get<T>(); }
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(const __gc_variant<Lockable, Types...> &var) { return var.template get<T>(); }
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get(__gc_variant<Lockable, Types...> &&var) { return std::move(var).template get<T>(); }
+// -- persistent container impl -- //
 
-	template<std::size_t I, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get_if(__gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<I>() : nullptr; }
-	template<std::size_t I, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get_if(const __gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<I>() : nullptr; }
+// ------------------------------- //
 
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get_if(__gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<T>() : nullptr; }
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr decltype(auto) get_if(const __gc_variant<Lockable, Types...> *pvar) noexcept { return pvar ? pvar->template get_if<T>() : nullptr; }
+// a node of a persistent map (hash array mapped trie).
+// nodes are immutable after construction - updates create new nodes that share the unchanged children of the old ones.
+template<typename Key, typename T>
+struct __gc_persistent_map_node
+{
+	typedef std::pair<const Key, T> value_type;
 
-	template<typename T, typename Lockable, typename ...Types>
-	constexpr bool holds_alternative(const __gc_variant<Lockable, Types...> &var) noexcept { return var.template holds_alternative<T>(); }
-}
+	const std::uint32_t datamap; // the hash fragments that have an inline entry
+	const std::uint32_t nodemap; // the hash fragments that have a child node
 
-template<typename Lockable, typename ...Types>
-struct std::variant_size<__gc_variant<Lockable, Types...>> : std::variant_size<std::variant<Types...>> {};
+	// inline entries and child nodes (ordered by hash fragment).
+	// if the hash bits are exhausted, this is a collision node - maps are empty and entries is an (unordered) list of entries with the same hash.
+	const std::vector<value_type> entries;
+	const std::vector<GC::ptr<__gc_persistent_map_node>> children;
 
-template<std::size_t I, typename Lockable, typename ...Types>
-struct std::variant_alternative<I, __gc_variant<Lockable, Types...>> : std::variant_alternative<I, std::variant<Types...>> {};
+	__gc_persistent_map_node(std::uint32_t _datamap, std::uint32_t _nodemap, std::vector<value_type> &&_entries, std::vector<GC::ptr<__gc_persistent_map_node>> &&_children)
+		: datamap(_datamap), nodemap(_nodemap), entries(std::move(_entries)), children(std::move(_children))
+	{}
+};
 
-// hash function for gc variant
-template<typename Lockable, typename ...Types>
-struct std::hash<__gc_variant<Lockable, Types...>>
+template<typename Key, typename T>
+struct GC::router<__gc_persistent_map_node<Key, T>>
 {
-	std::hash<std::variant<Types...>> hasher; // the hasher may be non-trivial, so store it
-	std::size_t operator()(const __gc_variant<Lockable, Types...> &var) const { return hasher(var.wrapped()); }
+	// nodes are immutable after construction, so this needs no lock
+	static void route(const __gc_persistent_map_node<Key, T> &node, GC::router_fn func)
+	{
+		GC::route(node.entries, func);
+		GC::route(node.children, func);
+	}
+	// nodes are immutable after construction, so they have no mutable arcs
+	static void route(const __gc_persistent_map_node<Key, T> &node, GC::mutable_router_fn func) {}
 };
 
-// ------------------------------------------------------------------------------------
-
-template<typename T, typename Lockable>
-class __gc_optional
+template<typename Key, typename T, typename Hash, typename KeyEqual>
+class __gc_persistent_map
 {
-private: // -- data -- //
+public: // -- typedefs -- //
 
-	typedef std::optional<T> wrapped_t; // the wrapped type
+	typedef Key key_type;
+	typedef T mapped_type;
 
-	alignas(wrapped_t) char buffer[sizeof(wrapped_t)]; // buffer for the wrapped object
+	typedef std::pair<const Key, T> value_type;
 
-	mutable Lockable mutex; // router synchronizer
+	typedef std::size_t size_type;
 
-	friend struct GC::router<__gc_optional>;
+	typedef Hash hasher;
+	typedef KeyEqual key_equal;
 
-	friend struct std::hash<__gc_optional>;
+private: // -- data -- //
 
-private: // -- data accessors -- //
+	typedef __gc_persistent_map_node<Key, T> node_t;
+	typedef GC::ptr<node_t> node_ptr;
 
-	// gets the wrapped object from the buffer by reference - und if the buffered object has not yet been constructed
-	wrapped_t &wrapped() noexcept { return *reinterpret_cast<wrapped_t*>(buffer); }
-	const wrapped_t &wrapped() const noexcept { return *reinterpret_cast<const wrapped_t*>(buffer); }
+	static constexpr std::size_t hash_bits = sizeof(std::size_t) * CHAR_BIT;
+	static constexpr std::size_t fragment_bits = 5; // 32-way branching (one bit per fragment in a 32-bit bitmap)
 
-public: // -- wrapped obj access -- //
+	node_ptr root; // null for an empty map
+	size_type count;
 
-	// gets the std::variant wrapped object
-	operator const wrapped_t&() const& { return wrapped(); }
-	operator wrapped_t() && { return std::move(wrapped()); }
+	hasher hash;
+	key_equal equal;
 
-public: // -- types -- //
+	friend struct GC::router<__gc_persistent_map>;
 
-	typedef T value_type;
+private: // -- helpers -- //
 
-public: // -- ctor / dtor -- //
+	__gc_persistent_map(node_ptr &&_root, size_type _count, const hasher &_hash, const key_equal &_equal)
+		: root(std::move(_root)), count(_count), hash(_hash), equal(_equal)
+	{}
 
-	constexpr __gc_optional() noexcept
-	{
-		new (buffer) wrapped_t();
-	}
-	constexpr __gc_optional(std::nullopt_t) noexcept
-	{
-		new (buffer) wrapped_t(std::nullopt);
-	}
+	static std::uint32_t bit_for(std::size_t h, std::size_t shift) { return (std::uint32_t)1 << ((h >> shift) & 31); }
 
-	constexpr __gc_optional(const __gc_optional &other)
-	{
-		new (buffer) wrapped_t(other.wrapped());
-	}
-	constexpr __gc_optional(const wrapped_t &other)
+	// gets the index of the entry/child for bit in the given bitmap
+	static std::size_t index_for(std::uint32_t bitmap, std::uint32_t bit)
 	{
-		new (buffer) wrapped_t(other);
-	}
+		std::uint32_t v = bitmap & (bit - 1);
 
-	constexpr __gc_optional(__gc_optional &&other)
-	{
-		new (buffer) wrapped_t(std::move(other.wrapped()));
-	}
-	constexpr __gc_optional(wrapped_t &&other)
-	{
-		new (buffer) wrapped_t(std::move(other));
+		// popcount
+		v = v - ((v >> 1) & 0x55555555);
+		v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+		return (((v + (v >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
 	}
 
-	template<typename U, typename ULockable, std::enable_if_t<std::is_convertible<const U&, T>::value, int> = 0>
-	__gc_optional(const __gc_optional<U, ULockable> &other)
-	{
-		new (buffer) wrapped_t(other.wrapped());
-	}
-	template<typename U, std::enable_if_t<std::is_convertible<const U&, T>::value, int> = 0>
-	__gc_optional(const std::optional<U> &other)
+	static node_ptr make_node(std::uint32_t datamap, std::uint32_t nodemap, std::vector<value_type> &&entries, std::vector<node_ptr> &&children)
 	{
-		new (buffer) wrapped_t(other);
+		return GC::make<node_t>(datamap, nodemap, std::move(entries), std::move(children));
 	}
 
-	template<typename U, typename ULockable, std::enable_if_t<!std::is_convertible<const U&, T>::value, int> = 0>
-	explicit __gc_optional(const __gc_optional<U, ULockable> &other)
-	{
-		new (buffer) wrapped_t(other.wrapped());
-	}
-	template<typename U, std::enable_if_t<!std::is_convertible<const U&, T>::value, int> = 0>
-	explicit __gc_optional(const std::optional<U> &other)
+	// creates a node holding two entries with different keys (hashes a and b respectively)
+	static node_ptr make_pair_node(std::size_t shift, const value_type &a, std::size_t hash_a, const value_type &b, std::size_t hash_b)
 	{
-		new (buffer) wrapped_t(other);
-	}
+		std::vector<value_type> entries;
 
-	template<typename U, typename ULockable, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
-	__gc_optional(__gc_optional<U, ULockable> &&other)
-	{
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		// if we're out of hash bits, this is a collision node
+		if (shift >= hash_bits)
+		{
+			entries.reserve(2);
+			entries.push_back(a);
+			entries.push_back(b);
+			return make_node(0, 0, std::move(entries), {});
+		}
+
+		std::uint32_t bit_a = bit_for(hash_a, shift), bit_b = bit_for(hash_b, shift);
+
+		// if they share a fragment, push them down into a child node
+		if (bit_a == bit_b)
+		{
+			std::vector<node_ptr> children;
+			children.push_back(make_pair_node(shift + fragment_bits, a, hash_a, b, hash_b));
+			return make_node(0, bit_a, {}, std::move(children));
+		}
+
+		entries.reserve(2);
+		if (bit_a < bit_b) { entries.push_back(a); entries.push_back(b); }
+		else { entries.push_back(b); entries.push_back(a); }
+		return make_node(bit_a | bit_b, 0, std::move(entries), {});
 	}
-	template<typename U, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
-	__gc_optional(std::optional<U> &&other)
+
+	// returns node with the entry for key set to value - added is set to true iff key was not already present
+	node_ptr set(const node_ptr &node, std::size_t shift, std::size_t h, const Key &key, const T &value, bool &added) const
 	{
-		new (buffer) wrapped_t(std::move(other));
+		// if there's no node, make one
+		if (!node)
+		{
+			added = true;
+			std::vector<value_type> entries;
+			entries.emplace_back(key, value);
+			return shift >= hash_bits ? make_node(0, 0, std::move(entries), {}) : make_node(bit_for(h, shift), 0, std::move(entries), {});
+		}
+
+		// collision node
+		if (shift >= hash_bits)
+		{
+			std::vector<value_type> entries;
+			entries.reserve(node->entries.size() + 1);
+
+			added = true;
+			for (const value_type &entry : node->entries)
+			{
+				if (added && equal(entry.first, key)) { entries.emplace_back(key, value); added = false; }
+				else entries.push_back(entry);
+			}
+			if (added) entries.emplace_back(key, value);
+
+			return make_node(0, 0, std::move(entries), {});
+		}
+
+		std::uint32_t bit = bit_for(h, shift);
+
+		// an inline entry has the same fragment
+		if (node->datamap & bit)
+		{
+			std::size_t index = index_for(node->datamap, bit);
+			const value_type &old = node->entries[index];
+
+			std::vector<value_type> entries;
+			entries.reserve(node->entries.size());
+
+			// same key - replace it
+			if (equal(old.first, key))
+			{
+				added = false;
+
+				for (std::size_t i = 0; i < node->entries.size(); ++i)
+				{
+					if (i == index) entries.emplace_back(key, value);
+					else entries.push_back(node->entries[i]);
+				}
+				return make_node(node->datamap, node->nodemap, std::move(entries), std::vector<node_ptr>(node->children));
+			}
+
+			// different key - push both down into a new child
+			added = true;
+
+			node_ptr child = make_pair_node(shift + fragment_bits, old, hash(old.first), value_type(key, value), h);
+
+			for (std::size_t i = 0; i < node->entries.size(); ++i) if (i != index) entries.push_back(node->entries[i]);
+
+			std::vector<node_ptr> children(node->children);
+			children.insert(children.begin() + index_for(node->nodemap, bit), std::move(child));
+
+			return make_node(node->datamap ^ bit, node->nodemap | bit, std::move(entries), std::move(children));
+		}
+
+		// a child node has the same fragment
+		if (node->nodemap & bit)
+		{
+			std::size_t index = index_for(node->nodemap, bit);
+
+			std::vector<node_ptr> children(node->children);
+			children[index] = set(node->children[index], shift + fragment_bits, h, key, value, added);
+
+			return make_node(node->datamap, node->nodemap, std::vector<value_type>(node->entries), std::move(children));
+		}
+
+		// otherwise insert a new inline entry
+		added = true;
+
+		std::size_t index = index_for(node->datamap, bit);
+
+		std::vector<value_type> entries;
+		entries.reserve(node->entries.size() + 1);
+		for (std::size_t i = 0; i < node->entries.size(); ++i)
+		{
+			if (i == index) entries.emplace_back(key, value);
+			entries.push_back(node->entries[i]);
+		}
+		if (index == node->entries.size()) entries.emplace_back(key, value);
+
+		return make_node(node->datamap | bit, node->nodemap, std::move(entries), std::vector<node_ptr>(node->children));
 	}
 
-	template<typename U, typename ULockable, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
-	explicit __gc_optional(__gc_optional<U, ULockable> &&other)
+	// returns node without the entry for key (null if that leaves it empty) - if key is not present, returns node itself
+	node_ptr erase(const node_ptr &node, std::size_t shift, std::size_t h, const Key &key) const
 	{
-		new (buffer) wrapped_t(std::move(other.wrapped()));
+		if (!node) return node;
+
+		// collision node
+		if (shift >= hash_bits)
+		{
+			auto pos = std::find_if(node->entries.begin(), node->entries.end(), [&](const value_type &entry) { return equal(entry.first, key); });
+			if (pos == node->entries.end()) return node;
+			if (node->entries.size() == 1) return nullptr;
+
+			std::vector<value_type> entries;
+			entries.reserve(node->entries.size() - 1);
+			for (auto i = node->entries.begin(); i != node->entries.end(); ++i) if (i != pos) entries.push_back(*i);
+
+			return make_node(0, 0, std::move(entries), {});
+		}
+
+		std::uint32_t bit = bit_for(h, shift);
+
+		if (node->datamap & bit)
+		{
+			std::size_t index = index_for(node->datamap, bit);
+			if (!equal(node->entries[index].first, key)) return node;
+
+			if (node->entries.size() == 1 && node->children.empty()) return nullptr;
+
+			std::vector<value_type> entries;
+			entries.reserve(node->entries.size() - 1);
+			for (std::size_t i = 0; i < node->entries.size(); ++i) if (i != index) entries.push_back(node->entries[i]);
+
+			return make_node(node->datamap ^ bit, node->nodemap, std::move(entries), std::vector<node_ptr>(node->children));
+		}
+
+		if (node->nodemap & bit)
+		{
+			std::size_t index = index_for(node->nodemap, bit);
+
+			node_ptr child = erase(node->children[index], shift + fragment_bits, h, key);
+			if (child == node->children[index]) return node;
+
+			// if the child was emptied, remove it
+			if (!child)
+			{
+				if (node->children.size() == 1 && node->entries.empty()) return nullptr;
+
+				std::vector<node_ptr> children;
+				children.reserve(node->children.size() - 1);
+				for (std::size_t i = 0; i < node->children.size(); ++i) if (i != index) children.push_back(node->children[i]);
+
+				return make_node(node->datamap, node->nodemap ^ bit, std::vector<value_type>(node->entries), std::move(children));
+			}
+
+			// if the child is down to a single entry, pull it up into this node (keeps the trie compact)
+			if (child->entries.size() == 1 && child->children.empty())
+			{
+				std::size_t entry_index = index_for(node->datamap, bit);
+
+				std::vector<value_type> entries;
+				entries.reserve(node->entries.size() + 1);
+				for (std::size_t i = 0; i < node->entries.size(); ++i)
+				{
+					if (i == entry_index) entries.push_back(child->entries[0]);
+					entries.push_back(node->entries[i]);
+				}
+				if (entry_index == node->entries.size()) entries.push_back(child->entries[0]);
+
+				std::vector<node_ptr> children;
+				children.reserve(node->children.size() - 1);
+				for (std::size_t i = 0; i < node->children.size(); ++i) if (i != index) children.push_back(node->children[i]);
+
+				return make_node(node->datamap | bit, node->nodemap ^ bit, std::move(entries), std::move(children));
+			}
+
+			std::vector<node_ptr> children(node->children);
+			children[index] = std::move(child);
+
+			return make_node(node->datamap, node->nodemap, std::vector<value_type>(node->entries), std::move(children));
+		}
+
+		return node;
 	}
-	template<typename U, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
-	explicit __gc_optional(std::optional<U> &&other)
+
+	template<typename F>
+	static void for_each(const node_t &node, F &f)
 	{
-		new (buffer) wrapped_t(std::move(other));
+		for (const value_type &entry : node.entries) f(entry);
+		for (const node_ptr &child : node.children) for_each(*child, f);
 	}
 
-	template<typename ...Args>
-	constexpr explicit __gc_optional(std::in_place_t, Args &&...args)
+public: // -- ctor / dtor / asgn -- //
+
+	// creates an empty map
+	explicit __gc_persistent_map(const hasher &_hash = hasher(), const key_equal &_equal = key_equal())
+		: root(nullptr), count(0), hash(_hash), equal(_equal)
+	{}
+
+	__gc_persistent_map(std::initializer_list<value_type> ilist, const hasher &_hash = hasher(), const key_equal &_equal = key_equal())
+		: __gc_persistent_map(_hash, _equal)
 	{
-		new (buffer) wrapped_t(std::in_place, std::forward<Args>(args)...);
+		for (const value_type &entry : ilist) *this = set(entry.first, entry.second);
 	}
-	template<typename U, typename ...Args>
-	constexpr explicit __gc_optional(std::in_place_t, std::initializer_list<U> il, Args &&...args)
+
+	// copying a map is O(1) - the copy shares all of its nodes with the original
+	__gc_persistent_map(const __gc_persistent_map&) = default;
+	__gc_persistent_map &operator=(const __gc_persistent_map&) = default;
+
+public: // -- lookup -- //
+
+	// gets a pointer to the value associated with key, or null if key is not present.
+	// the pointed-to value is immutable and remains valid as long as this map (or any other version sharing it) exists.
+	const T *find(const Key &key) const
 	{
-		new (buffer) wrapped_t(std::in_place, il, std::forward<Args>(args)...);
+		std::size_t h = hash(key);
+		const node_t *node = root.get();
+
+		for (std::size_t shift = 0; node; shift += fragment_bits)
+		{
+			// collision node
+			if (shift >= hash_bits)
+			{
+				for (const value_type &entry : node->entries) if (equal(entry.first, key)) return &entry.second;
+				return nullptr;
+			}
+
+			std::uint32_t bit = bit_for(h, shift);
+
+			if (node->datamap & bit)
+			{
+				const value_type &entry = node->entries[index_for(node->datamap, bit)];
+				return equal(entry.first, key) ? &entry.second : nullptr;
+			}
+			if (!(node->nodemap & bit)) return nullptr;
+
+			node = node->children[index_for(node->nodemap, bit)].get();
+		}
+
+		return nullptr;
 	}
 
-	template<typename U = value_type, std::enable_if_t<std::is_convertible<U&&, T>::value, int> = 0>
-	constexpr __gc_optional(U &&value)
+	bool contains(const Key &key) const { return find(key) != nullptr; }
+
+	// gets the value associated with key - throws std::out_of_range if key is not present
+	const T &at(const Key &key) const
 	{
-		new (buffer) wrapped_t(std::forward<U>(value));
+		const T *value = find(key);
+		if (!value) throw std::out_of_range("key not found in persistent_map");
+		return *value;
 	}
-	template<typename U = value_type, std::enable_if_t<!std::is_convertible<U&&, T>::value, int> = 0>
-	constexpr explicit __gc_optional(U &&value)
+
+public: // -- updates -- //
+
+	// returns a new version of this map with key associated with value (this map is unchanged).
+	// the new version shares all but O(log n) nodes with this one.
+	[[nodiscard]]
+	__gc_persistent_map set(const Key &key, const T &value) const
 	{
-		new (buffer) wrapped_t(std::forward<U>(value));
+		bool added = false;
+		node_ptr new_root = set(root, 0, hash(key), key, value, added);
+		return __gc_persistent_map(std::move(new_root), count + added, hash, equal);
 	}
 
-	~__gc_optional()
+	// returns a new version of this map without key (this map is unchanged).
+	// if key is not present, the returned map shares the same root.
+	[[nodiscard]]
+	__gc_persistent_map erase(const Key &key) const
 	{
-		wrapped().~wrapped_t();
+		node_ptr new_root = erase(root, 0, hash(key), key);
+		size_type new_count = new_root == root ? count : count - 1;
+		return __gc_persistent_map(std::move(new_root), new_count, hash, equal);
 	}
 
-public: // -- assign -- //
+public: // -- iteration -- //
 
-	__gc_optional &operator=(std::nullopt_t)
+	// calls f(const value_type&) for each entry in the map (in unspecified order)
+	template<typename F>
+	void for_each(F f) const
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::nullopt;
-		return *this;
+		if (root) for_each(*root, f);
 	}
 
-	constexpr __gc_optional &operator=(const __gc_optional &other)
+public: // -- size -- //
+
+	size_type size() const noexcept { return count; }
+	bool empty() const noexcept { return count == 0; }
+};
+
+template<typename Key, typename T, typename Hash, typename KeyEqual>
+struct GC::router<__gc_persistent_map<Key, T, Hash, KeyEqual>>
+{
+	template<typename F>
+	static void route(const __gc_persistent_map<Key, T, Hash, KeyEqual> &map, F func)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
+		GC::route(map.root, func);
 	}
-	constexpr __gc_optional &operator=(const wrapped_t &other)
+};
+
+// a node of a persistent vector (a height-balanced rope of chunks).
+// leaves hold up to a chunk of elements - inner nodes hold two (non-null) children whose heights differ by at most 1.
+// nodes are immutable after construction - updates create new nodes that share the unchanged children of the old ones.
+template<typename T>
+struct __gc_persistent_vector_node
+{
+	const std::size_t size;   // the number of elements under this node
+	const std::size_t height; // 0 for leaves
+
+	const GC::ptr<__gc_persistent_vector_node> left, right; // null for leaves
+	const std::vector<T> elems;                              // empty for inner nodes
+
+	// creates a leaf
+	explicit __gc_persistent_vector_node(std::vector<T> &&_elems)
+		: size(_elems.size()), height(0), elems(std::move(_elems))
+	{}
+	// creates an inner node
+	__gc_persistent_vector_node(const GC::ptr<__gc_persistent_vector_node> &_left, const GC::ptr<__gc_persistent_vector_node> &_right)
+		: size(_left->size + _right->size), height(std::max(_left->height, _right->height) + 1), left(_left), right(_right)
+	{}
+};
+
+template<typename T>
+struct GC::router<__gc_persistent_vector_node<T>>
+{
+	// nodes are immutable after construction, so this needs no lock
+	static void route(const __gc_persistent_vector_node<T> &node, GC::router_fn func)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
+		GC::route(node.left, func);
+		GC::route(node.right, func);
+		GC::route(node.elems, func);
 	}
+	// nodes are immutable after construction, so they have no mutable arcs
+	static void route(const __gc_persistent_vector_node<T> &node, GC::mutable_router_fn func) {}
+};
 
-	constexpr __gc_optional &operator=(__gc_optional &&other)
+template<typename T>
+class __gc_persistent_vector
+{
+public: // -- typedefs -- //
+
+	typedef T value_type;
+
+	typedef std::size_t size_type;
+
+private: // -- data -- //
+
+	typedef __gc_persistent_vector_node<T> node_t;
+	typedef GC::ptr<node_t> node_ptr;
+
+	static constexpr size_type chunk_size = 32; // the maximum number of elements in a leaf
+
+	node_ptr root; // null for an empty vector
+
+	friend struct GC::router<__gc_persistent_vector>;
+
+private: // -- helpers -- //
+
+	explicit __gc_persistent_vector(node_ptr &&_root) : root(std::move(_root)) {}
+
+	static node_ptr make_leaf(std::vector<T> &&elems) { return elems.empty() ? node_ptr() : GC::make<node_t>(std::move(elems)); }
+	static node_ptr make_inner(const node_ptr &left, const node_ptr &right) { return GC::make<node_t>(left, right); }
+
+	// creates an inner node from two subtrees whose heights differ by at most 2 (rebalancing as needed)
+	static node_ptr balance(const node_ptr &left, const node_ptr &right)
 	{
-		if (this != &other)
+		if (left->height > right->height + 1)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped() = std::move(other.wrapped());
+			if (left->left->height >= left->right->height) return make_inner(left->left, make_inner(left->right, right));
+			return make_inner(make_inner(left->left, left->right->left), make_inner(left->right->right, right));
 		}
-		return *this;
+		if (right->height > left->height + 1)
+		{
+			if (right->right->height >= right->left->height) return make_inner(make_inner(left, right->left), right->right);
+			return make_inner(make_inner(left, right->left->left), make_inner(right->left->right, right->right));
+		}
+		return make_inner(left, right);
 	}
-	constexpr __gc_optional &operator=(wrapped_t &&other)
+
+	// concatenates two subtrees (either may be null) - O(|height difference| + 1)
+	static node_ptr join(const node_ptr &left, const node_ptr &right)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
+		if (!left) return right;
+		if (!right) return left;
+
+		if (left->height > right->height + 1) return balance(left->left, join(left->right, right));
+		if (right->height > left->height + 1) return balance(join(left, right->left), right->right);
+
+		// small neighboring leaves are merged into one chunk
+		if (left->height == 0 && right->height == 0 && left->size + right->size <= chunk_size)
+		{
+			std::vector<T> elems;
+			elems.reserve(left->size + right->size);
+			elems.insert(elems.end(), left->elems.begin(), left->elems.end());
+			elems.insert(elems.end(), right->elems.begin(), right->elems.end());
+			return make_leaf(std::move(elems));
+		}
+
+		return make_inner(left, right);
 	}
 
-	template<typename U = T>
-	__gc_optional &operator=(U &&value)
+	// splits node into its first count elements and the rest
+	static std::pair<node_ptr, node_ptr> split(const node_ptr &node, size_type count)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::forward<U>(value);
-		return *this;
+		if (count == 0) return { node_ptr(), node };
+		if (count >= node->size) return { node, node_ptr() };
+
+		if (node->height == 0)
+		{
+			return {
+				make_leaf(std::vector<T>(node->elems.begin(), node->elems.begin() + count)),
+				make_leaf(std::vector<T>(node->elems.begin() + count, node->elems.end()))
+			};
+		}
+
+		if (count <= node->left->size)
+		{
+			auto parts = split(node->left, count);
+			return { std::move(parts.first), join(parts.second, node->right) };
+		}
+		else
+		{
+			auto parts = split(node->right, count - node->left->size);
+			return { join(node->left, parts.first), std::move(parts.second) };
+		}
 	}
 
-	template<typename U, typename ULockable, std::enable_if_t<!std::is_same<__gc_optional, __gc_optional<U, ULockable>>::value, int> = 0>
-	__gc_optional &operator=(const __gc_optional<U, ULockable> &other)
+	// returns node with the element at pos replaced by value
+	static node_ptr set(const node_ptr &node, size_type pos, const T &value)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other.wrapped();
-		return *this;
+		if (node->height == 0)
+		{
+			std::vector<T> elems(node->elems);
+			elems[pos] = value;
+			return make_leaf(std::move(elems));
+		}
+
+		if (pos < node->left->size) return make_inner(set(node->left, pos, value), node->right);
+		return make_inner(node->left, set(node->right, pos - node->left->size, value));
 	}
-	template<typename U, std::enable_if_t<!std::is_same<wrapped_t, std::optional<U>>::value, int> = 0>
-	__gc_optional &operator=(const std::optional<U> &other)
+
+	// builds a balanced tree from the leaves in [first, last) (which must be non-empty)
+	static node_ptr build(const node_ptr *first, const node_ptr *last)
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = other;
-		return *this;
+		if (last - first == 1) return *first;
+
+		const node_ptr *mid = first + (last - first) / 2;
+		return make_inner(build(first, mid), build(mid, last));
 	}
 
-	template<typename U, typename ULockable, std::enable_if_t<!std::is_same<__gc_optional, __gc_optional<U, ULockable>>::value, int> = 0>
-	__gc_optional &operator=(__gc_optional<U, ULockable> &&other)
+	template<typename F>
+	static void for_each(const node_t &node, F &f)
 	{
-		std::scoped_lock locks(this->mutex, other.mutex);
-		wrapped() = std::move(other.wrapped());
-		return *this;
+		if (node.height == 0) { for (const T &elem : node.elems) f(elem); }
+		else { for_each(*node.left, f); for_each(*node.right, f); }
 	}
-	template<typename U, std::enable_if_t<!std::is_same<wrapped_t, std::optional<U>>::value, int> = 0>
-	__gc_optional &operator=(std::optional<U> &&other)
+
+public: // -- transient -- //
+
+	// a (mutable) builder used for constructing a persistent vector in bulk.
+	// elements are appended to a plain buffer - persistent() then builds a balanced tree in O(n) and appends it to the starting vector.
+	// NOT THREADSAFE - as with GC::ptr, this is not internally synchronized.
+	// this is meant to be a short-lived local object - it has no router, so it must not be owned by a gc object.
+	class transient
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped() = std::move(other);
-		return *this;
-	}
+	private: // -- data -- //
 
-public: // -- observers -- //
+		node_ptr base;        // the vector we started from
+		std::vector<T> elems; // the elements appended since then
 
-	constexpr decltype(auto) operator->() { return wrapped().operator->(); }
-	constexpr decltype(auto) operator->() const { return wrapped().operator->(); }
+	public: // -- ctor / dtor / asgn -- //
 
-	constexpr decltype(auto) operator*() & { return *wrapped(); }
-	constexpr decltype(auto) operator*() const& { return *wrapped(); }
-	constexpr decltype(auto) operator*() &&
-	{
-		std::lock_guard lock(this->mutex); // not sure if this lock is needed
-		return *std::move(wrapped());
-	}
-	constexpr decltype(auto) operator*() const&&
-	{
-		std::lock_guard lock(this->mutex); // not sure if this lock is needed
-		return *std::move(wrapped());
-	}
+		// creates a transient starting from an empty vector
+		transient() = default;
+		// creates a transient starting from the specified vector
+		explicit transient(const __gc_persistent_vector &vec) : base(vec.root) {}
 
-	constexpr explicit operator bool() const noexcept { return static_cast<bool>(wrapped()); }
-	constexpr bool has_value() const noexcept { return wrapped().has_value(); }
+	public: // -- interface -- //
 
-	constexpr decltype(auto) value() & { return wrapped().value(); }
-	constexpr decltype(auto) value() const& { return wrapped().value(); }
-	constexpr decltype(auto) value() &&
-	{
-		std::lock_guard lock(this->mutex); // not sure if this lock is needed
-		return std::move(wrapped()).value();
-	}
-	constexpr decltype(auto) value() const&&
-	{
-		std::lock_guard lock(this->mutex); // not sure if this lock is needed
-		return std::move(wrapped()).value();
-	}
+		size_type size() const noexcept { return (base ? base->size : 0) + elems.size(); }
 
-	template<typename U>
-	constexpr T value_or(U &&default_value) const& { return wrapped().value_or(std::forward<U>(default_value)); }
-	template<typename U>
-	constexpr T value_or(U &&default_value) &&
+		void reserve(size_type count) { elems.reserve(count); }
+
+		void push_back(const T &value) { elems.push_back(value); }
+		void push_back(T &&value) { elems.push_back(std::move(value)); }
+
+		// creates a persistent vector holding the current contents
+		[[nodiscard]]
+		__gc_persistent_vector persistent() const
+		{
+			std::vector<node_ptr> leaves;
+			leaves.reserve((elems.size() + chunk_size - 1) / chunk_size);
+			for (size_type i = 0; i < elems.size(); i += chunk_size)
+			{
+				leaves.push_back(make_leaf(std::vector<T>(elems.begin() + i, elems.begin() + std::min(i + chunk_size, elems.size()))));
+			}
+
+			if (leaves.empty()) return __gc_persistent_vector(node_ptr(base));
+			return __gc_persistent_vector(join(base, build(leaves.data(), leaves.data() + leaves.size())));
+		}
+	};
+
+public: // -- ctor / dtor / asgn -- //
+
+	// creates an empty vector
+	__gc_persistent_vector() = default;
+
+	__gc_persistent_vector(std::initializer_list<T> ilist)
 	{
-		std::lock_guard lock(this->mutex); // not sure if this lock is needed
-		return std::move(wrapped()).value_or(std::forward<U>(default_value));
+		transient t;
+		t.reserve(ilist.size());
+		for (const T &value : ilist) t.push_back(value);
+		*this = t.persistent();
 	}
 
-public: // -- modifiers -- //
+	// copying a vector is O(1) - the copy shares all of its nodes with the original
+	__gc_persistent_vector(const __gc_persistent_vector&) = default;
+	__gc_persistent_vector &operator=(const __gc_persistent_vector&) = default;
 
-	void swap(__gc_optional &other)
+public: // -- element access -- //
+
+	// gets the element at the specified index.
+	// the element is immutable and remains valid as long as this vector (or any other version sharing it) exists.
+	const T &operator[](size_type pos) const
 	{
-		if (this != &other)
+		const node_t *node = root.get();
+		while (node->height != 0)
 		{
-			std::scoped_lock locks(this->mutex, other.mutex);
-			wrapped().swap(other.wrapped());
+			if (pos < node->left->size) node = node->left.get();
+			else { pos -= node->left->size; node = node->right.get(); }
 		}
+		return node->elems[pos];
 	}
-	void swap(wrapped_t &other)
+	// as operator[] but throws std::out_of_range if pos is not a valid index
+	const T &at(size_type pos) const
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().swap(other);
+		if (pos >= size()) throw std::out_of_range("persistent_vector index out of range");
+		return (*this)[pos];
 	}
 
-	friend void swap(__gc_optional &a, __gc_optional &b) { a.swap(b); }
-	friend void swap(__gc_optional &a, wrapped_t &b) { a.swap(b); }
-	friend void swap(wrapped_t &a, __gc_optional &b) { b.swap(a); }
+	const T &front() const { return (*this)[0]; }
+	const T &back() const { return (*this)[size() - 1]; }
 
-	void reset()
+public: // -- updates -- //
+
+	// all updates return a new version of the vector (this vector is unchanged).
+	// the new version shares all but O(log n) nodes with this one.
+
+	// returns a new version with value appended
+	[[nodiscard]]
+	__gc_persistent_vector push_back(const T &value) const
 	{
-		std::lock_guard lock(this->mutex);
-		wrapped().reset();
+		return __gc_persistent_vector(join(root, make_leaf(std::vector<T>(1, value))));
 	}
+	// returns a new version without the last element
+	[[nodiscard]]
+	__gc_persistent_vector pop_back() const { return slice(0, size() - 1); }
 
-	template<typename ...Args>
-	T &emplace(Args &&...args)
+	// returns a new version with the element at pos replaced by value
+	[[nodiscard]]
+	__gc_persistent_vector set(size_type pos, const T &value) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(std::forward<Args>(args)...);
+		if (pos >= size()) throw std::out_of_range("persistent_vector index out of range");
+		return __gc_persistent_vector(set(root, pos, value));
 	}
-	template<typename U, typename ...Args>
-	T &emplace(std::initializer_list<U> il, Args &&...args)
+
+	// returns the elements in the index range [first, last)
+	[[nodiscard]]
+	__gc_persistent_vector slice(size_type first, size_type last) const
 	{
-		std::lock_guard lock(this->mutex);
-		return wrapped().emplace(il, std::forward<Args>(args)...);
+		if (first > last || last > size()) throw std::out_of_range("persistent_vector slice out of range");
+		if (first == last) return __gc_persistent_vector();
+
+		node_ptr head = split(root, last).first;
+		return __gc_persistent_vector(split(head, first).second);
 	}
 
-public: // -- comparison -- //
+	// returns the concatenation of this vector and other
+	[[nodiscard]]
+	__gc_persistent_vector concat(const __gc_persistent_vector &other) const
+	{
+		return __gc_persistent_vector(join(root, other.root));
+	}
 
-	friend constexpr bool operator==(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() == b.wrapped(); }
-	friend constexpr bool operator!=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() != b.wrapped(); }
-	friend constexpr bool operator<(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() < b.wrapped(); }
-	friend constexpr bool operator<=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() <= b.wrapped(); }
-	friend constexpr bool operator>(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() > b.wrapped(); }
-	friend constexpr bool operator>=(const __gc_optional &a, const __gc_optional &b) { return a.wrapped() >= b.wrapped(); }
-};
-template<typename T, typename Lockable>
-struct GC::router<__gc_optional<T, Lockable>>
-{
-	// if the optional type is trivial, so is this
-	static constexpr bool is_trivial = GC::has_trivial_router<T>::value;
+public: // -- iteration -- //
 
+	// calls f(const T&) for each element in order
 	template<typename F>
-	static void route(const __gc_optional<T, Lockable> &var, F func)
+	void for_each(F f) const
 	{
-		std::lock_guard lock(var.mutex);
-		GC::route(var.wrapped(), func);
+		if (root) for_each(*root, f);
 	}
+
+public: // -- size -- //
+
+	size_type size() const noexcept { return root ? root->size : 0; }
+	bool empty() const noexcept { return !root; }
 };
 
-template<typename T, typename Lockable>
-struct std::hash<__gc_optional<T, Lockable>>
+template<typename T>
+struct GC::router<__gc_persistent_vector<T>>
 {
-	std::hash<std::optional<T>> hasher; // the hasher may be non-trivial, so store it
-	std::size_t operator()(const __gc_optional<T, Lockable> &var) const { return hasher(var.wrapped()); }
+	template<typename F>
+	static void route(const __gc_persistent_vector<T> &vec, F func)
+	{
+		GC::route(vec.root, func);
+	}
 };
 
 // ------------------------ //
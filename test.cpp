@@ -10,6 +10,7 @@
 #include <utility>
 #include <cmath>
 #include <initializer_list>
+#include <random>
 
 #include "GarbageCollection.h"
 
@@ -625,6 +626,329 @@ struct thread_func_t
 	void foo() {}
 };
 
+// collects until pred() holds (up to a limit) and asserts that it eventually did.
+// if a background collection is in progress, GC::collect() returns immediately, so a single call isn't guaranteed to reclaim anything.
+template<typename Pred>
+void collect_until(Pred pred)
+{
+	bool held = false;
+	for (int i = 0; i < 1000 && !held; ++i)
+	{
+		GC::collect();
+		held = pred();
+		if (!held) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	assert(held);
+}
+
+// a gc type whose (collector) routing blocks once armed until released - used for checking that marking doesn't block container writers
+struct route_blocker
+{
+	static inline std::atomic<bool> armed{ false }, entered{ false }, released{ false }, timed_out{ false };
+};
+template<> struct GC::router<route_blocker>
+{
+	static void route(const route_blocker&, GC::router_fn)
+	{
+		if (route_blocker::armed.exchange(false))
+		{
+			route_blocker::entered = true;
+			for (int i = 0; i < 5000 && !route_blocker::released; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			route_blocker::timed_out = !route_blocker::released;
+		}
+	}
+	static void route(const route_blocker&, GC::mutable_router_fn) {}
+};
+
+struct ptr_vector_node
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	GC::ptr_vector<ptr_vector_node> children;
+
+	ptr_vector_node() { ++alive; }
+	~ptr_vector_node() { --alive; }
+};
+template<>
+struct GC::router<ptr_vector_node>
+{
+	template<typename F>
+	static void route(const ptr_vector_node &n, F func)
+	{
+		GC::route(n.children, func);
+	}
+};
+
+// a gc type whose (collector) routing blocks once armed until released, and only then routes its arcs - used for checking handle destruction mid-collection
+struct arc_route_blocker
+{
+	static inline std::atomic<bool> armed{ false }, entered{ false }, released{ false };
+
+	GC::vector<GC::ptr<ptr_vector_node>> arcs;
+};
+template<> struct GC::router<arc_route_blocker>
+{
+	static void route(const arc_route_blocker &obj, GC::router_fn func)
+	{
+		if (arc_route_blocker::armed.exchange(false))
+		{
+			arc_route_blocker::entered = true;
+			for (int i = 0; i < 5000 && !arc_route_blocker::released; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		GC::route(obj.arcs, func);
+	}
+	static void route(const arc_route_blocker &obj, GC::mutable_router_fn func)
+	{
+		GC::route(obj.arcs, func);
+	}
+};
+
+
+// an interned value that can form cycles through its back vector - used for checking that intern table entries expire on collection
+struct interned_node
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	int key;
+	GC::ptr<GC::vector<GC::ptr<const interned_node>>> back;
+
+	explicit interned_node(int k) : key(k), back(GC::make<GC::vector<GC::ptr<const interned_node>>>()) { ++alive; }
+	interned_node(const interned_node &other) : key(other.key), back(other.back) { ++alive; }
+	~interned_node() { --alive; }
+
+	friend bool operator==(const interned_node &a, const interned_node &b) { return a.key == b.key; }
+};
+struct interned_node_hash
+{
+	std::size_t operator()(const interned_node &n) const noexcept { return std::hash<int>{}(n.key); }
+};
+template<>
+struct GC::router<interned_node>
+{
+	template<typename F>
+	static void route(const interned_node &n, F func)
+	{
+		GC::route(n.back, func);
+	}
+};
+
+// a singly-linked gc node - used for building chains too long to be marked recursively
+struct chain_node
+{
+	GC::ptr<chain_node> next;
+};
+template<>
+struct GC::router<chain_node>
+{
+	template<typename F>
+	static void route(const chain_node &n, F func)
+	{
+		GC::route(n.next, func);
+	}
+};
+
+// an element of both an intrusive list and an intrusive set - used for intrusive container tests
+struct hooked_node
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	int key;
+	GC::list_hook<hooked_node> order;
+	GC::set_hook<hooked_node> index;
+	GC::ptr<hooked_node> other; // used for forming cycles
+
+	explicit hooked_node(int k) : key(k) { ++alive; }
+	~hooked_node() { --alive; }
+};
+struct hooked_node_less
+{
+	typedef void is_transparent;
+
+	bool operator()(const hooked_node &a, const hooked_node &b) const noexcept { return a.key < b.key; }
+	bool operator()(const hooked_node &a, int b) const noexcept { return a.key < b; }
+	bool operator()(int a, const hooked_node &b) const noexcept { return a < b.key; }
+};
+template<>
+struct GC::router<hooked_node>
+{
+	template<typename F>
+	static void route(const hooked_node &n, F func)
+	{
+		GC::route(n.order, func);
+		GC::route(n.index, func);
+		GC::route(n.other, func);
+	}
+};
+
+// a self-referencing gc type whose destructor uses local intrusive containers - used for checking that they still unlink during a sweep
+struct sweep_time_unlinker
+{
+	static inline std::atomic<int> result{ 0 }; // 0 until destroyed, then 1 if the elements were unlinked and 2 if not
+
+	GC::ptr<sweep_time_unlinker> self; // only the collector can destroy it
+
+	~sweep_time_unlinker()
+	{
+		GC::ptr<hooked_node> n = GC::make<hooked_node>(0);
+		{
+			GC::intrusive_list<hooked_node, &hooked_node::order> list;
+			GC::intrusive_set<hooked_node, &hooked_node::index, hooked_node_less> set;
+			list.push_back(n);
+			set.insert(n);
+			for (int i = 1; i < 3; ++i)
+			{
+				GC::ptr<hooked_node> other = GC::make<hooked_node>(i);
+				list.push_back(other);
+				set.insert(other);
+			}
+		}
+		result = !n->order.is_linked() && !n->index.is_linked() ? 1 : 2;
+	}
+};
+template<>
+struct GC::router<sweep_time_unlinker>
+{
+	template<typename F>
+	static void route(const sweep_time_unlinker &u, F func)
+	{
+		GC::route(u.self, func);
+	}
+};
+
+// a gc type with an event callback - used for checking that cycles through GC::function are collected
+struct handler_node
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	int total = 0;
+	GC::function<void(int)> on_event;
+
+	handler_node() { ++alive; }
+	~handler_node() { --alive; }
+};
+template<>
+struct GC::router<handler_node>
+{
+	template<typename F>
+	static void route(const handler_node &n, F func)
+	{
+		GC::route(n.on_event, func);
+	}
+};
+
+// a gc type that keeps its recent peers in a ring buffer - used for checking that cycles through ring buffers are collected
+template<typename Lockable>
+struct stream_node
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	int value;
+	GC::ring_buffer<GC::ptr<stream_node>, Lockable> recent{ 4 };
+
+	explicit stream_node(int v) : value(v) { ++alive; }
+	~stream_node() { --alive; }
+};
+template<typename Lockable>
+struct GC::router<stream_node<Lockable>>
+{
+	template<typename F>
+	static void route(const stream_node<Lockable> &n, F func)
+	{
+		GC::route(n.recent, func);
+	}
+};
+
+// a gc type whose destructor collects and then uses its child - used for checking collections during ref count destruction
+struct collecting_dtor
+{
+	static inline std::atomic<int> checked{ 0 };
+
+	GC::ptr<int> child;
+
+	~collecting_dtor()
+	{
+		GC::collect();
+		if (child && *child == 42) ++checked;
+	}
+};
+template<>
+struct GC::router<collecting_dtor>
+{
+	template<typename F>
+	static void route(const collecting_dtor &obj, F func)
+	{
+		GC::route(obj.child, func);
+	}
+};
+
+// a value whose copies and moves (which may throw) throw once a countdown runs out - used for checking that failed bulk operations leave containers intact
+struct countdown_thrower
+{
+	static inline int countdown = 0; // disarmed while zero
+
+	int value;
+
+	static void tick() { if (countdown > 0 && --countdown == 0) throw std::runtime_error("countdown_thrower"); }
+
+	countdown_thrower(int v) : value(v) {}
+	countdown_thrower(const countdown_thrower &other) : value(other.value) { tick(); }
+	countdown_thrower(countdown_thrower &&other) noexcept(false) : value(other.value) { tick(); }
+	countdown_thrower &operator=(const countdown_thrower &other) { tick(); value = other.value; return *this; }
+	countdown_thrower &operator=(countdown_thrower &&other) noexcept(false) { tick(); value = other.value; return *this; }
+};
+template<> struct GC::router<countdown_thrower> { static constexpr bool is_trivial = true; };
+
+// a gc type that refers to itself (and counts its instances) - used for making garbage that only a collection can reclaim
+struct self_cycle
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	GC::ptr<self_cycle> self;
+
+	self_cycle() { ++alive; }
+	~self_cycle() { --alive; }
+};
+template<>
+struct GC::router<self_cycle>
+{
+	template<typename F>
+	static void route(const self_cycle &obj, F func)
+	{
+		GC::route(obj.self, func);
+	}
+};
+
+// a key whose copies throw once armed (moves never do) - used for checking that failed insertions leave containers intact
+struct copy_thrower
+{
+	static inline bool armed = false;
+
+	int value;
+
+	copy_thrower(int v) : value(v) {}
+	copy_thrower(const copy_thrower &other) : value(other.value) { if (armed) throw std::runtime_error("copy_thrower copy"); }
+	copy_thrower(copy_thrower&&) noexcept = default;
+	copy_thrower &operator=(const copy_thrower&) = default;
+	copy_thrower &operator=(copy_thrower&&) noexcept = default;
+
+	friend bool operator<(const copy_thrower &a, const copy_thrower &b) noexcept { return a.value < b.value; }
+};
+template<> struct GC::router<copy_thrower> { static constexpr bool is_trivial = true; };
+
+struct alive_counter
+{
+	static inline std::atomic<int> alive{ 0 };
+
+	alive_counter() { ++alive; }
+	alive_counter(const alive_counter&) { ++alive; }
+	~alive_counter() { --alive; }
+};
+
+// a hash with very few distinct values - used for forcing hash collisions
+struct poor_hash
+{
+	std::size_t operator()(int v) const noexcept { return v % 3; }
+};
 
 // begins a timer in a new scope - requires a matching timer end point.
 #define TIMER_BEGIN() { const auto __timer_begin = std::chrono::high_resolution_clock::now();
@@ -861,6 +1185,8 @@ int main() try
 				catch (...) { std::cerr << "DISJUNCTION DEL TEST EXCEPTION!!\n"; assert(false); }
 			}, std::ref(disjunction_deletion_flag)).join();
 
+			// the final collection for the severed disjunction is performed asynchronously by the background collector - wait for it
+			for (int j = 0; j < 10000 && !disjunction_deletion_flag; ++j) std::this_thread::sleep_for(std::chrono::milliseconds(1));
 			assert(disjunction_deletion_flag);
 		}
 	}
@@ -1097,6 +1423,1443 @@ int main() try
 	}
 	std::cerr << "----------------- end ----------------\n\n";
 
+	{ // -- atomic compare exchange tests -- //
+		#if DRAGAZO_GARBAGE_COLLECT_STRIPED_ATOMIC_PTR_LOCKS
+		static_assert(sizeof(GC::atomic_ptr<int>) == sizeof(GC::ptr<int>), "striped atomic ptr should not embed a mutex");
+		#endif
+
+		GC::atomic_ptr<int> counter = GC::make<int>(0);
+		std::atomic<GC::ptr<int>> std_counter(GC::make<int>(0));
+
+		// increment both counters via cas loops from several threads
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i) threads.emplace_back([&counter, &std_counter]
+		{
+			for (int j = 0; j < 250; ++j)
+			{
+				GC::ptr<int> expected = counter.load();
+				while (!counter.compare_exchange_weak(expected, GC::make<int>(*expected + 1)));
+
+				expected = std_counter.load();
+				while (!std_counter.compare_exchange_strong(expected, GC::make<int>(*expected + 1)));
+			}
+		});
+		for (auto &t : threads) t.join();
+
+		GC::ptr<int> final_count = counter.load(), std_final_count = std_counter.load();
+		assert(*final_count == 1000);
+		assert(*std_final_count == 1000);
+
+		// failure loads the current value into expected
+		GC::ptr<int> stale = GC::make<int>(1000);
+		GC::ptr<int> current = counter.load();
+		bool exchanged = counter.compare_exchange_strong(stale, nullptr);
+		assert(!exchanged && stale == current);
+		exchanged = counter.compare_exchange_strong(stale, nullptr);
+		assert(exchanged);
+		assert(counter.load() == nullptr);
+
+		// wait for a value to be published
+		std_counter.store(stale);
+		std::thread waiter([&std_counter, stale]
+		{
+			std_counter.wait(stale);
+			GC::ptr<int> published = std_counter.load();
+			assert(published != stale && *published == 2000);
+		});
+		std_counter.notify_all(); // spurious - should keep waiting
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		std_counter.store(GC::make<int>(2000));
+		std_counter.notify_one();
+		waiter.join();
+	}
+
+	{ // -- rcu_ptr tests -- //
+		GC::rcu_ptr<std::vector<int>> snapshot = GC::make<std::vector<int>>(16, 0);
+		std::atomic<bool> done(false);
+
+		// readers should always see a consistent snapshot, even while it's being replaced
+		std::vector<std::thread> readers;
+		for (int i = 0; i < 4; ++i) readers.emplace_back([&snapshot, &done]
+		{
+			while (!done)
+			{
+				auto r = snapshot.read();
+				assert(r && r->size() == 16);
+				for (int v : *r) assert(v == r->front());
+			}
+		});
+
+		for (int i = 1; i <= 100; ++i) snapshot = GC::make<std::vector<int>>(16, i);
+
+		done = true;
+		for (auto &t : readers) t.join();
+
+		{
+			auto r = snapshot.read();
+			assert(r->front() == 100);
+		}
+
+		// loading inside a read-side section must not deadlock with a writer waiting for that section to end
+		{
+			GC::ptr<std::vector<int>> next = GC::make<std::vector<int>>(16, 101);
+			std::thread writer;
+			{
+				auto r = snapshot.read();
+				writer = std::thread([&snapshot, next] { snapshot = next; });
+				while (snapshot.read().get() != next.get()) std::this_thread::yield();
+
+				assert(r->front() == 100 && snapshot.load() == next);
+			}
+			writer.join();
+		}
+
+		GC::ptr<std::vector<int>> old = snapshot.exchange(nullptr);
+		assert(old && old->front() == 101);
+		assert(!snapshot.read() && snapshot.load() == nullptr);
+	}
+
+	{ // -- epoch reclamation tests -- //
+		struct epoch_obj
+		{
+			std::atomic<bool> &destroyed;
+			explicit epoch_obj(std::atomic<bool> &flag) : destroyed(flag) {}
+			~epoch_obj() { destroyed = true; }
+		};
+
+		std::atomic<bool> destroyed_0(false), destroyed_1(false);
+		GC::ptr<epoch_obj> p = GC::make<epoch_obj>(destroyed_0);
+
+		{
+			GC::epoch_guard guard;
+			epoch_obj *raw = p.get();
+
+			// unlink and retire it - the guard should keep it alive
+			GC::retire(p);
+			p = nullptr;
+			assert(!destroyed_0 && &raw->destroyed == &destroyed_0);
+
+			// nested guards hold it as well (and objects retired during them wait for the outer guard too)
+			GC::ptr<epoch_obj> q = GC::make<epoch_obj>(destroyed_1);
+			{
+				GC::epoch_guard inner;
+				GC::retire(q);
+				q = nullptr;
+			}
+			assert(!destroyed_0 && !destroyed_1);
+		}
+		// (a background collection can defer the ref count deletions until it finishes)
+		collect_until([&] { return destroyed_0 && destroyed_1; });
+
+		// with no active guards retiring is a no-op
+		destroyed_0 = false;
+		p = GC::make<epoch_obj>(destroyed_0);
+		GC::retire(p);
+		p = nullptr;
+		collect_until([&] { return destroyed_0.load(); });
+	}
+
+	{ // -- shared lockable wrapper tests -- //
+		static_assert(GC::is_shared_lockable<GC::recursive_shared_mutex>::value, "shared lockable assumption failure");
+		static_assert(!GC::is_shared_lockable<std::recursive_mutex>::value, "shared lockable assumption failure");
+
+		typedef GC::unordered_map<int, GC::ptr<int>, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<const int, GC::ptr<int>>>, GC::recursive_shared_mutex> shared_map_t;
+
+		GC::ptr<shared_map_t> map = GC::make<shared_map_t>();
+		for (int i = 0; i < 64; ++i) map->emplace(i, GC::make<int>(i));
+
+		// mutate from several threads while collecting
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i) threads.emplace_back([map, i]
+		{
+			for (int j = 0; j < 64; ++j) (*map)[64 + i * 64 + j] = GC::make<int>(j);
+			GC::collect();
+		});
+		for (auto &t : threads) t.join();
+
+		GC::collect();
+		assert(map->size() == 64 * 5);
+		for (auto &entry : *map) assert(*entry.second == entry.first % 64);
+
+		// recursive locking
+		GC::recursive_shared_mutex mutex;
+		{
+			std::lock_guard<GC::recursive_shared_mutex> a(mutex);
+			std::lock_guard<GC::recursive_shared_mutex> b(mutex);
+			std::shared_lock<GC::recursive_shared_mutex> c(mutex);
+		}
+		{
+			std::shared_lock<GC::recursive_shared_mutex> a(mutex);
+			std::shared_lock<GC::recursive_shared_mutex> b(mutex);
+			bool upgraded = mutex.try_lock();
+			assert(!upgraded); // shared holders can't upgrade
+		}
+		bool locked = mutex.try_lock();
+		assert(locked);
+		mutex.unlock();
+	}
+
+	{ // -- with_lock tests -- //
+		GC::ptr<GC::map<int, GC::ptr<int>>> map = GC::make<GC::map<int, GC::ptr<int>>>();
+		GC::vector<GC::ptr<int>> vec;
+
+		// find-or-insert from several threads - each key should only ever be inserted once
+		std::atomic<int> inserts(0);
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i) threads.emplace_back([map, &inserts]
+		{
+			for (int j = 0; j < 32; ++j) map->with_lock([&](auto &raw)
+			{
+				if (raw.find(j) == raw.end())
+				{
+					raw.emplace(j, GC::make<int>(j));
+					++inserts;
+				}
+			});
+		});
+		for (auto &t : threads) t.join();
+
+		assert(inserts == 32);
+		assert(map->size() == 32);
+
+		// return values are forwarded
+		vec.with_lock([](auto &raw) { for (int i = 0; i < 8; ++i) raw.push_back(GC::make<int>(i)); });
+		const GC::vector<GC::ptr<int>> &cvec = vec;
+		assert(cvec.with_lock([](const auto &raw) { return raw.size(); }) == 8);
+		GC::ptr<int> &back = vec.with_lock([](auto &raw) -> GC::ptr<int>& { return raw.back(); });
+		assert(*back == 7);
+	}
+
+	{ // -- concurrent_unordered_map tests -- //
+		typedef GC::concurrent_unordered_map<int, GC::ptr<int>> cmap_t;
+		GC::ptr<cmap_t> map = GC::make<cmap_t>(8);
+
+		// mutate from several threads while collecting
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i) threads.emplace_back([map, i]
+		{
+			for (int j = 0; j < 256; ++j)
+			{
+				int key = i * 256 + j;
+				bool inserted = map->try_emplace(key, GC::make<int>(key));
+				bool assigned_new = map->insert_or_assign(key, GC::make<int>(key * 2));
+				assert(inserted && !assigned_new);
+				if (j % 4 == 0)
+				{
+					std::size_t erased = map->erase(key);
+					assert(erased == 1);
+				}
+			}
+			GC::collect();
+		});
+		for (auto &t : threads) t.join();
+
+		GC::collect();
+		assert(map->size() == 4 * 192);
+		assert(!map->contains(0) && map->contains(1));
+		std::optional<GC::ptr<int>> one = map->get(1);
+		assert(one && **one == 2 && !map->get(4));
+
+		int sum = 0;
+		map->for_each([&sum](auto &entry) { assert(*entry.second == entry.first * 2); ++sum; });
+		assert(sum == 4 * 192);
+
+		bool visited = map->visit(1, [](GC::ptr<int> &v) { v = GC::make<int>(-1); });
+		assert(visited && !map->visit(4, [](GC::ptr<int>&) { assert(false); }));
+		assert(map->with_lock(1, [](auto &raw) { GC::ptr<int> &v = raw.at(1); return *v; }) == -1);
+
+		map->clear();
+		assert(map->empty());
+	}
+
+	{ // -- concurrent_queue tests -- //
+		typedef GC::concurrent_queue<GC::ptr<int>> queue_t;
+		GC::ptr<queue_t> queue = GC::make<queue_t>(100);
+		assert(queue->capacity() == 128);
+
+		// bounded
+		int pushed = 0;
+		for (int i = 0; i < 128; ++i) pushed += queue->try_push(GC::make<int>(i));
+		bool overfilled = queue->try_push(GC::make<int>(-1));
+		assert(pushed == 128 && !overfilled);
+		GC::collect(); // queued values are only reachable through the queue
+
+		GC::ptr<int> val;
+		for (int i = 0; i < 128; ++i) { bool popped = queue->try_pop(val); assert(popped && *val == i); }
+		bool underflowed = queue->try_pop(val);
+		assert(!underflowed && *val == 127);
+
+		// moving in leaves the source null
+		GC::ptr<int> src = GC::make<int>(7);
+		bool moved_in = queue->try_push(std::move(src));
+		assert(moved_in && src == nullptr);
+		bool moved_out = queue->try_pop(val);
+		assert(moved_out && *val == 7);
+
+		// several producers and consumers
+		std::atomic<int> popped(0), sum(0);
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 2; ++i) threads.emplace_back([queue]
+		{
+			for (int j = 1; j <= 1000; ++j) while (!queue->try_push(GC::make<int>(j))) std::this_thread::yield();
+		});
+		for (int i = 0; i < 2; ++i) threads.emplace_back([queue, &popped, &sum]
+		{
+			GC::ptr<int> v;
+			while (popped < 2000)
+			{
+				if (queue->try_pop(v)) { sum += *v; ++popped; }
+				else std::this_thread::yield();
+			}
+		});
+		for (int i = 0; i < 4; ++i) GC::collect();
+		for (auto &t : threads) t.join();
+
+		assert(popped == 2000 && sum == 1000 * 1001);
+		assert(queue->empty_approx());
+	}
+
+	{ // -- ptr_vector tests -- //
+		typedef GC::ptr_vector<int> vec_t;
+		GC::ptr<vec_t> vec = GC::make<vec_t>();
+
+		for (int i = 0; i < 100; ++i) vec->push_back(GC::make<int>(i));
+		vec->push_back(nullptr);
+		GC::collect(); // elements are only reachable through the vector
+
+		assert(vec->size() == 101 && (*vec)[100] == nullptr);
+		for (int i = 0; i < 100; ++i) { GC::ptr<int> v = vec->get(i); assert(*v == i && *(*vec)[i] == i); }
+
+		vec->erase(10, 20);
+		vec->erase(0);
+		vec->pop_back();
+		assert(vec->size() == 89 && *(*vec)[0] == 1 && *(*vec)[9] == 20);
+
+		vec->set(0, GC::make<int>(-1));
+		vec->resize(4);
+		vec->resize(6);
+		GC::collect();
+		assert(vec->size() == 6 && *(*vec)[0] == -1 && *(*vec)[3] == 4 && (*vec)[5] == nullptr);
+
+		// copies are deep, moves leave the source empty
+		vec_t copy = *vec;
+		vec->clear();
+		assert(vec->empty() && copy.size() == 6 && *copy[3] == 4);
+		vec_t moved = std::move(copy);
+		assert(copy.empty() && moved.size() == 6);
+
+		bool threw = false;
+		try { moved.at(6); }
+		catch (const std::out_of_range&) { threw = true; }
+		assert(threw);
+
+		// cycles through ptr_vectors are collected
+		{
+			GC::ptr<ptr_vector_node> a = GC::make<ptr_vector_node>(), b = GC::make<ptr_vector_node>();
+			a->children.push_back(b);
+			b->children.push_back(a);
+			b->children.push_back(b);
+			assert(ptr_vector_node::alive == 2);
+		}
+		collect_until([] { return ptr_vector_node::alive == 0; });
+
+		// elements handed between vectors during collections must not be lost (raw arc write barrier)
+		GC::ptr<vec_t> other = GC::make<vec_t>(64);
+		for (int i = 0; i < 64; ++i) vec->push_back(GC::make<int>(i));
+		std::atomic<bool> done(false);
+		std::thread mutator([vec, other, &done]
+		{
+			for (int i = 0; i < 64 * 300; ++i)
+			{
+				vec_t &from = i / 64 % 2 ? *other : *vec, &to = i / 64 % 2 ? *vec : *other;
+				to.set(i % 64, from.get(i % 64));
+				from.set(i % 64, nullptr);
+			}
+			done = true;
+		});
+		while (!done) GC::collect();
+		mutator.join();
+		for (int i = 0; i < 64; ++i) assert(*(*vec)[i] == i && (*other)[i] == nullptr);
+
+		// objects created during a collection can be handed to the marker by raw arcs, and removed elements must outlive any collection until released.
+		// (run under a sanitizer to catch uninitialized marks and premature sweeps).
+		done = false;
+		std::thread collector([&done] { while (!done) GC::collect(); });
+		for (int i = 0; i < 64 * 300; ++i)
+		{
+			if (i % 64 == 0) { other->resize(0); other->resize(64); }
+			other->set(i % 64, GC::make<int>(i));
+		}
+		done = true;
+		collector.join();
+		GC::collect();
+		for (int i = 0; i < 64; ++i) assert(*(*other)[i] == 64 * 299 + i);
+	}
+
+	{ // -- obj add cache ref count deletion tests -- //
+		GC::ptr<GC::vector<GC::ptr<int>>> vec = GC::make<GC::vector<GC::ptr<int>>>();
+		std::atomic<bool> done(false);
+
+		// objects created and dropped during a collection can still be the raw value of handles whose repoints are cached.
+		// the collector must not be able to route to them after they've been deleted (run under a sanitizer to catch it).
+		std::thread collector([&done] { while (!done) GC::collect(); });
+		for (int i = 0; i < 20000; ++i)
+		{
+			vec->push_back(GC::make<int>(i));
+			vec->back() = GC::make<int>(-i);
+			if (vec->size() >= 64) vec->clear();
+		}
+		done = true;
+		collector.join();
+
+		for (const auto &i : *vec) assert(*i <= 0);
+	}
+
+	{ // -- persistent_map tests -- //
+		typedef GC::persistent_map<int, GC::ptr<int>> map_t;
+
+		map_t empty;
+		map_t map = empty;
+		for (int i = 0; i < 2000; ++i) map = map.set(i, GC::make<int>(i));
+		GC::collect(); // values are only reachable through the map's nodes
+
+		assert(empty.empty() && map.size() == 2000);
+		for (int i = 0; i < 2000; ++i) assert(**map.find(i) == i);
+		assert(!map.contains(2000) && map.find(-1) == nullptr);
+
+		// updates don't modify previous versions
+		map_t updated = map.set(5, GC::make<int>(-5)).erase(6).erase(12345);
+		assert(updated.size() == 1999 && *updated.at(5) == -5 && !updated.contains(6));
+		assert(map.size() == 2000 && *map.at(5) == 5 && *map.at(6) == 6);
+
+		for (int i = 0; i < 2000; i += 2) updated = updated.erase(i);
+		assert(updated.size() == 1000);
+		int sum = 0;
+		updated.for_each([&](const map_t::value_type &entry) { assert(entry.first % 2 == 1); sum += *entry.second; });
+		assert(sum == 1000 * 1000 - 10); // 5 was replaced with -5
+
+		// collision nodes
+		GC::persistent_map<int, int, poor_hash> collide;
+		for (int i = 0; i < 100; ++i) collide = collide.set(i, i * 2);
+		for (int i = 0; i < 100; i += 3) collide = collide.erase(i);
+		assert(collide.size() == 66);
+		for (int i = 0; i < 100; ++i) assert(i % 3 == 0 ? !collide.contains(i) : collide.at(i) == i * 2);
+
+		// old versions are reclaimed
+		{
+			GC::persistent_map<int, alive_counter> counted;
+			for (int i = 0; i < 100; ++i) counted = counted.set(i, alive_counter());
+			counted = counted.erase(0);
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- persistent_vector tests -- //
+		typedef GC::persistent_vector<GC::ptr<int>> vec_t;
+
+		vec_t::transient builder;
+		for (int i = 0; i < 1000; ++i) builder.push_back(GC::make<int>(i));
+		vec_t vec = builder.persistent();
+
+		vec_t pushed;
+		for (int i = 0; i < 1000; ++i) pushed = pushed.push_back(GC::make<int>(i));
+		GC::collect(); // elements are only reachable through the nodes
+
+		assert(vec.size() == 1000 && pushed.size() == 1000);
+		for (int i = 0; i < 1000; ++i) assert(*vec[i] == i && *pushed.at(i) == i);
+
+		// updates don't modify previous versions
+		vec_t updated = vec.set(500, GC::make<int>(-1)).pop_back();
+		assert(updated.size() == 999 && *updated[500] == -1 && *updated.back() == 998);
+		assert(vec.size() == 1000 && *vec[500] == 500);
+
+		// slicing and concatenation
+		vec_t slice = vec.slice(100, 900);
+		assert(slice.size() == 800 && *slice.front() == 100 && *slice.back() == 899);
+
+		vec_t joined = vec.slice(500, 1000).concat(vec.slice(0, 500));
+		assert(joined.size() == 1000);
+		for (int i = 0; i < 1000; ++i) assert(*joined[i] == (i + 500) % 1000);
+		for (int i = 0; i < 50; ++i) joined = joined.slice(1, joined.size()).concat(joined.slice(0, 1));
+		int expected = 550;
+		joined.for_each([&](const GC::ptr<int> &v) { assert(*v == expected % 1000); ++expected; });
+
+		bool threw = false;
+		try { (void)vec.slice(10, 1001); }
+		catch (const std::out_of_range&) { threw = true; }
+		assert(threw && vec.slice(10, 10).empty());
+
+		// transients can start from an existing vector
+		vec_t::transient more(slice);
+		for (int i = 0; i < 100; ++i) more.push_back(GC::make<int>(i));
+		vec_t extended = more.persistent();
+		assert(extended.size() == 900 && *extended[799] == 899 && *extended[899] == 99);
+
+		// old versions are reclaimed
+		{
+			GC::persistent_vector<alive_counter> counted;
+			for (int i = 0; i < 100; ++i) counted = counted.push_back(alive_counter());
+			counted = counted.slice(10, 20);
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- small_vector tests -- //
+		typedef GC::small_vector<GC::ptr<int>, 4> vec_t;
+
+		GC::ptr<vec_t> vec = GC::make<vec_t>();
+		for (int i = 0; i < 3; ++i) vec->push_back(GC::make<int>(i));
+		assert(vec->size() == 3 && vec->capacity() == vec_t::inline_capacity());
+		GC::collect(); // elements are only reachable through the (inline) vector
+		for (int i = 0; i < 3; ++i) assert(*(*vec)[i] == i);
+
+		for (int i = 3; i < 10; ++i) vec->push_back(GC::make<int>(i));
+		assert(vec->size() == 10 && vec->capacity() >= 10);
+		GC::collect(); // now they're on the heap
+		for (int i = 0; i < 10; ++i) assert(*vec->at(i) == i);
+
+		vec->insert(vec->begin() + 2, GC::make<int>(-2));
+		vec->erase(vec->begin(), vec->begin() + 2);
+		vec->emplace(vec->end(), GC::make<int>(-10));
+		assert(vec->size() == 10 && *vec->front() == -2 && *vec->back() == -10 && *(*vec)[1] == 2);
+
+		vec->resize(3);
+		vec->shrink_to_fit(); // moves back inline
+		assert(vec->size() == 3 && vec->capacity() == vec_t::inline_capacity());
+		GC::collect();
+		assert(*(*vec)[0] == -2 && *(*vec)[2] == 3);
+
+		// swapping and moving between inline and heap storage
+		vec_t big;
+		for (int i = 0; i < 8; ++i) big.push_back(GC::make<int>(100 + i));
+		vec->swap(big);
+		assert(vec->size() == 8 && big.size() == 3 && *(*vec)[7] == 107 && *big[0] == -2);
+		vec_t moved = std::move(big);
+		assert(moved.size() == 3 && big.empty() && *moved[1] == 2);
+		*vec = moved;
+		GC::collect();
+		assert(*vec == moved && vec->size() == 3 && *(*vec)[2] == 3);
+
+		bool threw = false;
+		try { (void)vec->at(3); }
+		catch (const std::out_of_range&) { threw = true; }
+		assert(threw);
+
+		// the fill value can be one of the elements being relocated
+		vec_t filled(2, GC::make<int>(7));
+		filled.resize(16, filled[0]);
+		assert(filled.size() == 16 && std::all_of(filled.begin(), filled.end(), [&](const GC::ptr<int> &p) { return p == filled[0]; }));
+		vec_t copied(filled);
+		assert(copied == filled);
+
+		// copy assignment reads the source under its lock while it's being modified
+		{
+			GC::ptr<vec_t> src = GC::make<vec_t>();
+			std::atomic<bool> done(false);
+			std::thread writer([src, &done]
+			{
+				for (int i = 0; i < 2000; ++i)
+				{
+					if (i % 20 < 10) src->push_back(GC::make<int>(i));
+					else src->pop_back();
+				}
+				done = true;
+			});
+			vec_t dest;
+			while (!done)
+			{
+				dest = *src;
+				assert(std::all_of(dest.begin(), dest.end(), [](const GC::ptr<int> &p) { return p != nullptr; }));
+			}
+			writer.join();
+			dest = *src;
+			assert(dest == *src && dest.empty());
+		}
+
+		vec_t list = { GC::make<int>(1), GC::make<int>(2) };
+		std::size_t sum = 0;
+		list.with_lock([&](vec_t &v) { for (const auto &p : v) sum += *p; });
+		assert(sum == 3);
+
+		// unreachable vectors release their elements
+		{
+			GC::ptr<GC::small_vector<GC::ptr<alive_counter>, 2>> counted = GC::make<GC::small_vector<GC::ptr<alive_counter>, 2>>();
+			for (int i = 0; i < 5; ++i) counted->push_back(GC::make<alive_counter>());
+			counted->erase(counted->begin() + 1);
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- flat_map tests -- //
+		typedef GC::flat_map<int, GC::ptr<int>> map_t;
+
+		GC::ptr<map_t> map = GC::make<map_t>();
+		int inserted = 0;
+		for (int i = 0; i < 100; i += 2) inserted += map->insert(i, GC::make<int>(i)).second;
+		bool reinserted = map->insert(10, GC::make<int>(-1)).second;
+		assert(inserted == 50 && !reinserted);
+		GC::collect(); // values are only reachable through the map
+
+		assert(map->size() == 50 && std::is_sorted(map->keys().begin(), map->keys().end()));
+		for (int i = 0; i < 100; ++i) assert(map->contains(i) == (i % 2 == 0) && (!map->contains(i) || *map->at(i) == i));
+		assert(map->find(7) == nullptr && map->count(8) == 1);
+
+		// bulk insertion of an unsorted batch with duplicates (existing keys and first occurrences win)
+		std::vector<std::pair<int, GC::ptr<int>>> batch;
+		for (int i = 99; i >= 1; i -= 2) batch.emplace_back(i, GC::make<int>(i));
+		batch.emplace_back(1, GC::make<int>(-1));
+		batch.emplace_back(0, GC::make<int>(-1));
+		map->insert(batch.begin(), batch.end());
+		batch.clear();
+		GC::collect();
+
+		assert(map->size() == 100);
+		for (int i = 0; i < 100; ++i) assert(map->keys()[i] == i && *map->values()[i] == i);
+
+		// sorted loading appends
+		map->insert({ { 100, GC::make<int>(100) }, { 101, GC::make<int>(101) } });
+		assert(map->size() == 102 && *map->at(101) == 101);
+
+		std::size_t erased = map->erase(50);
+		std::size_t reerased = map->erase(50);
+		assert(erased == 1 && reerased == 0 && map->size() == 101);
+		map->insert_or_assign(0, GC::make<int>(1000));
+		(*map)[200] = GC::make<int>(200);
+		int sum = 0;
+		map->for_each([&](int k, GC::ptr<int> &v) { if (k != 0) { assert(*v == k); sum += *v; } });
+		assert(sum == 101 * 102 / 2 - 50 + 200 && *map->at(0) == 1000);
+
+		bool threw = false;
+		try { (void)map->at(50); }
+		catch (const std::out_of_range&) { threw = true; }
+		assert(threw);
+
+		map_t copy = *map;
+		assert(copy == *map);
+		map_t moved = std::move(copy);
+		assert(moved == *map && copy.empty());
+
+		// a bulk insertion that throws part way (merging or appending) leaves the map as it was
+		for (int n = 1; n < 80; ++n)
+		{
+			for (int first : { 1, 100 })
+			{
+				GC::flat_map<int, countdown_thrower> values;
+				for (int i = 0; i < 20; i += 2) values.insert(i, countdown_thrower(i));
+				std::vector<std::pair<int, countdown_thrower>> values_batch;
+				for (int i = first; i < first + 20; i += 2) values_batch.emplace_back(i, countdown_thrower(i));
+
+				countdown_thrower::countdown = n;
+				bool values_threw = false;
+				try { values.insert(values_batch.begin(), values_batch.end()); }
+				catch (const std::runtime_error&) { values_threw = true; }
+				countdown_thrower::countdown = 0;
+
+				assert(values.keys().size() == values.values().size() && values.size() == (values_threw ? 10 : 20));
+				for (std::size_t i = 0; i < values.size(); ++i) assert(values.values()[i].value == values.keys()[i]);
+				if (values_threw) for (int i = 0; i < 20; ++i) assert(values.contains(i) == (i % 2 == 0));
+			}
+		}
+
+		// unreachable maps release their values
+		{
+			GC::ptr<GC::flat_map<int, GC::ptr<alive_counter>>> counted = GC::make<GC::flat_map<int, GC::ptr<alive_counter>>>();
+			for (int i = 0; i < 10; ++i) counted->try_emplace(i, GC::make<alive_counter>());
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- wrapper routing tests -- //
+		GC::ptr<GC::vector<GC::ptr<route_blocker>>> vec = GC::make<GC::vector<GC::ptr<route_blocker>>>();
+		vec->push_back(GC::make<route_blocker>());
+
+		route_blocker::armed = true;
+		std::thread collector([] { while (!route_blocker::entered) GC::collect(); });
+		while (!route_blocker::entered) std::this_thread::yield();
+
+		// a collector is now marking through the vector's contents - writers should not be blocked by it
+		for (int i = 0; i < 100; ++i) vec->push_back(GC::make<route_blocker>());
+		vec->erase(vec->begin() + 1, vec->end());
+		route_blocker::released = true;
+		collector.join();
+
+		assert(!route_blocker::timed_out && vec->size() == 1);
+	}
+
+	{ // -- handle destruction barrier tests -- //
+		GC::ptr<arc_route_blocker> holder = GC::make<arc_route_blocker>();
+		holder->arcs.push_back(GC::make<ptr_vector_node>());
+		const int alive = ptr_vector_node::alive;
+
+		arc_route_blocker::armed = true;
+		std::thread collector([] { while (!arc_route_blocker::entered) GC::collect(); });
+		while (!arc_route_blocker::entered) std::this_thread::yield();
+
+		// the collector hasn't routed through the arc yet - copy its target into a handle created after the roots were gathered, then destroy the arc
+		GC::ptr<ptr_vector_node> moved = holder->arcs[0];
+		holder->arcs.clear();
+		arc_route_blocker::released = true;
+		collector.join();
+
+		// the target was reachable the whole time, so the collection must not have swept it
+		assert(ptr_vector_node::alive == alive);
+		moved = nullptr;
+		collect_until([alive] { return ptr_vector_node::alive == alive - 1; });
+	}
+
+	{ // -- compact lockable tests -- //
+		static_assert(sizeof(GC::compact_recursive_mutex) == 1, "compact lockable size assumption failure");
+		static_assert(sizeof(GC::optional<GC::ptr<int>, GC::compact_recursive_mutex>) < sizeof(GC::optional<GC::ptr<int>, std::recursive_mutex>), "compact lockable size assumption failure");
+
+		typedef GC::vector<GC::ptr<int>, std::allocator<GC::ptr<int>>, GC::compact_recursive_mutex> compact_vec_t;
+
+		// mutate from several threads while collecting
+		GC::ptr<compact_vec_t> vec = GC::make<compact_vec_t>();
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i) threads.emplace_back([vec]
+		{
+			for (int j = 0; j < 256; ++j)
+			{
+				vec->push_back(GC::make<int>(j));
+				if (j % 64 == 0) GC::collect();
+			}
+		});
+		for (auto &t : threads) t.join();
+
+		GC::collect();
+		int sum = 0;
+		for (const auto &p : *vec) sum += *p;
+		assert(vec->size() == 1024 && sum == 4 * 255 * 256 / 2);
+
+		// recursive locking (more distinct mutexes than the held list stores inline)
+		GC::compact_recursive_mutex mutexes[20];
+		for (auto &m : mutexes) { m.lock(); m.lock(); }
+		for (auto &m : mutexes) { bool locked = m.try_lock(); assert(locked); }
+		std::thread([&] { for (auto &m : mutexes) { bool locked = m.try_lock(); assert(!locked); } }).join();
+		for (auto &m : mutexes) { m.unlock(); m.unlock(); m.unlock(); }
+		std::thread([&] { for (auto &m : mutexes) { bool locked = m.try_lock(); assert(locked); m.unlock(); } }).join();
+
+		// holders that sleep force waiters to park
+		GC::compact_recursive_mutex mutex;
+		int counter = 0;
+		threads.clear();
+		for (int i = 0; i < 4; ++i) threads.emplace_back([&mutex, &counter]
+		{
+			for (int j = 0; j < 200; ++j)
+			{
+				std::lock_guard<GC::compact_recursive_mutex> lock(mutex);
+				++counter;
+				if (j % 50 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			}
+		});
+		for (auto &t : threads) t.join();
+		assert(counter == 800);
+	}
+
+	{ // -- frozen tests -- //
+		static_assert(std::is_same<GC::frozen<GC::vector<GC::ptr<int>>>, GC::frozen<std::vector<GC::ptr<int>>>>::value, "frozen type error");
+
+		GC::vector<GC::ptr<int>> builder;
+		for (int i = 0; i < 100; ++i) builder.push_back(GC::make<int>(i));
+
+		GC::frozen<GC::vector<GC::ptr<int>>> frozen = GC::freeze(std::move(builder));
+		GC::frozen<GC::map<int, GC::ptr<int>>> frozen_map(std::in_place, std::map<int, GC::ptr<int>>{ { 1, GC::make<int>(1) }, { 2, GC::make<int>(2) } });
+		GC::collect(); // contents are only reachable through the frozen blocks
+
+		assert(frozen->size() == 100 && frozen_map->size() == 2);
+		for (int i = 0; i < 100; ++i) assert(*(*frozen)[i] == i);
+		assert(*frozen_map->at(2) == 2);
+
+		// copies share contents
+		GC::frozen<GC::vector<GC::ptr<int>>> copy = frozen;
+		assert(same_contents(copy, frozen) && copy == frozen);
+		assert(GC::freeze(*frozen) == frozen && !same_contents(GC::freeze(*frozen), frozen));
+
+		// frozen objects inside gc objects and mutable containers
+		GC::ptr<GC::vector<GC::frozen<std::vector<GC::ptr<int>>>>> vec = GC::make<GC::vector<GC::frozen<std::vector<GC::ptr<int>>>>>();
+		for (int i = 0; i < 10; ++i) vec->push_back(frozen);
+		vec->emplace_back(std::in_place, 3, GC::make<int>(-1));
+		frozen = GC::frozen<GC::vector<GC::ptr<int>>>();
+		copy = frozen;
+		GC::collect();
+		assert(frozen->empty() && (*vec)[0]->size() == 100 && *(*vec)[9]->back() == 99 && *(*vec)[10]->front() == -1);
+
+		// unreachable frozen contents are reclaimed
+		{
+			std::vector<GC::ptr<alive_counter>> values;
+			for (int i = 0; i < 10; ++i) values.push_back(GC::make<alive_counter>());
+			GC::ptr<GC::vector<GC::frozen<std::vector<GC::ptr<alive_counter>>>>> holder = GC::make<GC::vector<GC::frozen<std::vector<GC::ptr<alive_counter>>>>>();
+			holder->push_back(GC::freeze(std::move(values)));
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- intern_table tests -- //
+		GC::intern_table<std::string> strings;
+		GC::ptr<const std::string> hello = strings.intern("hello"), hello2 = strings.intern(std::string("hello")), world = strings.intern("world");
+		assert(hello == hello2 && hello != world && *hello == "hello" && *world == "world");
+		assert(strings.find("hello") == hello && !strings.find("nope") && strings.size() == 2);
+		GC::collect(); // entries are weak, but the objects are still held
+		std::size_t purged = strings.purge();
+		assert(strings.find("world") == world && purged == 0);
+
+		#if DRAGAZO_GARBAGE_COLLECT_DISJUNCTION_SAFETY_CHECKS
+		GC::thread(GC::new_disjunction, [&strings]
+		{
+			try { strings.intern("hello"); assert(false); }
+			catch (const GC::disjunction_error&) {}
+			try { strings.purge(); assert(false); }
+			catch (const GC::disjunction_error&) {}
+		}).join();
+		#endif
+
+		// entries expire when their objects die by reference counting (collisions included)
+		GC::intern_table<int, poor_hash> ints;
+		std::vector<GC::ptr<const int>> held;
+		for (int i = 0; i < 30; ++i) held.push_back(ints.intern(i));
+		for (int i = 0; i < 30; ++i) { GC::ptr<const int> p = ints.intern(i); assert(p == held[i] && *p == i); }
+		held.resize(10);
+		assert(ints.size() == 30);
+		purged = ints.purge();
+		assert(purged == 20 && ints.size() == 10);
+		for (int i = 0; i < 10; ++i) assert(ints.find(i) == held[i]);
+		assert(!ints.find(15));
+		{ GC::ptr<const int> p = ints.intern(15); assert(p && *p == 15 && ints.size() == 11); }
+
+		// entries expire when their objects are collected (cycles through interned objects)
+		{
+			GC::intern_table<interned_node, interned_node_hash> nodes;
+			for (int i = 0; i < 10; ++i)
+			{
+				GC::ptr<const interned_node> n = nodes.intern(interned_node(i));
+				n->back->push_back(n);
+				GC::ptr<const interned_node> again = nodes.intern(interned_node(i));
+				assert(again == n);
+			}
+			assert(nodes.size() == 10);
+			collect_until([] { return interned_node::alive == 0; });
+			purged = nodes.purge();
+			assert(purged == 10 && nodes.size() == 0);
+
+			GC::ptr<const interned_node> n = nodes.intern(interned_node(3));
+			assert(n->key == 3 && nodes.find(interned_node(3)) == n);
+		}
+		collect_until([] { return interned_node::alive == 0; });
+
+		// concurrent interning yields a single canonical object
+		{
+			GC::intern_table<int> shared;
+			std::vector<GC::ptr<const int>> results(8);
+			std::vector<GC::thread> threads;
+			for (std::size_t i = 0; i < results.size(); ++i) threads.emplace_back(GC::inherit_disjunction, [&shared, &results, i]
+			{
+				for (int j = 0; j < 1000; ++j)
+				{
+					GC::ptr<const int> p = shared.intern(j % 50);
+					if (j == 1000 - 1) results[i] = p;
+				}
+			});
+			for (auto &t : threads) t.join();
+			for (const auto &p : results) assert(p == results[0] && *p == (1000 - 1) % 50);
+		}
+
+		// colliding lookups race with their objects dying by reference counting
+		{
+			GC::intern_table<int, poor_hash> churn;
+			std::vector<GC::thread> threads;
+			for (int i = 0; i < 4; ++i) threads.emplace_back(GC::inherit_disjunction, [&churn, i]
+			{
+				for (int j = 0; j < 2000; ++j)
+				{
+					GC::ptr<const int> p = churn.intern((i + j) % 40);
+					assert(*p == (i + j) % 40);
+					if (j % 100 == 0) churn.purge();
+				}
+			});
+			for (auto &t : threads) t.join();
+			churn.purge();
+			assert(churn.size() == 0);
+		}
+	}
+
+	{ // -- long chain marking tests -- //
+		// long enough that marking it recursively would overflow the collector's stack
+		GC::ptr<chain_node> head;
+		for (int i = 0; i < 200000; ++i)
+		{
+			GC::ptr<chain_node> node = GC::make<chain_node>();
+			node->next = head;
+			head = node;
+		}
+
+		for (int i = 0; i < 3; ++i) GC::collect();
+
+		int len = 0;
+		for (const chain_node *n = head.get(); n; n = n->next.get()) ++len;
+		assert(len == 200000);
+
+		// tear it down from the front, unlinking as we go so the destructors don't recurse either
+		while (head)
+		{
+			GC::ptr<chain_node> next = head->next;
+			head->next = nullptr;
+			head = next;
+		}
+	}
+
+	{ // -- intrusive container tests -- //
+		typedef GC::intrusive_list<hooked_node, &hooked_node::order> node_list;
+		typedef GC::intrusive_set<hooked_node, &hooked_node::index, hooked_node_less> node_set;
+
+		auto keys = [](const node_list &list)
+		{
+			std::vector<int> res;
+			for (const hooked_node &n : list) res.push_back(n.key);
+			return res;
+		};
+
+		{
+			node_list list;
+			node_set set;
+			for (int i = 0; i < 5; ++i)
+			{
+				GC::ptr<hooked_node> n = GC::make<hooked_node>(i);
+				list.push_back(n);
+				bool inserted = set.insert(n).second;
+				assert(inserted);
+			}
+			GC::collect(); // the elements are only reachable through the containers
+			assert(list.size() == 5 && set.size() == 5 && (keys(list) == std::vector<int>{ 0, 1, 2, 3, 4 }));
+			assert(list.front().key == 0 && list.back().key == 4 && (--list.end())->key == 4);
+
+			// lru-style reordering
+			list.move_to_front(*set.find(3));
+			list.move_to_back(*set.find(0));
+			list.move_to_front(list.front());
+			assert((keys(list) == std::vector<int>{ 3, 1, 2, 4, 0 }));
+
+			// unlinking returns the owning pointer
+			GC::ptr<hooked_node> two = list.erase(*set.find(2));
+			assert(two->key == 2 && !two->order.is_linked() && two->index.is_linked());
+			assert((keys(list) == std::vector<int>{ 3, 1, 4, 0 }));
+			list.insert(std::next(list.cbegin()), two);
+			assert((keys(list) == std::vector<int>{ 3, 2, 1, 4, 0 }) && list.ptr_to(*two) == two);
+
+			try { list.push_back(two); assert(false); }
+			catch (const std::invalid_argument&) {}
+			bool inserted = set.insert(GC::make<hooked_node>(2)).second;
+			assert(!inserted && set.size() == 5 && set.find(2) == two.get() && !set.find(7) && set.contains(4));
+
+			GC::ptr<hooked_node> first = list.pop_front(), last = list.pop_back();
+			assert(first->key == 3 && last->key == 0 && list.size() == 3);
+			list.erase(list.cbegin());
+			assert((keys(list) == std::vector<int>{ 1, 4 }));
+		}
+		collect_until([] { return hooked_node::alive == 0; });
+
+		// random inserts/erases keep the set ordered
+		{
+			node_set set;
+			std::set<int> expected;
+			std::minstd_rand rng(94);
+			for (int i = 0; i < 5000; ++i)
+			{
+				int key = (int)(rng() % 1000);
+				if (rng() % 3)
+				{
+					bool inserted = set.insert(GC::make<hooked_node>(key)).second;
+					bool expected_inserted = expected.insert(key).second;
+					assert(inserted == expected_inserted);
+				}
+				else if (hooked_node *n = set.find(key))
+				{
+					GC::ptr<hooked_node> erased = set.erase(*n);
+					assert(erased->key == key);
+					expected.erase(key);
+				}
+				else assert(expected.count(key) == 0);
+			}
+			assert(set.size() == expected.size());
+			assert(std::equal(set.begin(), set.end(), expected.begin(), expected.end(), [](const hooked_node &n, int k) { return n.key == k; }));
+			assert(std::equal(std::make_reverse_iterator(set.end()), std::make_reverse_iterator(set.begin()), expected.rbegin(), expected.rend(), [](const hooked_node &n, int k) { return n.key == k; }));
+			assert(set.lower_bound(500) == std::find_if(set.begin(), set.end(), [](const hooked_node &n) { return n.key >= 500; }));
+
+			for (auto i = set.cbegin(); i != set.cend(); ) i = i->key % 2 ? set.erase(i) : std::next(i);
+			for (const hooked_node &n : set) assert(n.key % 2 == 0);
+		}
+		collect_until([] { return hooked_node::alive == 0; });
+
+		// containers inside gc objects, cycles through the elements, and long chains
+		{
+			GC::ptr<node_list> list = GC::make<node_list>();
+			GC::ptr<node_set> set = GC::make<node_set>();
+			for (int i = 0; i < 100000; ++i)
+			{
+				GC::ptr<hooked_node> n = GC::make<hooked_node>(i);
+				n->other = n;
+				list->push_back(n);
+				set->insert(n);
+			}
+			GC::collect();
+			assert(list->size() == 100000 && set->size() == 100000 && set->find(99999)->key == 99999);
+
+			GC::ptr<hooked_node> found = set->ptr_to(*set->find(500));
+			assert(found->key == 500);
+		}
+		collect_until([] { return hooked_node::alive == 0; });
+		{
+			node_list list;
+			for (int i = 0; i < 100000; ++i) list.push_back(GC::make<hooked_node>(i));
+		}
+		collect_until([] { return hooked_node::alive == 0; });
+
+		// containers local to a destructor run by the collector aren't being swept, so they still unlink their elements
+		{
+			GC::ptr<sweep_time_unlinker> u = GC::make<sweep_time_unlinker>();
+			u->self = u;
+		}
+		collect_until([] { return sweep_time_unlinker::result != 0; });
+		assert(sweep_time_unlinker::result == 1);
+		collect_until([] { return hooked_node::alive == 0; });
+	}
+
+	{ // -- function tests -- //
+		GC::function<int(int)> f;
+		assert(!f && f == nullptr);
+		try { f(1); assert(false); }
+		catch (const std::bad_function_call&) {}
+
+		f = [](int x) { return x * 2; };
+		assert(f && f(4) == 8);
+		int(*null_fn)(int) = nullptr;
+		f = null_fn;
+		assert(!f);
+		f = +[](int x) { return x + 1; };
+
+		GC::function<int(int)> g = f, h = std::move(g);
+		assert(f(1) == 2 && !g && h(2) == 3);
+		g = [](int x) { return -x; };
+		swap(g, h);
+		assert(g(5) == 6 && h(5) == -5);
+		h = nullptr;
+		assert(h == nullptr);
+
+		// closures route their captures (inline and heap storage)
+		GC::ptr<int> counter = GC::make<int>(0);
+		GC::function<void(int)> add = GC::closure([](GC::ptr<int> &c, int v) { *c += v; }, counter);
+		GC::function<void(int)> add_all = GC::closure([](GC::ptr<int> &a, GC::ptr<int> &b, GC::ptr<int> &c, GC::ptr<int> &d, int v) { *a += v; *b += v; *c += v; *d += v; }, counter, counter, counter, counter);
+		GC::function<void(int)> add_copy = add;
+		add(1);
+		add_copy(2);
+		add_all(3);
+		GC::collect();
+		assert(*counter == 15);
+
+		// cycles through callbacks are reclaimed
+		{
+			GC::ptr<handler_node> a = GC::make<handler_node>(), b = GC::make<handler_node>();
+			a->on_event = GC::closure([](GC::ptr<handler_node> &self, GC::ptr<handler_node> &next, int v)
+			{
+				self->total += v;
+				if (v > 0) next->on_event(v - 1);
+			}, a, b);
+			b->on_event = GC::closure([](GC::ptr<handler_node> &self, GC::ptr<handler_node> &next, GC::ptr<handler_node> &first, GC::ptr<handler_node> &second, int v)
+			{
+				self->total += v;
+				if (v > 0) next->on_event(v - 1);
+				assert(first && second);
+			}, b, a, a, b);
+			a->on_event(3);
+			GC::collect();
+			assert(a->total == 4 && b->total == 2);
+
+			GC::ptr<GC::vector<GC::function<void()>>> handlers = GC::make<GC::vector<GC::function<void()>>>();
+			handlers->push_back(GC::closure([](GC::ptr<handler_node> &n, GC::ptr<GC::vector<GC::function<void()>>> &owner) { n->total = (int)owner->size(); }, a, handlers));
+			a->on_event = GC::closure([](GC::ptr<GC::vector<GC::function<void()>>> &h, int) { (*h)[0](); }, handlers);
+			a->on_event(0);
+			assert(a->total == 1);
+		}
+		collect_until([] { return handler_node::alive == 0; });
+	}
+
+	{ // -- ring_buffer tests -- //
+		GC::ring_buffer<int> ints(4);
+		for (int i = 1; i <= 6; ++i) ints.push_back(i);
+		assert(ints.full() && ints.size() == 4 && ints.capacity() == 4 && ints.front() == 3 && ints.back() == 6 && ints[1] == 4);
+		try { ints.at(4); assert(false); }
+		catch (const std::out_of_range&) {}
+		try { GC::ring_buffer<int> bad(0); assert(false); }
+		catch (const std::invalid_argument&) {}
+
+		int popped = ints.pop_front();
+		assert(popped == 3 && ints.size() == 3 && !ints.full());
+		ints.push_back(7);
+		ints.push_back(8);
+		assert(ints.front() == 5 && ints.back() == 8 && ints.with_lock([](auto &b) { return b.size(); }) == 4);
+		GC::ring_buffer<int> ints_copy = ints;
+		ints.clear();
+		assert(ints.empty() && ints.capacity() == 4 && ints_copy.size() == 4 && ints_copy[3] == 8);
+		GC::ring_buffer<int> ints_moved = std::move(ints_copy);
+		assert(ints_moved.size() == 4 && ints_copy.capacity() == 0);
+		ints_copy.push_back(1);
+		assert(ints_copy.empty());
+
+		// overwritten and popped elements are reclaimed
+		{
+			GC::ptr<GC::ring_buffer<GC::ptr<alive_counter>>> buf = GC::make<GC::ring_buffer<GC::ptr<alive_counter>>>(8);
+			for (int i = 0; i < 100; ++i) buf->push_back(GC::make<alive_counter>());
+			collect_until([] { return alive_counter::alive == 8; });
+
+			GC::ptr<alive_counter> oldest = buf->pop_front();
+			buf->pop_front();
+			collect_until([] { return alive_counter::alive == 7; });
+			assert(oldest);
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+
+		// cycles through (un)synchronized buffers are reclaimed
+		{
+			GC::ptr<stream_node<GC::default_lockable_t>> a = GC::make<stream_node<GC::default_lockable_t>>(1);
+			GC::ptr<stream_node<GC::null_lockable>> b = GC::make<stream_node<GC::null_lockable>>(2);
+			for (int i = 0; i < 10; ++i)
+			{
+				a->recent.push_back(a);
+				b->recent.push_back(b);
+			}
+			a->recent.pop_front();
+			b->recent.pop_front();
+			GC::collect();
+			assert(a->recent.size() == 3 && a->recent.front() == a && b->recent.size() == 3 && b->recent.back() == b);
+		}
+		collect_until([] { return stream_node<GC::default_lockable_t>::alive == 0 && stream_node<GC::null_lockable>::alive == 0; });
+
+		// an unsynchronized buffer can be pushed to while it's being collected
+		{
+			GC::ptr<stream_node<GC::null_lockable>> node = GC::make<stream_node<GC::null_lockable>>(0);
+			std::atomic<bool> done{ false };
+			std::thread collector([&done] { while (!done) GC::collect(); });
+			for (int i = 1; i <= 20000; ++i) node->recent.push_back(GC::make<stream_node<GC::null_lockable>>(i));
+			done = true;
+			collector.join();
+
+			for (int i = 0; i < 4; ++i)
+			{
+				GC::ptr<stream_node<GC::null_lockable>> n = node->recent[i];
+				assert(n->value == 20000 - 3 + i);
+			}
+		}
+		collect_until([] { return stream_node<GC::null_lockable>::alive == 0; });
+	}
+
+	{ // -- csr_graph tests -- //
+		GC::csr_graph<int> graph({ 10, 20, 30, 40 }, { { 0, 1 }, { 0, 2 }, { 2, 3 }, { 3, 0 }, { 0, 3 } });
+		assert(graph.vertex_count() == 4 && graph.edge_count() == 5 && graph[2] == 30 && graph.vertex(3) == 40);
+		assert(graph.degree(0) == 3 && graph.neighbors(1).empty() && graph.neighbors(3).size() == 1 && graph.neighbors(3)[0] == 0);
+		assert((std::vector<std::size_t>(graph.neighbors(0).begin(), graph.neighbors(0).end()) == std::vector<std::size_t>{ 1, 2, 3 }));
+
+		try { graph.rebuild_edges({ { 0, 4 } }); assert(false); }
+		catch (const std::out_of_range&) {}
+		try { graph.vertex(4); assert(false); }
+		catch (const std::out_of_range&) {}
+		assert(graph.edge_count() == 5);
+
+		int sum = 0;
+		graph.for_each_vertex([&sum](std::size_t i, int &v, auto neighbors) { sum += v * (int)neighbors.size(); v += (int)i; });
+		assert(sum == 10 * 3 + 30 * 1 + 40 * 1 && graph[3] == 43);
+
+		graph.rebuild_edges({ { 1, 0 } });
+		assert(graph.edge_count() == 1 && graph.degree(0) == 0 && graph.degree(1) == 1);
+
+		// parallel iteration over a larger graph
+		{
+			const std::size_t n = 10000;
+			std::vector<int> verts(n, 1);
+			std::vector<std::pair<std::size_t, std::size_t>> edges;
+			for (std::size_t i = 0; i < n; ++i) for (std::size_t j = 1; j <= i % 5; ++j) edges.emplace_back(i, (i + j) % n);
+
+			GC::csr_graph<int> big;
+			big.rebuild(std::move(verts), edges.begin(), edges.end());
+			assert(big.vertex_count() == n && big.edge_count() == edges.size());
+
+			std::atomic<std::size_t> degrees{ 0 };
+			big.parallel_for_each_vertex([&degrees](std::size_t i, int &v, auto neighbors)
+			{
+				for (std::size_t j = 0; j < neighbors.size(); ++j) assert(neighbors[j] == (i + j + 1) % n);
+				degrees += neighbors.size();
+				v = (int)i;
+			}, 4);
+			assert(degrees == edges.size() && big[n - 1] == (int)(n - 1));
+
+			try { big.parallel_for_each_vertex([](std::size_t i, int&, auto) { if (i == 7777) throw std::runtime_error("vertex error"); }, 4); assert(false); }
+			catch (const std::runtime_error&) {}
+		}
+
+		// vertex payloads are routed (including cycles through the graph itself)
+		{
+			GC::ptr<GC::csr_graph<GC::ptr<void>>> holder = GC::make<GC::csr_graph<GC::ptr<void>>>();
+			std::vector<GC::ptr<void>> verts;
+			for (int i = 0; i < 1000; ++i) verts.push_back(GC::make<alive_counter>());
+			verts.push_back(holder);
+			holder->rebuild(std::move(verts), { { 1000, 0 }, { 0, 1000 } });
+			GC::collect();
+			assert(alive_counter::alive == 1000 && holder->vertex_count() == 1001 && (*holder)[1000] == holder);
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- concurrent_map tests -- //
+		typedef GC::concurrent_map<int, GC::ptr<int>> cmap_t;
+		GC::ptr<cmap_t> map = GC::make<cmap_t>();
+
+		assert(map->empty() && !map->get(0) && map->erase(0) == 0);
+		bool inserted = map->insert({ 5, GC::make<int>(50) });
+		bool reinserted = map->insert({ 5, GC::make<int>(-1) });
+		assert(inserted && !reinserted);
+		bool emplaced = map->try_emplace(3, GC::make<int>(30));
+		bool reemplaced = map->try_emplace(3, GC::make<int>(-1));
+		assert(emplaced && !reemplaced);
+		bool assigned_new = map->insert_or_assign(9, GC::make<int>(-1));
+		bool reassigned_new = map->insert_or_assign(9, GC::make<int>(90));
+		assert(assigned_new && !reassigned_new);
+		std::optional<GC::ptr<int>> nine = map->get(9);
+		assert(map->size() == 3 && nine && **nine == 90);
+
+		map->clear();
+		assert(map->empty() && !map->contains(3));
+
+		// ordered scans racing with unlinking: keys 4k+1 and 4k+2 are present throughout, 4k is erased and 4k+3 is inserted concurrently.
+		// a scan may or may not see the keys being changed, but it must stay in order and never skip a node that was present the whole time.
+		for (int key = 0; key < 4000; ++key) if (key % 4 != 3) map->try_emplace(key, GC::make<int>(key));
+
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 2; ++i) threads.emplace_back([map, i]
+		{
+			// the two erasers work from opposite ends, so they unlink neighbors of nodes the other thread is also unlinking
+			for (int j = 0; j < 500; ++j)
+			{
+				int key = 4 * (i == 0 ? j : 999 - j);
+				std::size_t erased = map->erase(key);
+				assert(erased == 1);
+				if (j % 128 == 0) GC::collect();
+			}
+		});
+		for (int i = 0; i < 2; ++i) threads.emplace_back([map, i]
+		{
+			for (int j = i; j < 1000; j += 2)
+			{
+				bool inserted = map->try_emplace(4 * j + 3, GC::make<int>(4 * j + 3));
+				assert(inserted);
+			}
+		});
+		std::atomic<int> full_scans(0);
+		for (int i = 0; i < 2; ++i) threads.emplace_back([map, &full_scans]
+		{
+			for (int j = 0; j < 40; ++j)
+			{
+				int prev = -1, stable = 0;
+				map->for_each([&](int key, const GC::ptr<int> &v) { assert(key > prev && *v == key); prev = key; if (key % 4 == 1 || key % 4 == 2) ++stable; });
+				assert(stable == 2000);
+
+				prev = 999, stable = 0;
+				map->for_each_in_range(1000, 2000, [&](int key, const GC::ptr<int> &v) { assert(key > prev && key < 2000 && *v == key); prev = key; if (key % 4 == 1 || key % 4 == 2) ++stable; });
+				assert(stable == 500);
+
+				++full_scans;
+			}
+		});
+		for (auto &t : threads) t.join();
+		assert(full_scans == 80);
+
+		GC::collect();
+		assert(map->size() == 3000);
+		for (int key = 0; key < 4000; ++key) assert(map->contains(key) == (key % 4 != 0));
+		std::optional<GC::ptr<int>> seven = map->get(7);
+		assert(seven && **seven == 7 && !map->get(8));
+
+		// ordered range scans
+		std::vector<int> keys;
+		map->for_each_in_range(0, 12, [&keys](int key, const GC::ptr<int>&) { keys.push_back(key); });
+		assert((keys == std::vector<int>{ 1, 2, 3, 5, 6, 7, 9, 10, 11 }));
+
+		bool visited = map->visit(7, [](GC::ptr<int> &v) { v = GC::make<int>(-1); });
+		assert(visited && !map->visit(8, [](GC::ptr<int>&) { assert(false); }));
+		std::optional<GC::ptr<int>> changed = map->get(7);
+		assert(changed && **changed == -1);
+
+		map->clear();
+		assert(map->empty() && !map->contains(3));
+
+		// removed nodes are reclaimed once no reader can see them
+		{
+			GC::concurrent_map<int, alive_counter> counted;
+			for (int i = 0; i < 100; ++i) counted.try_emplace(i);
+			{
+				GC::epoch_guard guard;
+				std::size_t erased = 0;
+				for (int i = 0; i < 100; i += 2) erased += counted.erase(i);
+				assert(erased == 50);
+				assert(alive_counter::alive == 100); // the guard keeps them alive
+			}
+			collect_until([] { return alive_counter::alive == 50; });
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+
+		// destroying a large map doesn't recurse through its nodes
+		{
+			GC::concurrent_map<int, int> big;
+			for (int i = 0; i < 100000; ++i) big.try_emplace(i, i);
+			assert(big.size() == 100000);
+		}
+	}
+
+	{ // -- btree tests -- //
+		typedef GC::btree_map<int, GC::ptr<int>> map_t;
+
+		// enough entries for several levels of inner nodes
+		GC::ptr<map_t> map = GC::make<map_t>();
+		int inserted = 0;
+		for (int i = 0; i < 20000; i += 2) inserted += map->insert(i, GC::make<int>(i)).second;
+		for (int i = 19999; i > 0; i -= 2) inserted += map->try_emplace(i, GC::make<int>(i)).second;
+		bool reinserted = map->insert(10, GC::make<int>(-1)).second;
+		assert(inserted == 20000 && !reinserted);
+		GC::collect(); // values are only reachable through the map
+
+		assert(map->size() == 20000);
+		for (int i = 0; i < 20000; i += 7) assert(map->contains(i) && *map->at(i) == i);
+		assert(map->find(-1) == nullptr && map->count(20000) == 0);
+
+		int expect = 0;
+		for (auto entry : *map) { assert(entry.first == expect && *entry.second == expect); ++expect; }
+		assert(expect == 20000);
+		map_t::iterator last = map->end();
+		assert((*--last).first == 19999);
+
+		// erasing in a scattered order exercises borrowing and merging at every level
+		std::size_t erased = 0;
+		for (int i = 0; i < 20000; i += 3) erased += map->erase(i);
+		std::size_t reerased = map->erase(0);
+		assert(erased == 6667 && reerased == 0 && map->size() == 20000 - 6667);
+		GC::collect();
+
+		std::vector<int> keys;
+		map->for_each_in_range(10, 20, [&keys](int key, GC::ptr<int> &v) { assert(*v == key); keys.push_back(key); });
+		assert((keys == std::vector<int>{ 10, 11, 13, 14, 16, 17, 19 }));
+		assert(map->lower_bound(12).key() == 13 && map->upper_bound(13).key() == 14 && map->lower_bound(20000) == map->end());
+
+		map->insert_or_assign(1, GC::make<int>(1000));
+		(*map)[-5] = GC::make<int>(-5);
+		assert(*map->at(1) == 1000 && map->begin().key() == -5);
+
+		bool threw = false;
+		try { (void)map->at(3); }
+		catch (const std::out_of_range&) { threw = true; }
+		assert(threw);
+
+		map_t copy = *map;
+		assert(copy == *map);
+		map_t moved = std::move(copy);
+		assert(moved == *map && copy.empty());
+
+		for (int i = -5; i < 20000; ++i) map->erase(i);
+		assert(map->empty() && map->begin() == map->end());
+
+		// bulk loading an unsorted batch with duplicates (first occurrences win)
+		std::vector<std::pair<int, GC::ptr<int>>> batch;
+		for (int i = 999; i >= 0; --i) batch.emplace_back(i, GC::make<int>(i));
+		batch.emplace_back(0, GC::make<int>(-1));
+		map->insert(batch.begin(), batch.end());
+		batch.clear();
+		GC::collect();
+
+		assert(map->size() == 1000);
+		expect = 0;
+		map->for_each([&expect](int key, GC::ptr<int> &v) { assert(key == expect && *v == expect); ++expect; });
+
+		// sets only hold keys
+		GC::btree_set<int> set{ 5, 3, 9, 3 };
+		assert(set.size() == 3 && *set.begin() == 3 && set.contains(9) && !set.contains(4));
+		for (int i = 0; i < 1000; ++i) set.insert(i);
+		erased = 0;
+		for (int i = 0; i < 1000; i += 2) erased += set.erase(i);
+		assert(erased == 500);
+		assert(set.size() == 500 && set.find(3) != set.end() && set.find(4) == set.end());
+
+		// a key copy that throws (including the separator copied when a leaf splits) leaves the tree untouched
+		GC::btree_set<copy_thrower> throwing;
+		for (int i = 0; i < 2000; ++i)
+		{
+			copy_thrower key(i);
+			copy_thrower::armed = true;
+			try { throwing.insert(key); assert(false); }
+			catch (const std::runtime_error&) {}
+			copy_thrower::armed = false;
+
+			assert(throwing.size() == (std::size_t)i && !throwing.contains(key));
+			throwing.insert(key);
+		}
+		expect = 0;
+		for (const copy_thrower &k : throwing) { assert(k.value == expect); ++expect; }
+		assert(expect == 2000);
+
+		// unreachable maps release their values
+		{
+			GC::ptr<GC::btree_map<int, GC::ptr<alive_counter>>> counted = GC::make<GC::btree_map<int, GC::ptr<alive_counter>>>();
+			for (int i = 0; i < 1000; ++i) counted->try_emplace(i, GC::make<alive_counter>());
+		}
+		collect_until([] { return alive_counter::alive == 0; });
+	}
+
+	{ // -- ref count destruction tests -- //
+		// a destructor can collect, and a concurrent collection can't free its children out from under it
+		std::atomic<bool> done(false);
+		std::thread collector([&done] { while (!done) GC::collect(); });
+		for (int i = 0; i < 2000; ++i)
+		{
+			GC::ptr<collecting_dtor> obj = GC::make<collecting_dtor>();
+			obj->child = GC::make<int>(42);
+		}
+		done = true;
+		collector.join();
+
+		collect_until([] { return collecting_dtor::checked == 2000; });
+
+		// collections keep making progress while other threads destroy objects by reference counting nonstop
+		{
+			std::atomic<bool> churning(true);
+			std::vector<std::thread> churners;
+			for (int i = 0; i < 2; ++i) churners.emplace_back([&churning]
+			{
+				while (churning)
+				{
+					GC::ptr<GC::vector<GC::ptr<int>>> vec = GC::make<GC::vector<GC::ptr<int>>>();
+					for (int j = 0; j < 4; ++j) vec->push_back(GC::make<int>(j));
+				}
+			});
+			for (int round = 0; round < 5; ++round)
+			{
+				for (int i = 0; i < 10; ++i)
+				{
+					GC::ptr<self_cycle> cycle = GC::make<self_cycle>();
+					cycle->self = cycle;
+				}
+				collect_until([] { return self_cycle::alive == 0; });
+			}
+			churning = false;
+			for (auto &t : churners) t.join();
+		}
+
+		// dropping the head of a long chain destroys it a link at a time rather than recursing through the destructors
+		{
+			GC::ptr<chain_node> head;
+			for (int i = 0; i < 200000; ++i)
+			{
+				GC::ptr<chain_node> node = GC::make<chain_node>();
+				node->next = head;
+				head = node;
+			}
+		}
+	}
+
 	{ // -- array-form GC::ptr tests -- //
 
 		static_assert(std::is_same<int(*)[6], decltype(std::declval<GC::ptr<int[6]>>().get())>::value, "array-form ptr type error");